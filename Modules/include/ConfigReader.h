@@ -13,6 +13,8 @@ namespace ChimeraTK {
   struct ArrayFunctorFill;
   struct FunctorSetValues;
   struct FunctorSetValuesArray;
+  struct FunctorFillCompiled;
+  struct FunctorReload;
 
   /**
    *  Generic module to read an XML config file and provide the defined values as constant variables. The config file
@@ -30,29 +32,106 @@ namespace ChimeraTK {
    *
    *  Configuration values can already be accessed during the Application::defineConnection() function by using the
    *  ConfigReader::get() function.
+   *
+   *  If enableLiveReload() has been called, the ConfigReader watches the config file and re-reads it whenever it has
+   *  been changed. Only the values which differ from the current values are sent, all with the same VersionNumber, so
+   *  the receivers see the change as one consistent update. The set of variables, their types and the array lengths
+   *  cannot be changed at runtime, since the outputs have already been connected. A changed file which does not parse
+   *  or does not match the existing variables is ignored with a warning and the previous values stay in effect.
+   *
+   *  The XML file is read with a streaming parser, so the memory needed does not grow with the file size beyond the
+   *  converted values. Sparse arrays are rejected with an exception. Values which cannot be converted completely into
+   *  the given type are converted as far as possible like with a std::istream (e.g. "3.5" gives 3 for integer types,
+   *  "12a" gives 12, values out of range give the limit of the type). If strictConversion is set in the constructor,
+   *  such values are rejected with an exception instead.
+   *
+   *  Large config files can be compiled into a binary file with ConfigReader::compile() or the tool
+   *  chimeratk-compile-config. If a compiled file "<fileName>.bin" exists next to the XML file, the values are loaded
+   *  from it through a memory mapping without parsing the XML file. The compiled file contains the hash of the XML file
+   *  it has been created from. If the XML file has been changed since, the compiled file is ignored and the XML file is
+   *  parsed as usual, so the XML file always stays the source of the configuration.
+   *
+   *  The compiled file has the following layout (all integers in the native byte order, offsets relative to the
+   *  beginning of the file):
+   *
+   *  - header: the magic string "CTKCONF1" (8 bytes), uint32 format version (see compiledFormatVersion), uint32
+   *    reserved, uint64 content hash of the XML file (see contentHash()), uint64 number of variables, uint64 size of
+   *    the file
+   *  - one entry per variable: uint64 name offset, uint64 type offset, uint32 name length, uint32 type length,
+   *    uint32 array flag, uint32 number of elements, uint64 data offset, uint64 data size (48 bytes in total)
+   *  - the names and the type strings
+   *  - the values of each variable, aligned to 8 bytes. Numeric values are stored contiguously in their binary
+   *    representation, so an array is copied into the vector of the ArrayOutput in one go. Strings are stored as
+   *    uint32 length followed by the characters.
    */
   struct ConfigReader : ApplicationModule {
 
       ConfigReader(EntityOwner *owner, const std::string &name, const std::string &fileName,
-                  const std::unordered_set<std::string> &tags={});
+                  const std::unordered_set<std::string> &tags={}, bool strictConversion=false);
 
-      void mainLoop() override {}
+      void mainLoop() override;
       void prepare() override;
 
+      /** Watch the config file for changes and send the changed values (see class description). Must be called before
+       *  the application is started. With live reload enabled, get() must only be used before the application is
+       *  started, since the values returned by it are updated by the ConfigReader thread. */
+      void enableLiveReload() { _liveReload = true; }
+
       /** Get value for given configuration variable. This is already accessible right after construction of this
        *  object. Throws std::out_of_range if variable doesn't exist.
        *  To obtain the value of an array, use an std::vector<T> as template argument. */
       template<typename T>
       const T& get(const std::string &variableName) const;
 
+      /** Compile the XML config file into the binary format (see class description). If no name for the compiled file
+       *  is given, "<fileName>.bin" is used, which is the file the constructor looks for. See the constructor for
+       *  strictConversion. */
+      static void compile(const std::string &fileName, const std::string &compiledFileName={},
+                          bool strictConversion=false);
+
+      /** Compute the hash of the content of the given file, which is stored in the compiled file to detect changes of
+       *  the XML file (64 bit FNV-1a). */
+      static uint64_t contentHash(const std::string &fileName);
+
+      /** Check whether the values have been loaded from the compiled file instead of the XML file */
+      bool isLoadedFromCompiledFile() const { return _loadedFromCompiledFile; }
+
+      /** Map assigning the type names used in the config file to the C++ types */
+      static const mtca4u::SingleTypeUserTypeMap<const char*> typeMap;
+
+      /** Magic string at the beginning of each compiled file */
+      static constexpr const char *compiledMagic = "CTKCONF1";
+
+      /** Version of the layout of the compiled file. Compiled files of other versions are ignored. */
+      static constexpr uint32_t compiledFormatVersion = 2;
+
     protected:
 
       /** File name */
       std::string _fileName;
 
+      /** Flag whether the values have been loaded from the compiled file */
+      bool _loadedFromCompiledFile{false};
+
+      /** Flag whether values which cannot be converted completely are rejected, see class description */
+      bool _strictConversion;
+
       /** throw a parsing error with more information */
       void parsingError(const std::string &message);
 
+      /** Load the values from the compiled file, if it exists and matches the XML file. Returns false otherwise. */
+      bool loadCompiledFile();
+
+      /** Flag whether the config file is watched for changes, see enableLiveReload() */
+      bool _liveReload{false};
+
+      /** Number of variables and arrays, used to detect removed variables when reloading */
+      size_t _nVariables{0};
+
+      /** Re-read the config file and send the changed values with one common VersionNumber. A file which cannot be
+       *  parsed or does not match the existing variables is ignored with a warning. */
+      void reload();
+
       /** Class holding the value and the accessor for one configuration variable */
       template<typename T>
       struct Var {
@@ -68,9 +147,9 @@ namespace ChimeraTK {
       /** Class holding the values and the accessor for one configuration array */
       template<typename T>
       struct Array {
-          Array(Module *owner, const std::string &name, const std::vector<T> &value)
+          Array(Module *owner, const std::string &name, std::vector<T> value)
           : _accessor(owner, name, "unknown", value.size(), "Configuration array"),
-          _value(value)
+          _value(std::move(value))
           {}
 
           ArrayOutput<T> _accessor;
@@ -79,11 +158,11 @@ namespace ChimeraTK {
 
       /** Create an instance of Var<T> and place it on the variableMap */
       template<typename T>
-      void createVar(const std::string &name, const std::string &value);
+      void createVar(const std::string &name, const T &value);
 
       /** Create an instance of Array<T> and place it on the arrayMap */
       template<typename T>
-      void createArray(const std::string &name, const std::map<size_t, std::string> &values);
+      void createArray(const std::string &name, std::vector<T> values);
 
       /** Define type for map of std::string to Var, so we can put it into the TemplateUserTypeMap */
       template<typename T>
@@ -99,10 +178,6 @@ namespace ChimeraTK {
       /** Type-depending map of vectors of arrays */
       mtca4u::TemplateUserTypeMap<MapOfArray> arrayMap;
 
-      /** Map assigning string type identifyers to C++ types */
-      mtca4u::SingleTypeUserTypeMap<const char*> typeMap{"int8","uint8","int16","uint16","int32","uint32",
-                                                         "int64","uint64","float","double","string"};
-
       /** Implementation of get() which can be overloaded for scalars and vectors. The second argument is a dummy
        *  only to distinguish the two overloaded functions. */
       template<typename T>
@@ -114,6 +189,8 @@ namespace ChimeraTK {
       friend struct ArrayFunctorFill;
       friend struct FunctorSetValues;
       friend struct FunctorSetValuesArray;
+      friend struct FunctorFillCompiled;
+      friend struct FunctorReload;
 
   };
 
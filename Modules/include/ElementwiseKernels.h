@@ -0,0 +1,109 @@
+/*
+ *  Vectorised kernels for element-wise scaling of arrays, used by the Multiplier modules
+ */
+
+#ifndef CHIMERATK_APPLICATION_CORE_ELEMENTWISE_KERNELS_H
+#define CHIMERATK_APPLICATION_CORE_ELEMENTWISE_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace ChimeraTK {
+  namespace ElementwiseKernels {
+
+    /** Instruction sets the kernels are available for */
+    enum class InstructionSet { scalar, sse41, avx2 };
+
+    /** Return the instruction set used by the kernels. It is determined at runtime from the capabilities of the CPU,
+     *  unless overridden with setInstructionSet(). */
+    InstructionSet getInstructionSet();
+
+    /** Override the instruction set used by the kernels. If the CPU does not support the given instruction set, the
+     *  best supported one below it is used instead. Mainly intended for tests and benchmarks. Not thread safe. */
+    void setInstructionSet(InstructionSet set);
+
+    /** Return the best instruction set supported by the CPU */
+    InstructionSet getSupportedInstructionSet();
+
+    namespace detail {
+
+      /** Check whether a vectorised kernel exists for the given pair of types. There are no kernels for 64 bit
+       *  integers, since they cannot be converted to and from double with SSE4.1/AVX2; these types use the plain
+       *  loop. */
+      template<typename T>
+      struct IsKernelType : std::integral_constant<bool,
+          std::is_same<T,int8_t>::value || std::is_same<T,uint8_t>::value ||
+          std::is_same<T,int16_t>::value || std::is_same<T,uint16_t>::value ||
+          std::is_same<T,int32_t>::value || std::is_same<T,uint32_t>::value ||
+          std::is_same<T,float>::value || std::is_same<T,double>::value> {};
+
+      template<typename InputType, typename OutputType>
+      struct HasKernel : std::integral_constant<bool,
+          IsKernelType<InputType>::value && IsKernelType<OutputType>::value> {};
+
+      /** Vectorised implementations, defined in ElementwiseKernels.cc for all pairs for which HasKernel is true */
+      template<typename InputType, typename OutputType>
+      void multiplyVectorised(const InputType *input, OutputType *output, size_t n, double factor);
+      template<typename InputType, typename OutputType>
+      void divideVectorised(const InputType *input, OutputType *output, size_t n, double divider);
+
+      /** Plain implementations, used for types without vectorised kernel and for the tail of the arrays */
+      template<typename InputType, typename OutputType>
+      void multiplyScalar(const InputType *input, OutputType *output, size_t n, double factor) {
+        if(!std::numeric_limits<OutputType>::is_integer) {
+          for(size_t i=0; i<n; ++i) output[i] = input[i] * factor;
+        }
+        else {
+          for(size_t i=0; i<n; ++i) output[i] = std::round(input[i] * factor);
+        }
+      }
+
+      template<typename InputType, typename OutputType>
+      void divideScalar(const InputType *input, OutputType *output, size_t n, double divider) {
+        if(!std::numeric_limits<OutputType>::is_integer) {
+          for(size_t i=0; i<n; ++i) output[i] = input[i] / divider;
+        }
+        else {
+          for(size_t i=0; i<n; ++i) output[i] = std::round(input[i] / divider);
+        }
+      }
+
+      template<typename InputType, typename OutputType>
+      void multiply(const InputType *input, OutputType *output, size_t n, double factor, std::true_type) {
+        multiplyVectorised(input, output, n, factor);
+      }
+      template<typename InputType, typename OutputType>
+      void multiply(const InputType *input, OutputType *output, size_t n, double factor, std::false_type) {
+        multiplyScalar(input, output, n, factor);
+      }
+      template<typename InputType, typename OutputType>
+      void divide(const InputType *input, OutputType *output, size_t n, double divider, std::true_type) {
+        divideVectorised(input, output, n, divider);
+      }
+      template<typename InputType, typename OutputType>
+      void divide(const InputType *input, OutputType *output, size_t n, double divider, std::false_type) {
+        divideScalar(input, output, n, divider);
+      }
+
+    } /* namespace detail */
+
+    /** Compute output[i] = input[i] * factor for n elements. If OutputType is integral, the result is rounded with
+     *  the semantics of std::round(). The result is identical to the plain loop for all instruction sets. */
+    template<typename InputType, typename OutputType>
+    void multiply(const InputType *input, OutputType *output, size_t n, double factor) {
+      detail::multiply(input, output, n, factor, detail::HasKernel<InputType,OutputType>());
+    }
+
+    /** Compute output[i] = input[i] / divider for n elements, otherwise identical to multiply() */
+    template<typename InputType, typename OutputType>
+    void divide(const InputType *input, OutputType *output, size_t n, double divider) {
+      detail::divide(input, output, n, divider, detail::HasKernel<InputType,OutputType>());
+    }
+
+  } /* namespace ElementwiseKernels */
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_APPLICATION_CORE_ELEMENTWISE_KERNELS_H */
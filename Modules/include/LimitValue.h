@@ -6,42 +6,70 @@
 #define CHIMERATK_APPLICATION_CORE_LIMIT_VALUE_H
 
 #include "ApplicationCore.h"
+#include "ElementwiseStage.h"
 
 namespace ChimeraTK {
 
   template<typename UserType>
-  struct LimitValueModuleBase : public ApplicationModule {
+  struct LimitValueModuleBase : public ApplicationModule, public ElementwiseStage {
       using ApplicationModule::ApplicationModule;
 
       ScalarPushInput<UserType> input{this, "input", "", "The input value to be limited into the range."};
       ScalarOutput<UserType> output{this, "output", "", "The output value after limiting."};
       ScalarOutput<int> isLimited{this, "isLimited", "", "Boolean set to true if the value was limited and to false otherwise."};
 
-      void applyLimit(UserType min, UserType max) {
-        bool wasLimited = isLimited;
-        
-        // clamp input value into given range
-        UserType value = input;
+      /** Clamp the given value into the given range and set isLimited accordingly (without writing it) */
+      UserType clamp(UserType value, UserType min, UserType max) {
         if(value > max) {
-          output = max;
           isLimited = true;
+          return max;
         }
         else if(value < min) {
-          output = min;
           isLimited = true;
+          return min;
         }
-        else {
-          output = value;
-          isLimited = false;
-        }
+        isLimited = false;
+        return value;
+      }
+
+      void applyLimit(UserType min, UserType max) {
+        bool wasLimited = isLimited;
+        
+        // clamp input value into given range
+        output = clamp(input, min, max);
         
         // write output. isLimited is only written when changed
         output.write();
         if(isLimited != wasLimited) isLimited.write();
-        wasLimited = isLimited;
         
       }
 
+      /** Return the currently valid range, used when executed as part of a fused chain */
+      virtual UserType getMinimum() = 0;
+      virtual UserType getMaximum() = 0;
+
+      // implementation of the ElementwiseStage interface
+      VariableNetworkNode getStageInput() override { return input; }
+      VariableNetworkNode getStageOutput() override { return output; }
+      TransferElementAbstractor& getStageInputAccessor() override { return input; }
+      bool isFusable() const override { return detail::isExactInDouble<UserType>(); }
+      size_t getStageNumberOfElements() override { return 1; }
+      void readStageInput(double *values, size_t, size_t) override { values[0] = static_cast<UserType>(input); }
+      void applyStage(double *values, size_t) override {
+        stageWasLimited = isLimited;
+        values[0] = clamp(static_cast<UserType>(values[0]), getMinimum(), getMaximum());
+      }
+      void storeStageOutput(const double *values, size_t, size_t) override { output = static_cast<UserType>(values[0]); }
+      void writeStageOutput() override { output.write(); }
+      void writeStageSideOutputs() override {
+        if(isLimited != stageWasLimited) isLimited.write();
+      }
+
+    protected:
+
+      /** Value of isLimited before the last call to applyStage() */
+      bool stageWasLimited{false};
+
   };
 
   template<typename UserType>
@@ -59,6 +87,10 @@ namespace ChimeraTK {
           Application::readAny({input, min, max});
         }
       }
+
+      UserType getMinimum() override { return min; }
+      UserType getMaximum() override { return max; }
+      std::list<std::reference_wrapper<TransferElementAbstractor>> getStageParameters() override { return {min, max}; }
   };
 
 
@@ -76,6 +108,9 @@ namespace ChimeraTK {
         }
       }
 
+      UserType getMinimum() override { return min; }
+      UserType getMaximum() override { return max; }
+
   };
 
 } // namespace ChimeraTK
@@ -7,13 +7,36 @@
 
 #include <limits>
 #include <cmath>
+#include <vector>
+#include <type_traits>
 
 #include "ApplicationCore.h"
+#include "ElementwiseStage.h"
+#include "ElementwiseKernels.h"
 
 namespace ChimeraTK {
 
+  namespace detail {
+
+    /** Scale the values of a block in a fused chain (see ElementwiseStage::applyStage()) in place, including the
+     *  conversion into OutputType. The buffer is used to hold the converted values. */
+    template<typename OutputType, bool DIVIDE>
+    void scaleStageValues(double *values, size_t n, double parameter, std::vector<OutputType> &buffer) {
+      if(std::is_same<OutputType, double>::value) {
+        if(DIVIDE) ElementwiseKernels::divide(values, values, n, parameter);
+        else ElementwiseKernels::multiply(values, values, n, parameter);
+        return;
+      }
+      buffer.resize(n);
+      if(DIVIDE) ElementwiseKernels::divide(values, buffer.data(), n, parameter);
+      else ElementwiseKernels::multiply(values, buffer.data(), n, parameter);
+      ElementwiseKernels::multiply(buffer.data(), values, n, 1.);
+    }
+
+  } // namespace detail
+
   template<typename InputType, typename OutputType=InputType, size_t NELEMS=1>
-  struct ConstMultiplier : public ApplicationModule {
+  struct ConstMultiplier : public ApplicationModule, public ElementwiseStage {
       
       ConstMultiplier(EntityOwner *owner, const std::string &name, const std::string &description, double factor)
       : ApplicationModule(owner, name, description), _factor(factor) {
@@ -29,12 +52,7 @@ namespace ChimeraTK {
         while(true) {
           
           // scale value (with rounding, if integral type)
-          if(!std::numeric_limits<OutputType>::is_integer) {
-            for(size_t i=0; i<NELEMS; ++i) output[i] = input[i] * _factor;
-          }
-          else {
-            for(size_t i=0; i<NELEMS; ++i) output[i] = std::round(input[i] * _factor);
-          }
+          ElementwiseKernels::multiply(&input[0], &output[0], NELEMS, _factor);
           
           // write scaled value
           output.write();
@@ -44,10 +62,34 @@ namespace ChimeraTK {
         }
       }
 
+      // implementation of the ElementwiseStage interface
+      VariableNetworkNode getStageInput() override { return input; }
+      VariableNetworkNode getStageOutput() override { return output; }
+      TransferElementAbstractor& getStageInputAccessor() override { return input; }
+      bool isFusable() const override {
+        return detail::isExactInDouble<InputType>() && detail::isExactInDouble<OutputType>();
+      }
+      size_t getStageNumberOfElements() override { return NELEMS; }
+      void readStageInput(double *values, size_t offset, size_t n) override {
+        ElementwiseKernels::multiply(&input[offset], values, n, 1.);
+      }
+      void applyStage(double *values, size_t n) override {
+        detail::scaleStageValues<OutputType, false>(values, n, _factor, _stageBuffer);
+      }
+      void storeStageOutput(const double *values, size_t offset, size_t n) override {
+        ElementwiseKernels::multiply(values, &output[offset], n, 1.);
+      }
+      void writeStageOutput() override { output.write(); }
+
+    protected:
+
+      /** Buffer for applyStage() */
+      std::vector<OutputType> _stageBuffer;
+
   };
 
   template<typename InputType, typename OutputType=InputType, size_t NELEMS=1>
-  struct Multiplier : public ApplicationModule {
+  struct Multiplier : public ApplicationModule, public ElementwiseStage {
     
       using ApplicationModule::ApplicationModule;
       Multiplier(EntityOwner *owner, const std::string &name, const std::string &description)
@@ -63,12 +105,7 @@ namespace ChimeraTK {
         while(true) {
           
           // scale value (with rounding, if integral type)
-          if(!std::numeric_limits<OutputType>::is_integer) {
-            for(size_t i=0; i<NELEMS; ++i) output[i] = input[i] * factor;
-          }
-          else {
-            for(size_t i=0; i<NELEMS; ++i) output[i] = std::round(input[i] * factor);
-          }
+          ElementwiseKernels::multiply(&input[0], &output[0], NELEMS, factor);
           
           // write scaled value
           output.write();
@@ -78,10 +115,35 @@ namespace ChimeraTK {
         }
       }
 
+      // implementation of the ElementwiseStage interface
+      VariableNetworkNode getStageInput() override { return input; }
+      VariableNetworkNode getStageOutput() override { return output; }
+      TransferElementAbstractor& getStageInputAccessor() override { return input; }
+      std::list<std::reference_wrapper<TransferElementAbstractor>> getStageParameters() override { return {factor}; }
+      bool isFusable() const override {
+        return detail::isExactInDouble<InputType>() && detail::isExactInDouble<OutputType>();
+      }
+      size_t getStageNumberOfElements() override { return NELEMS; }
+      void readStageInput(double *values, size_t offset, size_t n) override {
+        ElementwiseKernels::multiply(&input[offset], values, n, 1.);
+      }
+      void applyStage(double *values, size_t n) override {
+        detail::scaleStageValues<OutputType, false>(values, n, factor, _stageBuffer);
+      }
+      void storeStageOutput(const double *values, size_t offset, size_t n) override {
+        ElementwiseKernels::multiply(values, &output[offset], n, 1.);
+      }
+      void writeStageOutput() override { output.write(); }
+
+    protected:
+
+      /** Buffer for applyStage() */
+      std::vector<OutputType> _stageBuffer;
+
   };
 
   template<typename InputType, typename OutputType=InputType, size_t NELEMS=1>
-  struct Divider : public ApplicationModule {
+  struct Divider : public ApplicationModule, public ElementwiseStage {
     
       using ApplicationModule::ApplicationModule;
       Divider(EntityOwner *owner, const std::string &name, const std::string &description)
@@ -97,12 +159,7 @@ namespace ChimeraTK {
         while(true) {
           
           // scale value (with rounding, if integral type)
-          if(!std::numeric_limits<OutputType>::is_integer) {
-            for(size_t i=0; i<NELEMS; ++i) output[i] = input[i] / divider;
-          }
-          else {
-            for(size_t i=0; i<NELEMS; ++i) output[i] = std::round(input[i] / divider);
-          }
+          ElementwiseKernels::divide(&input[0], &output[0], NELEMS, divider);
           
           // write scaled value
           output.write();
@@ -112,6 +169,31 @@ namespace ChimeraTK {
         }
       }
 
+      // implementation of the ElementwiseStage interface
+      VariableNetworkNode getStageInput() override { return input; }
+      VariableNetworkNode getStageOutput() override { return output; }
+      TransferElementAbstractor& getStageInputAccessor() override { return input; }
+      std::list<std::reference_wrapper<TransferElementAbstractor>> getStageParameters() override { return {divider}; }
+      bool isFusable() const override {
+        return detail::isExactInDouble<InputType>() && detail::isExactInDouble<OutputType>();
+      }
+      size_t getStageNumberOfElements() override { return NELEMS; }
+      void readStageInput(double *values, size_t offset, size_t n) override {
+        ElementwiseKernels::multiply(&input[offset], values, n, 1.);
+      }
+      void applyStage(double *values, size_t n) override {
+        detail::scaleStageValues<OutputType, true>(values, n, divider, _stageBuffer);
+      }
+      void storeStageOutput(const double *values, size_t offset, size_t n) override {
+        ElementwiseKernels::multiply(values, &output[offset], n, 1.);
+      }
+      void writeStageOutput() override { output.write(); }
+
+    protected:
+
+      /** Buffer for applyStage() */
+      std::vector<OutputType> _stageBuffer;
+
   };
 
 } // namespace ChimeraTK
@@ -9,8 +9,8 @@
 namespace ChimeraTK {
 
   /**
-  *  Generic module to pipe through a scalar value without altering it.
-  *  @todo Make it more efficient by removing this module entirely in the ApplicationCore connection logic!
+  *  Generic module to pipe through a scalar value without altering it. The module is declared as a pass-through
+  *  module, so the connection logic will usually remove it entirely (see ApplicationModule::declarePassThrough()).
   */
   template<typename Type>
   struct ScalarPipe : public ApplicationModule {
@@ -21,6 +21,7 @@ namespace ChimeraTK {
       {
         input.replace(ScalarPushInput<Type>(this, name, unit, description, tagsInput));
         output.replace(ScalarOutput<Type>(this, name, unit, description, tagsOutput));
+        declarePassThrough(input, output);
       }
 
       ScalarPipe(EntityOwner *owner, const std::string &inputName, const std::string &outputName, const std::string &unit,
@@ -30,6 +31,7 @@ namespace ChimeraTK {
       {
         input.replace(ScalarPushInput<Type>(this, inputName, unit, description, tagsInput));
         output.replace(ScalarOutput<Type>(this, outputName, unit, description, tagsOutput));
+        declarePassThrough(input, output);
       }
 
       ScalarPipe() {}
@@ -48,8 +50,8 @@ namespace ChimeraTK {
   };
 
   /**
-  *  Generic module to pipe through a scalar value without altering it.
-  *  @todo Make it more efficient by removing this module entirely in the ApplicationCore connection logic!
+  *  Generic module to pipe through an array value without altering it. The module is declared as a pass-through
+  *  module, so the connection logic will usually remove it entirely (see ApplicationModule::declarePassThrough()).
   */
   template<typename Type>
   struct ArrayPipe : public ApplicationModule {
@@ -60,6 +62,7 @@ namespace ChimeraTK {
       {
         input.replace(ArrayPushInput<Type>(this, name, unit, nElements, description, tagsInput));
         output.replace(ArrayOutput<Type>(this, name, unit, nElements, description, tagsOutput));
+        declarePassThrough(input, output);
       }
 
       ArrayPipe(EntityOwner *owner, const std::string &inputName, const std::string &outputName, const std::string &unit,
@@ -69,6 +72,7 @@ namespace ChimeraTK {
       {
         input.replace(ArrayPushInput<Type>(this, inputName, unit, nElements, description, tagsInput));
         output.replace(ArrayOutput<Type>(this, outputName, unit, nElements, description, tagsOutput));
+        declarePassThrough(input, output);
       }
 
       ArrayPipe() {}
@@ -1,16 +1,475 @@
-#include <libxml++/libxml++.h>
+#include <libxml/xmlreader.h>
+
+#include <fstream>
+#include <iostream>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <cctype>
+#include <limits>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <locale.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "ConfigReader.h"
 
 namespace ChimeraTK {
 
+  constexpr const char *ConfigReader::compiledMagic;
+  constexpr uint32_t ConfigReader::compiledFormatVersion;
+
+  const mtca4u::SingleTypeUserTypeMap<const char*> ConfigReader::typeMap{"int8","uint8","int16","uint16","int32",
+                                                                          "uint32","int64","uint64","float","double",
+                                                                          "string"};
+
+  namespace {
+
+    /** Throw a parsing error for the given file */
+    void throwParsingError(const std::string &fileName, const std::string &message) {
+      throw std::runtime_error("ConfigReader: Error parsing the config file '"+fileName+"': "+message);
+    }
+
+    /*******************************************************************************************************************/
+
+    /** Remove leading and trailing whitespace by moving begin and end */
+    void trim(const char *&begin, const char *&end) {
+      while(begin != end && std::isspace(static_cast<unsigned char>(*begin))) ++begin;
+      while(end != begin && std::isspace(static_cast<unsigned char>(*(end-1)))) --end;
+    }
+
+    /** Parse a decimal integer without any intermediate objects. Returns false if the text is not a number or out of
+     *  the range of the type. Surrounding whitespace is allowed. */
+    template<typename T>
+    typename std::enable_if<std::is_integral<T>::value, bool>::type parseValue(const std::string &text, T &value) {
+      const char *begin = text.data(), *end = text.data()+text.size();
+      trim(begin, end);
+      bool negative = false;
+      if(begin != end && (*begin == '-' || *begin == '+')) {
+        negative = (*begin == '-');
+        ++begin;
+      }
+      if(begin == end) return false;
+      uint64_t magnitude = 0;
+      for(; begin != end; ++begin) {
+        unsigned digit = static_cast<unsigned char>(*begin) - '0';
+        if(digit > 9) return false;
+        if(magnitude > (std::numeric_limits<uint64_t>::max() - digit)/10) return false;
+        magnitude = magnitude*10 + digit;
+      }
+      uint64_t limit = std::numeric_limits<T>::max();
+      if(negative) {
+        if(!std::is_signed<T>::value) limit = 0;    // only "-0" is accepted for unsigned types
+        else ++limit;                               // the magnitude of the minimum is one larger than the maximum
+      }
+      if(magnitude > limit) return false;
+      // the conversion of the two's complement is well-defined for the compilers supported
+      value = static_cast<T>(negative ? 0-magnitude : magnitude);
+      return true;
+    }
+
+    /** The C locale, so the decimal point does not depend on the locale set by the application */
+    locale_t cLocale() {
+      static locale_t locale = newlocale(LC_ALL_MASK, "C", static_cast<locale_t>(0));
+      return locale;
+    }
+
+    /** Parse a floating point number. Returns false if the text is not a number. Surrounding whitespace is allowed. */
+    template<typename T>
+    typename std::enable_if<std::is_floating_point<T>::value, bool>::type parseValue(const std::string &text, T &value) {
+      const char *begin = text.c_str();
+      char *end;
+      if(std::is_same<T, float>::value) {
+        value = strtof_l(begin, &end, cLocale());
+      }
+      else {
+        value = strtod_l(begin, &end, cLocale());
+      }
+      if(end == begin) return false;
+      const char *rest = end, *textEnd = text.data()+text.size();
+      trim(rest, textEnd);
+      return rest == textEnd;
+    }
+
+    bool parseValue(const std::string &text, std::string &value) {
+      value = text;
+      return true;
+    }
+
+    /** Convert a value which has been rejected by parseValue() as far as possible with a std::stringstream, as the
+     *  ConfigReader has always done (see class description of ConfigReader) */
+    template<typename T>
+    T convertLeniently(const std::string &text) {
+      std::stringstream stream(text);
+      T value{};
+      if(std::is_same<T, int8_t>::value || std::is_same<T, uint8_t>::value) {
+        // prevent interpreting int8-types as characters
+        int16_t intermediate{0};
+        stream >> intermediate;
+        value = intermediate;
+      }
+      else {
+        stream >> value;
+      }
+      return value;
+    }
+
+    template<>
+    std::string convertLeniently<std::string>(const std::string &text) {
+      return text;
+    }
+
+    /*******************************************************************************************************************/
+
+    /** Values of one variable, converted into the user type while parsing. The values are appended directly to a
+     *  vector of the user type, out-of-order values are kept aside until the gap before them has been filled. */
+    struct ValueCollector {
+      virtual ~ValueCollector() {}
+
+      /** Convert the value and store it at the given index. Returns false if the value cannot be converted. */
+      virtual bool set(size_t index, const std::string &value) = 0;
+
+      /** Number of values in the dense part of the array */
+      virtual size_t size() const = 0;
+
+      /** Smallest index beyond the dense part of the array, or 0 if there is none */
+      virtual size_t firstPendingIndex() const = 0;
+    };
+
+    template<typename T>
+    struct TypedValueCollector : ValueCollector {
+
+      TypedValueCollector(bool strict) : strict(strict) {}
+
+      bool set(size_t index, const std::string &value) override {
+        T converted;
+        if(!parseValue(value, converted)) {
+          if(strict) return false;
+          converted = convertLeniently<T>(value);
+        }
+        if(index == values.size()) {
+          values.push_back(std::move(converted));
+          // move values which were waiting for this gap to be filled
+          while(!pending.empty() && pending.begin()->first == values.size()) {
+            values.push_back(std::move(pending.begin()->second));
+            pending.erase(pending.begin());
+          }
+        }
+        else if(index < values.size()) {
+          values[index] = std::move(converted);       // the last definition of an index wins
+        }
+        else {
+          pending[index] = std::move(converted);
+        }
+        return true;
+      }
+
+      size_t size() const override { return values.size(); }
+
+      size_t firstPendingIndex() const override { return pending.empty() ? 0 : pending.begin()->first; }
+
+      /** Flag whether values which cannot be converted completely are rejected */
+      bool strict;
+
+      std::vector<T> values;
+      std::map<size_t, T> pending;
+    };
+
+    /** Functor to create the ValueCollector for the type string from the config file */
+    struct FunctorCreateCollector {
+      FunctorCreateCollector(const std::string &type, bool strict, std::unique_ptr<ValueCollector> &collector)
+      : _type(type), _strict(strict), _collector(collector)
+      {}
+
+      template<typename PAIR>
+      void operator()(PAIR&) const {
+        typedef typename PAIR::first_type T;
+        if(_type != boost::fusion::at_key<T>(ConfigReader::typeMap)) return;
+        _collector.reset(new TypedValueCollector<T>(_strict));
+      }
+
+      const std::string &_type;
+      bool _strict;
+      std::unique_ptr<ValueCollector> &_collector;
+    };
+
+    /*******************************************************************************************************************/
+
+    /** Handler called by parseConfigFile() for each variable with the name, the type string, the converted values
+     *  and the flag whether the variable is an array. Scalars have exactly one value. The values may be moved out of
+     *  the collector. */
+    typedef std::function<void(const std::string&, const std::string&, ValueCollector&, bool)> VariableHandler;
+
+    /** Parse the XML config file with the streaming xmlTextReader and call the handler for each variable. Only the
+     *  current element is kept in memory by the reader, the values are converted into the user type right away. If
+     *  strict is set, values which cannot be converted completely are rejected. */
+    void parseConfigFile(const std::string &fileName, bool strict, const VariableHandler &handler) {
+
+      std::unique_ptr<xmlTextReader, void(*)(xmlTextReaderPtr)> reader(
+          xmlReaderForFile(fileName.c_str(), nullptr, XML_PARSE_NONET), xmlFreeTextReader);
+      if(!reader) {
+        throw std::runtime_error("ConfigReader: Error opening the config file '"+fileName+"'.");
+      }
+
+      // state of the variable currently parsed. The strings are reused, so no memory is allocated per value.
+      std::string elementName, name, type, value, index;
+      bool inArrayVariable{false};
+      std::unique_ptr<ValueCollector> collector;
+      bool rootFound{false};
+
+      // obtain an attribute of the current element. The value is copied into the given string, which keeps its
+      // capacity between the calls. Returns false if the attribute does not exist.
+      auto readAttribute = [&](const char *attributeName, std::string &target) {
+        if(xmlTextReaderMoveToAttribute(reader.get(), reinterpret_cast<const xmlChar*>(attributeName)) != 1) {
+          return false;
+        }
+        target.assign(reinterpret_cast<const char*>(xmlTextReaderConstValue(reader.get())));
+        xmlTextReaderMoveToElement(reader.get());
+        return true;
+      };
+
+      // complete the current variable and pass it to the handler
+      auto finishVariable = [&](bool isArray) {
+        if(collector->size() == 0) {
+          if(collector->firstPendingIndex() != 0) {
+            throwParsingError(fileName, "Array index 0 not found, but "+std::to_string(collector->firstPendingIndex())+
+                                        " was. Sparse arrays are not supported!");
+          }
+          throwParsingError(fileName, "Each variable must have a value, either specified as an attribute or as "
+                                      "child tags.");
+        }
+        if(collector->firstPendingIndex() != 0) {
+          throwParsingError(fileName, "Array index "+std::to_string(collector->size())+" not found, but "+
+                                      std::to_string(collector->firstPendingIndex())+" was. Sparse arrays are not "
+                                      "supported!");
+        }
+        handler(name, type, *collector, isArray);
+        collector.reset();
+      };
+
+      int status;
+      while((status = xmlTextReaderRead(reader.get())) == 1) {
+        int nodeType = xmlTextReaderNodeType(reader.get());
+        if(nodeType != XML_READER_TYPE_ELEMENT && nodeType != XML_READER_TYPE_END_ELEMENT) continue;  // comments etc.
+        int depth = xmlTextReaderDepth(reader.get());
+        elementName.assign(reinterpret_cast<const char*>(xmlTextReaderConstLocalName(reader.get())));
+
+        // root element
+        if(depth == 0) {
+          if(nodeType == XML_READER_TYPE_ELEMENT) {
+            if(elementName != "configuration") {
+              throwParsingError(fileName, "Expected 'configuration' tag instead of: "+elementName);
+            }
+            rootFound = true;
+          }
+        }
+        // variable elements
+        else if(depth == 1) {
+          if(nodeType == XML_READER_TYPE_END_ELEMENT) {
+            if(inArrayVariable) finishVariable(true);
+            inArrayVariable = false;
+            continue;
+          }
+          if(elementName != "variable") {
+            throwParsingError(fileName, "Expected 'variable' tag instead of: configuration");
+          }
+          bool isEmpty = xmlTextReaderIsEmptyElement(reader.get()) == 1;
+          if(!readAttribute("name", name)) {
+            throwParsingError(fileName, "Missing attribute 'name' for the 'variable' tag.");
+          }
+          if(!readAttribute("type", type)) {
+            throwParsingError(fileName, "Missing attribute 'type' for the 'variable' tag.");
+          }
+
+          boost::fusion::for_each(mtca4u::SingleTypeUserTypeMap<bool>(),
+                                  FunctorCreateCollector(type, strict, collector));
+          if(!collector) {
+            throwParsingError(fileName, "Incorrect value '"+type+"' for attribute 'type' of the 'variable' tag.");
+          }
+
+          // scalar value: obtain value from attribute, child elements are ignored
+          if(readAttribute("value", value)) {
+            if(!collector->set(0, value)) {
+              throwParsingError(fileName, "Cannot parse value '"+value+"' of the variable '"+name+"' as type '"+
+                                          type+"'.");
+            }
+            finishVariable(false);
+          }
+          // array value: values follow as child elements
+          else if(isEmpty) {
+            finishVariable(true);
+          }
+          else {
+            inArrayVariable = true;
+          }
+        }
+        // value elements of arrays
+        else if(depth == 2 && inArrayVariable && nodeType == XML_READER_TYPE_ELEMENT) {
+          if(elementName != "value") {
+            throwParsingError(fileName, "Expected 'value' tag instead of: configuration");
+          }
+          if(!readAttribute("i", index)) {
+            throwParsingError(fileName, "Missing attribute 'index' for the 'value' tag.");
+          }
+          if(!readAttribute("v", value)) {
+            throwParsingError(fileName, "Missing attribute 'value' for the 'value' tag.");
+          }
+
+          size_t intIndex;
+          if(!parseValue(index, intIndex)) {
+            throwParsingError(fileName, "Cannot parse string '"+index+"' as an index number.");
+          }
+          if(!collector->set(intIndex, value)) {
+            throwParsingError(fileName, "Cannot parse value '"+value+"' of the variable '"+name+"' as type '"+
+                                        type+"'.");
+          }
+        }
+      }
+
+      if(status != 0) {
+        xmlErrorPtr error = xmlGetLastError();
+        std::string message = (error && error->message) ? error->message : "malformed XML";
+        while(!message.empty() && std::isspace(static_cast<unsigned char>(message.back()))) message.pop_back();
+        throw std::runtime_error("ConfigReader: Error opening the config file '"+fileName+"': "+message);
+      }
+      if(!rootFound) {
+        throwParsingError(fileName, "Expected 'configuration' tag.");
+      }
+    }
+
+    /** Variable prepared for writing into the compiled file */
+    struct CompiledVariable {
+      std::string name;
+      std::string type;
+      bool isArray;
+      uint32_t nElements;
+      std::string data;
+    };
+
+    /** Layout of the header and the entries of the compiled file (see ConfigReader class description) */
+    struct CompiledHeader {
+      char magic[8];
+      uint32_t formatVersion;
+      uint32_t reserved;
+      uint64_t contentHash;
+      uint64_t nEntries;
+      uint64_t fileSize;
+    };
+
+    struct CompiledEntry {
+      uint64_t nameOffset;
+      uint64_t typeOffset;
+      uint32_t nameLength;
+      uint32_t typeLength;
+      uint32_t isArray;
+      uint32_t nElements;
+      uint64_t dataOffset;
+      uint64_t dataSize;
+    };
+
+    static_assert(sizeof(CompiledHeader) == 40 && sizeof(CompiledEntry) == 48,
+                  "Unexpected padding in the layout of the compiled config file.");
+
+    /** Serialise the values of a variable for the compiled file. Numeric values are stored contiguously in their
+     *  binary representation, strings as uint32 length followed by the characters. Changes of this format require a
+     *  new ConfigReader::compiledFormatVersion. */
+    template<typename T>
+    void serialiseValues(std::string &data, const std::vector<T> &values) {
+      data.assign(reinterpret_cast<const char*>(values.data()), values.size()*sizeof(T));
+    }
+
+    template<>
+    void serialiseValues<std::string>(std::string &data, const std::vector<std::string> &values) {
+      data.clear();
+      for(auto &value : values) {
+        uint32_t length = value.size();
+        data.append(reinterpret_cast<const char*>(&length), sizeof(length));
+        data.append(value);
+      }
+    }
+
+    /** Deserialise the values of a variable from the compiled file into the given vector, which must already have the
+     *  right size. Returns false if the data does not match the size. */
+    template<typename T>
+    bool deserialiseValues(const char *data, size_t size, std::vector<T> &values) {
+      if(size != values.size()*sizeof(T)) return false;
+      std::memcpy(values.data(), data, size);
+      return true;
+    }
+
+    template<>
+    bool deserialiseValues<std::string>(const char *data, size_t size, std::vector<std::string> &values) {
+      const char *end = data+size;
+      for(auto &value : values) {
+        uint32_t length;
+        if(end-data < static_cast<std::ptrdiff_t>(sizeof(length))) return false;
+        std::memcpy(&length, data, sizeof(length));
+        data += sizeof(length);
+        if(end-data < static_cast<std::ptrdiff_t>(length)) return false;
+        value.assign(data, length);
+        data += length;
+      }
+      return data == end;
+    }
+
+    /** Read-only memory mapping of a whole file, unmapped on destruction */
+    struct FileMapping {
+      FileMapping(const std::string &fileName) {
+        int fd = open(fileName.c_str(), O_RDONLY);
+        if(fd < 0) return;
+        struct stat fileStatus;
+        if(fstat(fd, &fileStatus) == 0) {
+          size = fileStatus.st_size;
+          if(size == 0) {
+            opened = true;      // empty files cannot be mapped
+          }
+          else {
+            void *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(mapping != MAP_FAILED) {
+              data = static_cast<const char*>(mapping);
+              opened = true;
+            }
+          }
+        }
+        close(fd);
+      }
+
+      ~FileMapping() {
+        if(data) munmap(const_cast<char*>(data), size);
+      }
+
+      bool opened{false};
+      const char *data{nullptr};
+      size_t size{0};
+    };
+
+    /** File descriptor which is closed on destruction, also when the thread is interrupted */
+    struct FileDescriptor {
+      FileDescriptor(int fd) : fd(fd) {}
+      ~FileDescriptor() {
+        if(fd >= 0) close(fd);
+      }
+      int fd;
+    };
+
+  }
+
   /*********************************************************************************************************************/
 
   /** Functor to fill variableMap */
   struct FunctorFill {
-    FunctorFill(ConfigReader *owner, const std::string &type, const std::string &name, const std::string &value,
+    FunctorFill(ConfigReader *owner, const std::string &type, const std::string &name, ValueCollector &values,
                 bool &processed)
-    : _owner(owner), _type(type), _name(name), _value(value), _processed(processed)
+    : _owner(owner), _type(type), _name(name), _values(values), _processed(processed)
     {}
 
     template<typename PAIR>
@@ -22,12 +481,14 @@ namespace ChimeraTK {
       // skip this type, if not matching the type string in the config file
       if(_type != boost::fusion::at_key<T>(_owner->typeMap)) return;
 
-      _owner->createVar<T>(_name, _value);
+      // the values have been converted already while parsing
+      _owner->createVar<T>(_name, static_cast<TypedValueCollector<T>&>(_values).values[0]);
       _processed = true;
     }
 
     ConfigReader *_owner;
-    const std::string &_type, &_name, &_value;
+    const std::string &_type, &_name;
+    ValueCollector &_values;
     bool &_processed;   // must be a non-const reference, since we want to return this to the caller
 
     typedef boost::fusion::pair<std::string,ConfigReader::Var<std::string>> StringPair;
@@ -37,8 +498,8 @@ namespace ChimeraTK {
 
   /** Functor to fill variableMap for arrays */
   struct ArrayFunctorFill {
-    ArrayFunctorFill(ConfigReader *owner, const std::string &type, const std::string &name,
-                     const std::map<size_t, std::string> &values, bool &processed)
+    ArrayFunctorFill(ConfigReader *owner, const std::string &type, const std::string &name, ValueCollector &values,
+                     bool &processed)
     : _owner(owner), _type(type), _name(name), _values(values), _processed(processed)
     {}
 
@@ -51,13 +512,14 @@ namespace ChimeraTK {
       // skip this type, if not matching the type string in the config file
       if(_type != boost::fusion::at_key<T>(_owner->typeMap)) return;
 
-      _owner->createArray<T>(_name, _values);
+      // the vector filled while parsing is moved into the array without copying the values
+      _owner->createArray<T>(_name, std::move(static_cast<TypedValueCollector<T>&>(_values).values));
       _processed = true;
     }
 
     ConfigReader *_owner;
     const std::string &_type, &_name;
-    const std::map<size_t, std::string> &_values;
+    ValueCollector &_values;
     bool &_processed;   // must be a non-const reference, since we want to return this to the caller
 
     typedef boost::fusion::pair<std::string,ConfigReader::Var<std::string>> StringPair;
@@ -65,189 +527,257 @@ namespace ChimeraTK {
 
   /*********************************************************************************************************************/
 
-  template<typename T>
-  void ConfigReader::createVar(const std::string &name, const std::string &value) {
-    // convert value into user type
-    /// @todo error handling!
-    std::stringstream stream(value);
-    T convertedValue;
-    if(typeid(T) == typeid(int8_t) || typeid(T) == typeid(uint8_t)) {       // prevent interpreting int8-types as characters
-      int16_t intermediate;
-      stream >> intermediate;
-      convertedValue = intermediate;
-    }
-    else {      // note: string is done in template specialisation
-      stream >> convertedValue;
-    }
-
-    // place the variable onto the vector
-    std::map<std::string, ConfigReader::Var<T>> &theMap = boost::fusion::at_key<T>(variableMap.table);
-    theMap.emplace(std::make_pair(name, ConfigReader::Var<T>(this, name, convertedValue)));
-  }
-
-  /*********************************************************************************************************************/
-
-  template<>
-  void ConfigReader::createVar<std::string>(const std::string &name, const std::string &value) {
-    // place the variable onto the vector
-    std::map<std::string, ConfigReader::Var<std::string>> &theMap = boost::fusion::at_key<std::string>(variableMap.table);
-    theMap.emplace(std::make_pair(name, ConfigReader::Var<std::string>(this, name, value)));
-  }
-
-  /*********************************************************************************************************************/
+  /** Functor to fill variableMap and arrayMap from an entry of the compiled file */
+  struct FunctorFillCompiled {
+    FunctorFillCompiled(ConfigReader *owner, const std::string &type, const std::string &name, bool isArray,
+                        size_t nElements, const char *data, size_t dataSize, bool &processed)
+    : _owner(owner), _type(type), _name(name), _isArray(isArray), _nElements(nElements), _data(data),
+      _dataSize(dataSize), _processed(processed)
+    {}
 
-  /*********************************************************************************************************************/
+    template<typename PAIR>
+    void operator()(PAIR&) const {
 
-  template<typename T>
-  void ConfigReader::createArray(const std::string &name, const std::map<size_t, std::string> &values) {
-    std::vector<T> Tvalues;
+      // extract the user type from the pair
+      typedef typename PAIR::first_type T;
 
-    size_t expectedIndex = 0;
-    for(auto it = values.begin(); it != values.end(); ++it) {
+      // skip this type, if not matching the type string in the compiled file
+      if(_type != boost::fusion::at_key<T>(_owner->typeMap)) return;
 
-      // check index (std::map should be ordered by the index)
-      if(it->first != expectedIndex) {
-        parsingError("Array index "+std::to_string(expectedIndex)+" not found, but "+std::to_string(it->first)+" was. "
-                     "Sparse arrays are not supported!");
+      // numeric values are copied in one go
+      std::vector<T> values(_nElements);
+      if(!deserialiseValues(_data, _dataSize, values)) {
+        throw std::runtime_error("ConfigReader: Malformed value of the variable '"+_name+"' in the compiled config "
+                                 "file '"+_owner->_fileName+".bin'.");
       }
-      ++expectedIndex;
-
-      // convert value into user type
-      std::stringstream stream(it->second);
-      T convertedValue;
-      if(typeid(T) == typeid(int8_t) || typeid(T) == typeid(uint8_t)) {       // prevent interpreting int8-types as characters
-        int16_t intermediate;
-        stream >> intermediate;
-        convertedValue = intermediate;
+      if(_isArray) {
+        _owner->createArray<T>(_name, std::move(values));
       }
-      else {      // note: string is done in template specialisation
-        stream >> convertedValue;
+      else {
+        _owner->createVar<T>(_name, values[0]);
       }
-
-      // store value in vector
-      Tvalues.push_back(convertedValue);
-
+      _processed = true;
     }
 
-    // place the variable onto the vector
-    std::map<std::string, ConfigReader::Array<T>> &theMap = boost::fusion::at_key<T>(arrayMap.table);
-    theMap.emplace(std::make_pair(name, ConfigReader::Array<T>(this, name, Tvalues)));
-  }
+    ConfigReader *_owner;
+    const std::string &_type, &_name;
+    bool _isArray;
+    size_t _nElements;
+    const char *_data;
+    size_t _dataSize;
+    bool &_processed;   // must be a non-const reference, since we want to return this to the caller
+  };
 
   /*********************************************************************************************************************/
 
-  template<>
-  void ConfigReader::createArray<std::string>(const std::string &name, const std::map<size_t, std::string> &values) {
-    std::vector<std::string> Tvalues;
+  /** Functor to convert the values of a variable for the compiled file */
+  struct FunctorCompile {
+    FunctorCompile(const std::string &type, ValueCollector &values, CompiledVariable &variable, bool &processed)
+    : _type(type), _values(values), _variable(variable), _processed(processed)
+    {}
 
-    size_t expectedIndex = 0;
-    for(auto it = values.begin(); it != values.end(); ++it) {
+    template<typename PAIR>
+    void operator()(PAIR&) const {
 
-      // check index (std::map should be ordered by the index)
-      if(it->first != expectedIndex) {
-        parsingError("Array index "+std::to_string(expectedIndex)+" not found, but "+std::to_string(it->first)+" was. "
-                     "Sparse arrays are not supported!");
-      }
-      ++expectedIndex;
+      // extract the user type from the pair
+      typedef typename PAIR::first_type T;
 
-      // store value in vector
-      Tvalues.push_back(it->second);
+      // skip this type, if not matching the type string in the config file
+      if(_type != boost::fusion::at_key<T>(ConfigReader::typeMap)) return;
 
+      serialiseValues(_variable.data, static_cast<TypedValueCollector<T>&>(_values).values);
+      _processed = true;
     }
 
+    const std::string &_type;
+    ValueCollector &_values;
+    CompiledVariable &_variable;
+    bool &_processed;   // must be a non-const reference, since we want to return this to the caller
+  };
+
+  /*********************************************************************************************************************/
+
+  template<typename T>
+  void ConfigReader::createVar(const std::string &name, const T &value) {
+    // place the variable onto the vector
+    std::map<std::string, ConfigReader::Var<T>> &theMap = boost::fusion::at_key<T>(variableMap.table);
+    if(theMap.emplace(std::make_pair(name, ConfigReader::Var<T>(this, name, value))).second) ++_nVariables;
+  }
+
+  /*********************************************************************************************************************/
+
+  template<typename T>
+  void ConfigReader::createArray(const std::string &name, std::vector<T> values) {
     // place the variable onto the vector
-    std::map<std::string, ConfigReader::Array<std::string>> &theMap = boost::fusion::at_key<std::string>(arrayMap.table);
-    theMap.emplace(std::make_pair(name, ConfigReader::Array<std::string>(this, name, Tvalues)));
+    std::map<std::string, ConfigReader::Array<T>> &theMap = boost::fusion::at_key<T>(arrayMap.table);
+    if(theMap.emplace(std::make_pair(name, ConfigReader::Array<T>(this, name, std::move(values)))).second) {
+      ++_nVariables;
+    }
   }
 
   /*********************************************************************************************************************/
 
   ConfigReader::ConfigReader(EntityOwner *owner, const std::string &name, const std::string &fileName,
-                             const std::unordered_set<std::string> &tags)
+                             const std::unordered_set<std::string> &tags, bool strictConversion)
   : ApplicationModule(owner, name, "Configuration read from file '"+fileName+"'", false, tags),
-    _fileName(fileName)
+    _fileName(fileName), _strictConversion(strictConversion)
   {
-    // parse the file into a DOM structure
-    xmlpp::DomParser parser;
-    try {
-      parser.parse_file(fileName);
+    // use the compiled file if it is up to date
+    _loadedFromCompiledFile = loadCompiledFile();
+    if(_loadedFromCompiledFile) return;
+
+    parseConfigFile(fileName, _strictConversion, [this](const std::string &name, const std::string &type,
+                                                        ValueCollector &values, bool isArray) {
+      // create accessor and store value in map using the functor
+      bool processed{false};
+      if(!isArray) {
+        boost::fusion::for_each( variableMap.table, FunctorFill(this, type, name, values, processed) );
+      }
+      else {
+        boost::fusion::for_each( variableMap.table, ArrayFunctorFill(this, type, name, values, processed) );
+      }
+      if(!processed) parsingError("Incorrect value '"+type+"' for attribute 'type' of the 'variable' tag.");
+    });
+  }
+
+  /*********************************************************************************************************************/
+
+  uint64_t ConfigReader::contentHash(const std::string &fileName) {
+    FileMapping file(fileName);
+    if(!file.opened) {
+      throw std::runtime_error("ConfigReader: Error opening the config file '"+fileName+"'.");
     }
-    catch(xmlpp::exception &e) { /// @todo change exception!
-      throw std::runtime_error("ConfigReader: Error opening the config file '"+fileName+"': "+e.what());
+    uint64_t hash = 14695981039346656037ULL;
+    for(size_t i=0; i<file.size; ++i) {
+      hash ^= static_cast<unsigned char>(file.data[i]);
+      hash *= 1099511628211ULL;
     }
+    return hash;
+  }
 
-    // get root element
-    const auto root = parser.get_document()->get_root_node();
-    if(root->get_name() != "configuration") {
-      parsingError("Expected 'configuration' tag instead of: "+root->get_name());
-    }
+  /*********************************************************************************************************************/
 
-    // parsing loop
-    for(const auto& child : root->get_children()) {
-      // cast into element, ignore if not an element (e.g. comment)
-      const xmlpp::Element *element = dynamic_cast<const xmlpp::Element*>(child);
-      if(!element) continue;
-      if(element->get_name() != "variable") {
-        parsingError("Expected 'variable' tag instead of: "+root->get_name());
+  void ConfigReader::compile(const std::string &fileName, const std::string &compiledFileName,
+                             bool strictConversion) {
+    std::string outputName = compiledFileName.empty() ? fileName+".bin" : compiledFileName;
+
+    // parse the XML file and convert the values
+    std::vector<CompiledVariable> variables;
+    mtca4u::SingleTypeUserTypeMap<bool> userTypes;
+    parseConfigFile(fileName, strictConversion, [&](const std::string &name, const std::string &type,
+                                                    ValueCollector &values, bool isArray) {
+      variables.push_back({name, type, isArray, static_cast<uint32_t>(values.size()), {}});
+      bool processed{false};
+      boost::fusion::for_each( userTypes, FunctorCompile(type, values, variables.back(), processed) );
+      if(!processed) {
+        throwParsingError(fileName, "Incorrect value '"+type+"' for attribute 'type' of the 'variable' tag.");
       }
-
-      // obtain attributes from the element
-      auto name = element->get_attribute("name");
-      if(!name) parsingError("Missing attribute 'name' for the 'variable' tag.");
-      auto type = element->get_attribute("type");
-      if(!type) parsingError("Missing attribute 'type' for the 'variable' tag.");
-
-      // scalar value: obtain value from attribute
-      auto value = element->get_attribute("value");
-      if(value) {
-        // create accessor and store value in map using the functor
-        bool processed{false};
-        boost::fusion::for_each( variableMap.table,
-                                 FunctorFill(this, type->get_value(), name->get_value(), value->get_value(), processed) );
-        if(!processed) parsingError("Incorrect value '"+type->get_value()+"' for attribute 'type' of the 'variable' tag.");
+    });
+
+    // compute the layout of the file
+    CompiledHeader header;
+    std::memcpy(header.magic, compiledMagic, sizeof(header.magic));
+    header.formatVersion = compiledFormatVersion;
+    header.reserved = 0;
+    header.contentHash = contentHash(fileName);
+    header.nEntries = variables.size();
+    uint64_t offset = sizeof(CompiledHeader) + variables.size()*sizeof(CompiledEntry);
+    std::vector<CompiledEntry> entries(variables.size());
+    for(size_t i=0; i<variables.size(); ++i) {
+      entries[i].nameOffset = offset;
+      entries[i].nameLength = variables[i].name.size();
+      offset += variables[i].name.size();
+      entries[i].typeOffset = offset;
+      entries[i].typeLength = variables[i].type.size();
+      offset += variables[i].type.size();
+    }
+    for(size_t i=0; i<variables.size(); ++i) {
+      offset = (offset+7) & ~uint64_t(7);
+      entries[i].isArray = variables[i].isArray;
+      entries[i].nElements = variables[i].nElements;
+      entries[i].dataOffset = offset;
+      entries[i].dataSize = variables[i].data.size();
+      offset += variables[i].data.size();
+    }
+    header.fileSize = offset;
+
+    // write into a temporary file and rename it, so the ConfigReader never sees an incomplete file
+    std::string temporaryName = outputName+".tmp";
+    {
+      std::ofstream file(temporaryName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+      if(!file) throw std::runtime_error("ConfigReader: Cannot open file '"+temporaryName+"' for writing.");
+      file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+      file.write(reinterpret_cast<const char*>(entries.data()), entries.size()*sizeof(CompiledEntry));
+      for(auto &variable : variables) {
+        file.write(variable.name.data(), variable.name.size());
+        file.write(variable.type.data(), variable.type.size());
       }
-      // array value: obtain values from child elements
-      else {
-        bool valueFound = false;
-        std::map<size_t, std::string> values;
-        for(const auto& valueChild : child->get_children()) {
-
-          // obtain value child element and extract index and value from attributes
-          const xmlpp::Element *valueElement = dynamic_cast<const xmlpp::Element*>(valueChild);
-          if(!valueElement) continue;                    // ignore comments etc.
-          if(valueElement->get_name() != "value") {
-            parsingError("Expected 'value' tag instead of: "+root->get_name());
-          }
-          valueFound = true;
-          auto index = valueElement->get_attribute("i");
-          if(!index) parsingError("Missing attribute 'index' for the 'value' tag.");
-          auto value = valueElement->get_attribute("v");
-          if(!value) parsingError("Missing attribute 'value' for the 'value' tag.");
-
-          // get index as number and store value as a string
-          size_t intIndex;
-          try {
-            intIndex = std::stoi(index->get_value());
-          }
-          catch(std::exception &e) {
-            parsingError("Cannot parse string '"+std::string(index->get_value())+"' as an index number: "+e.what());
-          }
-          values[intIndex] = value->get_value();
+      const char padding[8] = {0};
+      for(size_t i=0; i<variables.size(); ++i) {
+        file.write(padding, entries[i].dataOffset - file.tellp());
+        file.write(variables[i].data.data(), variables[i].data.size());
+      }
+      if(!file) throw std::runtime_error("ConfigReader: Error writing the file '"+temporaryName+"'.");
+    }
+    if(std::rename(temporaryName.c_str(), outputName.c_str()) != 0) {
+      throw std::runtime_error("ConfigReader: Cannot rename '"+temporaryName+"' into '"+outputName+"'.");
+    }
+  }
 
-        }
+  /*********************************************************************************************************************/
 
-        // make sure there is at least one value
-        if(!valueFound) {
-          parsingError("Each variable must have a value, either specified as an attribute or as child tags.");
-        }
+  bool ConfigReader::loadCompiledFile() {
+    std::string compiledFileName = _fileName+".bin";
+    FileMapping file(compiledFileName);
+    if(!file.opened) return false;
+
+    // check the header and whether the file has been compiled from the current XML file
+    CompiledHeader header;
+    if(file.size < sizeof(header)) return false;
+    std::memcpy(&header, file.data, sizeof(header));
+    if(std::memcmp(header.magic, compiledMagic, sizeof(header.magic)) != 0) {
+      std::cerr << "ConfigReader: Ignoring malformed compiled config file '" << compiledFileName << "'." << std::endl;
+      return false;
+    }
+    // the remaining layout depends on the format version
+    if(header.formatVersion != compiledFormatVersion) {
+      std::cerr << "ConfigReader: Ignoring compiled config file '" << compiledFileName << "' of format version "
+                << header.formatVersion << ", please compile it again." << std::endl;
+      return false;
+    }
+    if(header.fileSize != file.size || header.nEntries > (file.size-sizeof(header))/sizeof(CompiledEntry)) {
+      std::cerr << "ConfigReader: Ignoring malformed compiled config file '" << compiledFileName << "'." << std::endl;
+      return false;
+    }
+    if(header.contentHash != contentHash(_fileName)) return false;
+
+    // check all entries before creating any variables
+    const CompiledEntry *entries = reinterpret_cast<const CompiledEntry*>(file.data+sizeof(header));
+    auto inFile = [&file](uint64_t offset, uint64_t size) { return offset <= file.size && size <= file.size-offset; };
+    for(size_t i=0; i<header.nEntries; ++i) {
+      auto &entry = entries[i];
+      if(!inFile(entry.nameOffset, entry.nameLength) || !inFile(entry.typeOffset, entry.typeLength) ||
+         !inFile(entry.dataOffset, entry.dataSize) || entry.nElements == 0) {
+        std::cerr << "ConfigReader: Ignoring malformed compiled config file '" << compiledFileName << "'." << std::endl;
+        return false;
+      }
+    }
 
-        // create accessor and store array value in map using functor
-        bool processed{false};
-        boost::fusion::for_each( variableMap.table,
-                                 ArrayFunctorFill(this, type->get_value(), name->get_value(), values, processed) );
-        if(!processed) parsingError("Incorrect value '"+type->get_value()+"' for attribute 'type' of the 'variable' tag.");
+    // create the variables
+    for(size_t i=0; i<header.nEntries; ++i) {
+      auto &entry = entries[i];
+      std::string name(file.data+entry.nameOffset, entry.nameLength);
+      std::string type(file.data+entry.typeOffset, entry.typeLength);
+      bool processed{false};
+      boost::fusion::for_each( variableMap.table, FunctorFillCompiled(this, type, name, entry.isArray, entry.nElements,
+                                                                      file.data+entry.dataOffset, entry.dataSize,
+                                                                      processed) );
+      if(!processed) {
+        throw std::runtime_error("ConfigReader: Unknown type '"+type+"' in the compiled config file '"+
+                                 compiledFileName+"'.");
       }
     }
+    return true;
   }
 
   /********************************************************************************************************************/
@@ -308,6 +838,151 @@ namespace ChimeraTK {
 
   /*********************************************************************************************************************/
 
+  /** Functor to compare a variable from the changed config file with the current value. If the value has changed, an
+   *  update is added to the list, which sets the new value and writes the accessor. */
+  struct FunctorReload {
+    typedef std::vector<std::function<void(const ChimeraTK::VersionNumber&)>> UpdateList;
+
+    FunctorReload(ConfigReader *owner, const std::string &type, const std::string &name, ValueCollector &values,
+                  bool isArray, UpdateList &updates, bool &processed)
+    : _owner(owner), _type(type), _name(name), _values(values), _isArray(isArray), _updates(updates),
+      _processed(processed)
+    {}
+
+    template<typename PAIR>
+    void operator()(PAIR&) const {
+
+      // extract the user type from the pair
+      typedef typename PAIR::first_type T;
+
+      // skip this type, if not matching the type string in the config file
+      if(_type != boost::fusion::at_key<T>(_owner->typeMap)) return;
+      _processed = true;
+
+      auto &values = static_cast<TypedValueCollector<T>&>(_values).values;
+      if(!_isArray) {
+        std::map<std::string, ConfigReader::Var<T>> &theMap = boost::fusion::at_key<T>(_owner->variableMap.table);
+        auto var = theMap.find(_name);
+        if(var == theMap.end()) {
+          _owner->parsingError("The scalar variable '"+_name+"' of type '"+_type+"' did not exist before.");
+        }
+        if(var->second._value == values[0]) return;
+        ConfigReader::Var<T> *target = &(var->second);
+        T value = values[0];
+        _updates.push_back([target, value](const ChimeraTK::VersionNumber &version) {
+          target->_value = value;
+          target->_accessor = value;
+          target->_accessor.write(version);
+        });
+      }
+      else {
+        std::map<std::string, ConfigReader::Array<T>> &theMap = boost::fusion::at_key<T>(_owner->arrayMap.table);
+        auto var = theMap.find(_name);
+        if(var == theMap.end()) {
+          _owner->parsingError("The array '"+_name+"' of type '"+_type+"' did not exist before.");
+        }
+        if(var->second._value.size() != values.size()) {
+          _owner->parsingError("The length of the array '"+_name+"' cannot be changed.");
+        }
+        if(var->second._value == values) return;
+        ConfigReader::Array<T> *target = &(var->second);
+        // C++11 lambdas cannot capture by move, so the vector is moved into a shared_ptr
+        auto value = std::make_shared<std::vector<T>>(std::move(values));
+        _updates.push_back([target, value](const ChimeraTK::VersionNumber &version) {
+          target->_value.swap(*value);
+          target->_accessor = target->_value;
+          target->_accessor.write(version);
+        });
+      }
+    }
+
+    ConfigReader *_owner;
+    const std::string &_type, &_name;
+    ValueCollector &_values;
+    bool _isArray;
+    UpdateList &_updates;
+    bool &_processed;   // must be a non-const reference, since we want to return this to the caller
+  };
+
+  /*********************************************************************************************************************/
+
+  void ConfigReader::reload() {
+    // compare the whole file first, so nothing is sent if the file is not valid
+    FunctorReload::UpdateList updates;
+    try {
+      std::set<std::string> names;
+      parseConfigFile(_fileName, _strictConversion, [&](const std::string &name, const std::string &type,
+                                                        ValueCollector &values, bool isArray) {
+        bool processed{false};
+        boost::fusion::for_each( variableMap.table,
+                                 FunctorReload(this, type, name, values, isArray, updates, processed) );
+        if(!processed) parsingError("Incorrect value '"+type+"' for attribute 'type' of the 'variable' tag.");
+        names.insert(name);
+      });
+      if(names.size() != _nVariables) {
+        parsingError("Variables cannot be removed at runtime.");
+      }
+    }
+    catch(std::runtime_error &e) {
+      std::cerr << e.what() << " The changed config file is ignored." << std::endl;
+      return;
+    }
+
+    // send all changed values with the same version number
+    ChimeraTK::VersionNumber version;
+    for(auto &update : updates) update(version);
+  }
+
+  /*********************************************************************************************************************/
+
+  void ConfigReader::mainLoop() {
+    if(!_liveReload) return;
+
+    // watch the directory instead of the file, since editors usually replace the file by renaming a new file
+    std::string directory = ".", baseName = _fileName;
+    auto slash = _fileName.rfind('/');
+    if(slash != std::string::npos) {
+      directory = slash > 0 ? _fileName.substr(0, slash) : "/";
+      baseName = _fileName.substr(slash+1);
+    }
+    FileDescriptor inotify(inotify_init1(IN_NONBLOCK | IN_CLOEXEC));
+    if(inotify.fd < 0 || inotify_add_watch(inotify.fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+      std::cerr << "ConfigReader: Cannot watch the config file '" << _fileName << "' for changes." << std::endl;
+      return;
+    }
+
+    // the file might have been changed before the watch was added
+    reload();
+
+    // the testable mode lock is only held while sending the values, not while waiting for changes
+    Application::testableModeUnlock("waitConfigFileChange");
+    alignas(struct inotify_event) char buffer[4096];
+    while(true) {
+      // wait for events with a timeout, since poll() is not an interruption point
+      struct pollfd pollRequest{inotify.fd, POLLIN, 0};
+      int nEvents = poll(&pollRequest, 1, 100);
+      boost::this_thread::interruption_point();
+      if(nEvents <= 0) continue;
+
+      // read all pending events, a single save operation usually results in several events
+      bool changed = false;
+      ssize_t length;
+      while((length = ::read(inotify.fd, buffer, sizeof(buffer))) > 0) {
+        for(char *position = buffer; position < buffer+length; ) {
+          auto *event = reinterpret_cast<struct inotify_event*>(position);
+          if(event->len > 0 && baseName == event->name) changed = true;
+          position += sizeof(struct inotify_event) + event->len;
+        }
+      }
+      if(!changed) continue;
+      Application::testableModeLock("configFileChanged");
+      reload();
+      Application::testableModeUnlock("waitConfigFileChange");
+    }
+  }
+
+  /*********************************************************************************************************************/
+
   void ConfigReader::prepare() {
     boost::fusion::for_each( variableMap.table, FunctorSetValues(this) );
     boost::fusion::for_each( arrayMap.table, FunctorSetValuesArray(this) );
@@ -0,0 +1,380 @@
+/*
+ * ElementwiseKernels.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <cstring>
+
+#include "ElementwiseKernels.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CHIMERATK_ELEMENTWISE_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+namespace ChimeraTK {
+  namespace ElementwiseKernels {
+
+    /*****************************************************************************************************************/
+
+    InstructionSet getSupportedInstructionSet() {
+#ifdef CHIMERATK_ELEMENTWISE_KERNELS_X86
+      __builtin_cpu_init();
+      if(__builtin_cpu_supports("avx2")) return InstructionSet::avx2;
+      if(__builtin_cpu_supports("sse4.1")) return InstructionSet::sse41;
+#endif
+      return InstructionSet::scalar;
+    }
+
+    namespace {
+      InstructionSet selectedInstructionSet = getSupportedInstructionSet();
+    }
+
+    InstructionSet getInstructionSet() {
+      return selectedInstructionSet;
+    }
+
+    void setInstructionSet(InstructionSet set) {
+      InstructionSet supported = getSupportedInstructionSet();
+      selectedInstructionSet = static_cast<int>(set) <= static_cast<int>(supported) ? set : supported;
+    }
+
+    /*****************************************************************************************************************/
+
+#ifdef CHIMERATK_ELEMENTWISE_KERNELS_X86
+    namespace {
+
+#define SSE41 __attribute__((target("sse4.1")))
+#define AVX2 __attribute__((target("avx2")))
+
+      /** Conversion of 2 values of the given type from/to __m128d. The integral stores expect integral values in the
+       *  range of the target type (as the conversion in the plain loop would). */
+      template<typename T>
+      struct Sse41;
+
+      template<>
+      struct Sse41<double> {
+        SSE41 static __m128d load(const double *p) { return _mm_loadu_pd(p); }
+        SSE41 static void store(double *p, __m128d v) { _mm_storeu_pd(p, v); }
+      };
+
+      template<>
+      struct Sse41<float> {
+        SSE41 static __m128d load(const float *p) {
+          return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));
+        }
+        SSE41 static void store(float *p, __m128d v) {
+          _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_castps_si128(_mm_cvtpd_ps(v)));
+        }
+      };
+
+      template<>
+      struct Sse41<int32_t> {
+        SSE41 static __m128d load(const int32_t *p) {
+          return _mm_cvtepi32_pd(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+        }
+        SSE41 static void store(int32_t *p, __m128d v) {
+          _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_cvttpd_epi32(v));
+        }
+      };
+
+      template<>
+      struct Sse41<uint32_t> {
+        // shift the values into the signed range, since there is no unsigned conversion instruction
+        SSE41 static __m128d load(const uint32_t *p) {
+          __m128i v = _mm_xor_si128(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)), _mm_set1_epi32(INT32_MIN));
+          return _mm_add_pd(_mm_cvtepi32_pd(v), _mm_set1_pd(2147483648.));
+        }
+        SSE41 static void store(uint32_t *p, __m128d v) {
+          __m128i i = _mm_cvttpd_epi32(_mm_sub_pd(v, _mm_set1_pd(2147483648.)));
+          _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_xor_si128(i, _mm_set1_epi32(INT32_MIN)));
+        }
+      };
+
+      template<typename T>
+      struct Sse41Int16 {
+        SSE41 static void store(T *p, __m128d v) {
+          __m128i i = _mm_shuffle_epi8(_mm_cvttpd_epi32(v),
+                                       _mm_setr_epi8(0,1,4,5,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1));
+          int32_t packed = _mm_cvtsi128_si32(i);
+          std::memcpy(p, &packed, sizeof(packed));
+        }
+      };
+
+      template<>
+      struct Sse41<int16_t> : Sse41Int16<int16_t> {
+        SSE41 static __m128d load(const int16_t *p) {
+          int32_t packed;
+          std::memcpy(&packed, p, sizeof(packed));
+          return _mm_cvtepi32_pd(_mm_cvtepi16_epi32(_mm_cvtsi32_si128(packed)));
+        }
+      };
+
+      template<>
+      struct Sse41<uint16_t> : Sse41Int16<uint16_t> {
+        SSE41 static __m128d load(const uint16_t *p) {
+          int32_t packed;
+          std::memcpy(&packed, p, sizeof(packed));
+          return _mm_cvtepi32_pd(_mm_cvtepu16_epi32(_mm_cvtsi32_si128(packed)));
+        }
+      };
+
+      template<typename T>
+      struct Sse41Int8 {
+        SSE41 static void store(T *p, __m128d v) {
+          __m128i i = _mm_shuffle_epi8(_mm_cvttpd_epi32(v),
+                                       _mm_setr_epi8(0,4,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1));
+          uint16_t packed = static_cast<uint16_t>(_mm_cvtsi128_si32(i));
+          std::memcpy(p, &packed, sizeof(packed));
+        }
+      };
+
+      template<>
+      struct Sse41<int8_t> : Sse41Int8<int8_t> {
+        SSE41 static __m128d load(const int8_t *p) {
+          uint16_t packed;
+          std::memcpy(&packed, p, sizeof(packed));
+          return _mm_cvtepi32_pd(_mm_cvtepi8_epi32(_mm_cvtsi32_si128(packed)));
+        }
+      };
+
+      template<>
+      struct Sse41<uint8_t> : Sse41Int8<uint8_t> {
+        SSE41 static __m128d load(const uint8_t *p) {
+          uint16_t packed;
+          std::memcpy(&packed, p, sizeof(packed));
+          return _mm_cvtepi32_pd(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed)));
+        }
+      };
+
+      /** Round half away from zero like std::round(): truncate and correct by one if the fraction is >= 0.5. The
+       *  fraction x - trunc(x) is always exact, so the result is identical to std::round(). */
+      SSE41 inline __m128d roundSse41(__m128d x) {
+        const __m128d signMask = _mm_set1_pd(-0.);
+        __m128d truncated = _mm_round_pd(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        __m128d fraction = _mm_andnot_pd(signMask, _mm_sub_pd(x, truncated));
+        __m128d needsCorrection = _mm_cmpge_pd(fraction, _mm_set1_pd(0.5));
+        __m128d correction = _mm_or_pd(_mm_set1_pd(1.), _mm_and_pd(signMask, x));
+        return _mm_add_pd(truncated, _mm_and_pd(needsCorrection, correction));
+      }
+
+      /** SSE4.1 kernel. Returns the number of processed elements, the remaining ones must be processed by the caller. */
+      template<typename InputType, typename OutputType, bool DIVIDE>
+      SSE41 size_t kernelSse41(const InputType *input, OutputType *output, size_t n, double parameter) {
+        const __m128d p = _mm_set1_pd(parameter);
+        size_t i = 0;
+        if(std::numeric_limits<OutputType>::is_integer) {
+          for(; i+2 <= n; i += 2) {
+            __m128d v = Sse41<InputType>::load(input+i);
+            v = DIVIDE ? _mm_div_pd(v, p) : _mm_mul_pd(v, p);
+            Sse41<OutputType>::store(output+i, roundSse41(v));
+          }
+        }
+        else {
+          for(; i+2 <= n; i += 2) {
+            __m128d v = Sse41<InputType>::load(input+i);
+            v = DIVIDE ? _mm_div_pd(v, p) : _mm_mul_pd(v, p);
+            Sse41<OutputType>::store(output+i, v);
+          }
+        }
+        return i;
+      }
+
+      /***************************************************************************************************************/
+
+      /** Conversion of 4 values of the given type from/to __m256d, see Sse41 */
+      template<typename T>
+      struct Avx2;
+
+      template<>
+      struct Avx2<double> {
+        AVX2 static __m256d load(const double *p) { return _mm256_loadu_pd(p); }
+        AVX2 static void store(double *p, __m256d v) { _mm256_storeu_pd(p, v); }
+      };
+
+      template<>
+      struct Avx2<float> {
+        AVX2 static __m256d load(const float *p) { return _mm256_cvtps_pd(_mm_loadu_ps(p)); }
+        AVX2 static void store(float *p, __m256d v) { _mm_storeu_ps(p, _mm256_cvtpd_ps(v)); }
+      };
+
+      template<>
+      struct Avx2<int32_t> {
+        AVX2 static __m256d load(const int32_t *p) {
+          return _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+        }
+        AVX2 static void store(int32_t *p, __m256d v) {
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm256_cvttpd_epi32(v));
+        }
+      };
+
+      template<>
+      struct Avx2<uint32_t> {
+        AVX2 static __m256d load(const uint32_t *p) {
+          __m128i v = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), _mm_set1_epi32(INT32_MIN));
+          return _mm256_add_pd(_mm256_cvtepi32_pd(v), _mm256_set1_pd(2147483648.));
+        }
+        AVX2 static void store(uint32_t *p, __m256d v) {
+          __m128i i = _mm256_cvttpd_epi32(_mm256_sub_pd(v, _mm256_set1_pd(2147483648.)));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm_xor_si128(i, _mm_set1_epi32(INT32_MIN)));
+        }
+      };
+
+      template<typename T>
+      struct Avx2Int16 {
+        AVX2 static void store(T *p, __m256d v) {
+          __m128i i = _mm_shuffle_epi8(_mm256_cvttpd_epi32(v),
+                                       _mm_setr_epi8(0,1,4,5,8,9,12,13,-1,-1,-1,-1,-1,-1,-1,-1));
+          _mm_storel_epi64(reinterpret_cast<__m128i*>(p), i);
+        }
+      };
+
+      template<>
+      struct Avx2<int16_t> : Avx2Int16<int16_t> {
+        AVX2 static __m256d load(const int16_t *p) {
+          return _mm256_cvtepi32_pd(_mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));
+        }
+      };
+
+      template<>
+      struct Avx2<uint16_t> : Avx2Int16<uint16_t> {
+        AVX2 static __m256d load(const uint16_t *p) {
+          return _mm256_cvtepi32_pd(_mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));
+        }
+      };
+
+      template<typename T>
+      struct Avx2Int8 {
+        AVX2 static void store(T *p, __m256d v) {
+          __m128i i = _mm_shuffle_epi8(_mm256_cvttpd_epi32(v),
+                                       _mm_setr_epi8(0,4,8,12,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1));
+          int32_t packed = _mm_cvtsi128_si32(i);
+          std::memcpy(p, &packed, sizeof(packed));
+        }
+      };
+
+      template<>
+      struct Avx2<int8_t> : Avx2Int8<int8_t> {
+        AVX2 static __m256d load(const int8_t *p) {
+          int32_t packed;
+          std::memcpy(&packed, p, sizeof(packed));
+          return _mm256_cvtepi32_pd(_mm_cvtepi8_epi32(_mm_cvtsi32_si128(packed)));
+        }
+      };
+
+      template<>
+      struct Avx2<uint8_t> : Avx2Int8<uint8_t> {
+        AVX2 static __m256d load(const uint8_t *p) {
+          int32_t packed;
+          std::memcpy(&packed, p, sizeof(packed));
+          return _mm256_cvtepi32_pd(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed)));
+        }
+      };
+
+      /** See roundSse41() */
+      AVX2 inline __m256d roundAvx2(__m256d x) {
+        const __m256d signMask = _mm256_set1_pd(-0.);
+        __m256d truncated = _mm256_round_pd(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        __m256d fraction = _mm256_andnot_pd(signMask, _mm256_sub_pd(x, truncated));
+        __m256d needsCorrection = _mm256_cmp_pd(fraction, _mm256_set1_pd(0.5), _CMP_GE_OQ);
+        __m256d correction = _mm256_or_pd(_mm256_set1_pd(1.), _mm256_and_pd(signMask, x));
+        return _mm256_add_pd(truncated, _mm256_and_pd(needsCorrection, correction));
+      }
+
+      /** AVX2 kernel, see kernelSse41() */
+      template<typename InputType, typename OutputType, bool DIVIDE>
+      AVX2 size_t kernelAvx2(const InputType *input, OutputType *output, size_t n, double parameter) {
+        const __m256d p = _mm256_set1_pd(parameter);
+        size_t i = 0;
+        if(std::numeric_limits<OutputType>::is_integer) {
+          for(; i+4 <= n; i += 4) {
+            __m256d v = Avx2<InputType>::load(input+i);
+            v = DIVIDE ? _mm256_div_pd(v, p) : _mm256_mul_pd(v, p);
+            Avx2<OutputType>::store(output+i, roundAvx2(v));
+          }
+        }
+        else {
+          for(; i+4 <= n; i += 4) {
+            __m256d v = Avx2<InputType>::load(input+i);
+            v = DIVIDE ? _mm256_div_pd(v, p) : _mm256_mul_pd(v, p);
+            Avx2<OutputType>::store(output+i, v);
+          }
+        }
+        return i;
+      }
+
+#undef SSE41
+#undef AVX2
+
+    } /* anonymous namespace */
+#endif /* CHIMERATK_ELEMENTWISE_KERNELS_X86 */
+
+    /*****************************************************************************************************************/
+
+    namespace {
+
+      /** Dispatch to the selected kernel and process the remaining elements with the plain loop */
+      template<typename InputType, typename OutputType, bool DIVIDE>
+      void dispatch(const InputType *input, OutputType *output, size_t n, double parameter) {
+        size_t done = 0;
+#ifdef CHIMERATK_ELEMENTWISE_KERNELS_X86
+        if(selectedInstructionSet == InstructionSet::avx2) {
+          done = kernelAvx2<InputType, OutputType, DIVIDE>(input, output, n, parameter);
+        }
+        else if(selectedInstructionSet == InstructionSet::sse41) {
+          done = kernelSse41<InputType, OutputType, DIVIDE>(input, output, n, parameter);
+        }
+#endif
+        if(DIVIDE) {
+          detail::divideScalar(input+done, output+done, n-done, parameter);
+        }
+        else {
+          detail::multiplyScalar(input+done, output+done, n-done, parameter);
+        }
+      }
+
+    } /* anonymous namespace */
+
+    namespace detail {
+
+      template<typename InputType, typename OutputType>
+      void multiplyVectorised(const InputType *input, OutputType *output, size_t n, double factor) {
+        dispatch<InputType, OutputType, false>(input, output, n, factor);
+      }
+
+      template<typename InputType, typename OutputType>
+      void divideVectorised(const InputType *input, OutputType *output, size_t n, double divider) {
+        dispatch<InputType, OutputType, true>(input, output, n, divider);
+      }
+
+#define INSTANTIATE_KERNELS(InputType, OutputType)                                                                    \
+      template void multiplyVectorised<InputType, OutputType>(const InputType*, OutputType*, size_t, double);         \
+      template void divideVectorised<InputType, OutputType>(const InputType*, OutputType*, size_t, double);
+
+#define INSTANTIATE_KERNELS_FOR_INPUT(InputType)                                                                      \
+      INSTANTIATE_KERNELS(InputType, int8_t)                                                                          \
+      INSTANTIATE_KERNELS(InputType, uint8_t)                                                                         \
+      INSTANTIATE_KERNELS(InputType, int16_t)                                                                         \
+      INSTANTIATE_KERNELS(InputType, uint16_t)                                                                        \
+      INSTANTIATE_KERNELS(InputType, int32_t)                                                                         \
+      INSTANTIATE_KERNELS(InputType, uint32_t)                                                                        \
+      INSTANTIATE_KERNELS(InputType, float)                                                                           \
+      INSTANTIATE_KERNELS(InputType, double)
+
+      INSTANTIATE_KERNELS_FOR_INPUT(int8_t)
+      INSTANTIATE_KERNELS_FOR_INPUT(uint8_t)
+      INSTANTIATE_KERNELS_FOR_INPUT(int16_t)
+      INSTANTIATE_KERNELS_FOR_INPUT(uint16_t)
+      INSTANTIATE_KERNELS_FOR_INPUT(int32_t)
+      INSTANTIATE_KERNELS_FOR_INPUT(uint32_t)
+      INSTANTIATE_KERNELS_FOR_INPUT(float)
+      INSTANTIATE_KERNELS_FOR_INPUT(double)
+
+#undef INSTANTIATE_KERNELS_FOR_INPUT
+#undef INSTANTIATE_KERNELS
+
+    } /* namespace detail */
+
+  } /* namespace ElementwiseKernels */
+} /* namespace ChimeraTK */
@@ -35,9 +35,9 @@ namespace ChimeraTK {
 
   void MicroDAQ::addSource(const Module &source, const std::string &namePrefix) {
     
-    // for simplification, first create a VirtualModule containing the correct hierarchy structure (obeying eliminate
-    // hierarchy etc.)
-    auto dynamicModel = source.findTag(".*");     /// @todo use virtualise() instead
+    // for simplification, first obtain a VirtualModule containing the correct hierarchy structure (obeying eliminate
+    // hierarchy etc.). The virtualised module is cached, so the tree is not rebuilt on each level of the recursion.
+    auto &dynamicModel = source.virtualise();
     
     // add all accessors on this hierarchy level
     for(auto &acc : dynamicModel.getAccessorList()) {
@@ -72,7 +72,8 @@ struct ExampleApp : public ctk::Application {
     ~ExampleApp() { shutdown(); }
 
     Automation automation{this, "automation", "..."};
-    TableGeneration tableGeneration{this, "tableGeneration", "..."};
+    // both tables are written in each cycle, so write them to the device in one go
+    TableGeneration tableGeneration{this, "tableGeneration", "...", false, {"batchDeviceWrites"}};
     ctk::DeviceModule dev{"Device"};
     ctk::DeviceModule timer{"Timer"};
     ctk::ControlSystemModule cs{"MyLocation"};
@@ -10,6 +10,10 @@
 
 #include <mutex>
 #include <atomic>
+#include <map>
+#include <typeindex>
+#include <chrono>
+#include <functional>
 
 #include <mtca4u/DeviceBackend.h>
 #include <ChimeraTK/ControlSystemAdapter/ApplicationBase.h>
@@ -28,6 +32,12 @@ namespace ChimeraTK {
   class VariableNetwork;
   class TriggerFanOut;
   class TestFacility;
+  class VariableRecorder;
+  class PersistenceManager;
+  class SharedMemoryPublisher;
+  class StatisticsModule;
+  class DeviceWriteBatch;
+  struct PollCacheEntryBase;
 
   template<typename UserType>
   class Accessor;
@@ -67,6 +77,12 @@ namespace ChimeraTK {
        *  makeConnections() has been called. */
       void dumpConnections();
 
+      /** Output the statistics of the updates of all variable networks (see NetworkStatistics) to the given stream.
+       *  This may only be done after makeConnections() has been called. The update rate is averaged over the time
+       *  since the previous aggregation of the statistics, which is also done periodically by the StatisticsModule if
+       *  enabled. */
+      void dumpStatistics(std::ostream &stream = std::cout);
+
       /** Create Graphviz dot graph and write to file. The graph will contain the connections made in the initilise()
        * function. @see dumpConnections */
       void dumpConnectionGraph(const std::string &filename = {"connections-graph.dot"});
@@ -102,8 +118,9 @@ namespace ChimeraTK {
 
       /** This is a testable version of mtca4u::TransferElement::readAny(). Always use this version instead of the
        *  original version provided by DeviceAccess. If the testable mode is not enabled, just the original version
-       *  is called instead. Only with the testable mode enabled, special precautions are taken to make this blocking
-       *  call testable. */
+       *  is called instead, after spinning according to the WaitPolicy of the calling thread (see
+       *  WaitPolicy::currentThread()). Only with the testable mode enabled, special precautions are taken to make this
+       *  blocking call testable. */
       static mtca4u::TransferElementID readAny(std::list<std::reference_wrapper<TransferElementAbstractor>> elementsToRead);
       static mtca4u::TransferElementID readAny(std::list<std::reference_wrapper<TransferElement>> elementsToRead);
 
@@ -160,6 +177,99 @@ namespace ChimeraTK {
         debugMode_variableList.insert(node.getUniqueId());
       }
 
+      /** Record all control system and device inputs together with their VersionNumbers and time stamps into the
+       *  given binary file. The control system outputs are recorded as well, so the recording can later be replayed
+       *  with the VariableReplayer and the outputs of the application can be compared against the recorded ones.
+       *
+       *  This function must be called before the application is initialised (i.e. before the call to initialise()). */
+      void enableVariableRecording(const std::string &fileName);
+
+      /** Enable the persistence of the application state for a fast warm restart (see PersistenceManager). The values
+       *  of all control system variables are written periodically into a snapshot in the given file. If the file
+       *  exists already, the values of the control system inputs are restored from it before the modules start, so
+       *  the application continues with the settings it had when it was stopped.
+       *
+       *  This function must be called before the application is initialised (i.e. before the call to initialise()). */
+      void enablePersistence(const std::string &fileName,
+                             std::chrono::milliseconds interval = std::chrono::milliseconds(10000));
+
+      /** Publish the latest values of all control system variables in the POSIX shared memory segment with the given
+       *  name (see SharedMemoryPublisher), so tools on the same host can read them with the SharedMemoryReader
+       *  without going through the control system. The variables are still created in the PVManager as usual. The
+       *  segment must be large enough for all variables, string values longer than maxStringLength are not published.
+       *
+       *  This function must be called before the application is initialised (i.e. before the call to initialise()). */
+      void enableSharedMemoryPublication(const std::string &segmentName, size_t segmentSize = 64*1024*1024,
+                                         size_t maxVariables = 16384, size_t maxStringLength = 256);
+
+      /** Publish the statistics of the updates of all variable networks to the control system once per interval (see
+       *  StatisticsModule). The statistics are collected also without this function, see dumpStatistics().
+       *
+       *  This function must be called before the application is initialised (i.e. before the call to initialise()). */
+      void enableStatistics(std::chrono::milliseconds interval = std::chrono::milliseconds(1000)) {
+        statisticsEnabled = true;
+        statisticsInterval = interval;
+      }
+
+      /** Cache the values of poll-type registers of the given device, so several consumers polling the same register
+       *  within the given maximum age share a single transfer from the device. Concurrent polls of a register are
+       *  coalesced into one transfer also with a maximum age of 0. If a register name is given, the setting applies
+       *  only to this register and takes precedence over the setting for the whole device. The numbers of polls
+       *  served from the cache and from the device are shown by dumpStatistics() and are published as
+       *  "cacheHits" and "cacheMisses" below the statistics of the register if enableStatistics() has been called.
+       *
+       *  Without the cache, networks fed by the same register are merged into one network, which must then have
+       *  exactly one polling consumer. With the cache, networks which each have their own polling consumer are kept
+       *  separate and share the transfers through the cache instead.
+       *
+       *  Registers read through an external trigger are never cached, since the trigger defines the time of the
+       *  transfer.
+       *
+       *  This function must be called before the application is initialised (i.e. before the call to initialise()). */
+      void enablePollCache(const std::string &deviceAlias, std::chrono::microseconds maxAge,
+                           const std::string &registerName = "") {
+        pollCacheMaxAges[std::make_pair(deviceAlias, registerName)] = maxAge;
+      }
+
+      /** Place the ApplicationModules automatically on the NUMA nodes of the system. Modules communicating with each
+       *  other directly (i.e. having variables in the same network) are placed on the same node, the resulting groups
+       *  of modules are distributed evenly over the nodes. Modules which have been placed explicitly with the
+       *  "schedNumaNode" or "schedCpus" tags keep their placement and pull the other modules of their group onto the
+       *  same node. The placement is done by adding the "schedNumaNode" tag to the modules (see
+       *  ThreadSchedulingPolicy), so the FanOut threads and the buffers of the networks follow the modules.
+       *
+       *  This function must be called before the application is initialised (i.e. before the call to initialise()). */
+      void enableNumaPlacement() { numaPlacement = true; }
+
+      /** Register internal state of a module to be included in the snapshots of the persistence (see
+       *  enablePersistence()). The save function is called from the snapshot thread and must synchronise with the
+       *  module thread. The restore function is called with the saved value before the module threads are started.
+       *  If the persistence is not enabled, the call has no effect. */
+      void registerPersistentState(const std::string &name, std::function<std::string()> save,
+                                   std::function<void(const std::string&)> restore);
+
+      /** Create a new VariableNetwork with the given feeder and consumers and make its connections immediately. This
+       *  function can be called while the application is running, e.g. to connect a device register to the control
+       *  system on request. The FanOuts needed for the network are started right away if the application is running
+       *  already, otherwise they are started by run() together with all other FanOuts. Devices which are already open
+       *  are reused.
+       *
+       *  Only nodes of the types Device, ControlSystem and Constant are allowed. Application nodes cannot be connected
+       *  this way, since the implementation of their accessors must not be replaced while the module threads are
+       *  running. Networks requiring an external trigger are not supported either, since the network of the trigger
+       *  has been created already. None of the nodes must be part of another network.
+       *
+       *  Note that process variables created in the PVManager cannot be removed again, so a control system variable
+       *  name can only be used once in the lifetime of the application.
+       *
+       *  This function and removeNetwork() are not thread safe and must be called from the same thread. */
+      VariableNetwork& addNetwork(VariableNetworkNode feeder, const std::list<VariableNetworkNode> &consumers);
+
+      /** Stop and remove a network previously created with addNetwork(). The FanOuts of the network are deactivated
+       *  and destroyed, the nodes are released so they can be connected again. Opened devices stay open. Throws
+       *  ApplicationExceptionWithID<illegalParameter> if the network has not been created by addNetwork(). */
+      void removeNetwork(VariableNetwork &network);
+
     protected:
 
       friend class Module;
@@ -171,6 +281,9 @@ namespace ChimeraTK {
       template<typename UserType>
       friend class Accessor;
 
+      template<typename FEEDER, typename... CONSUMERS>
+      friend class StaticConnection;
+
       /** Check if all connections are valid. Internally called in initialise(). */
       void checkConnections();
 
@@ -183,12 +296,27 @@ namespace ChimeraTK {
       /** Register the connections to constants for previously unconnected nodes. */
       void processUnconnectedNodes();
 
+      /** Add the "schedNumaNode" tags to the ApplicationModules, see enableNumaPlacement(). */
+      void placeModulesOnNumaNodes();
+
       /** Make the connections between accessors as requested in the initialise() function. */
       void makeConnections();
 
       /** Apply optimisations to the VariableNetworks, e.g. by merging networks sharing the same feeder. */
       void optimiseConnections();
 
+      /** Remove ApplicationModules consisting only of pass-through pairs (see
+       *  ApplicationModule::declarePassThrough()) by connecting the feeder of each input directly to the consumers of
+       *  the corresponding output. Called by optimiseConnections(). */
+      void eliminatePassThroughModules();
+
+      /** Find linear chains of ElementwiseStages connected 1:1 and execute each chain in a single
+       *  FusedElementwiseChain instead of one thread per module. Called by optimiseConnections(). */
+      void fuseElementwiseChains();
+
+      /** Connect the given node to a newly created constant, e.g. because it is otherwise unconnected. */
+      void connectToConstant(VariableNetworkNode node);
+
       /** Make the connections for a single network */
       void makeConnectionsForNetwork(VariableNetwork &network);
 
@@ -196,25 +324,38 @@ namespace ChimeraTK {
       template<typename UserType>
       void typedMakeConnection(VariableNetwork &network);
 
-      /** Functor class to call typedMakeConnection() with the right template argument. */
-      struct TypedMakeConnectionCaller {
-        TypedMakeConnectionCaller(Application &owner, VariableNetwork &network);
-
+      /** Functor class to fill typedMakeConnectionTable */
+      struct TypedMakeConnectionTableFiller {
         template<typename PAIR>
         void operator()(PAIR&) const;
 
-        Application &_owner;
-        VariableNetwork &_network;
-        mutable bool done{false};
+        std::map<std::type_index, VariableNetwork::TypedMakeConnectionFunction> &_table;
       };
 
+      /** Create the content of typedMakeConnectionTable */
+      static std::map<std::type_index, VariableNetwork::TypedMakeConnectionFunction> createTypedMakeConnectionTable();
+
+      /** typedMakeConnection() for all user types, indexed by the value type. Since the table contains the addresses,
+       *  typedMakeConnection() is guaranteed to be instantiated for all user types, which StaticConnection relies
+       *  on. */
+      static const std::map<std::type_index, VariableNetwork::TypedMakeConnectionFunction> typedMakeConnectionTable;
+
       /** Register a connection between two VariableNetworkNode */
       VariableNetwork& connect(VariableNetworkNode a, VariableNetworkNode b);
 
-      /** Perform the actual connection of an accessor to a device register */
+      /** Perform the actual connection of an accessor to a device register, starting at the given element offset. If
+       *  writeBlockSize is non-zero, a feeding one-dimensional register is written in blocks of the given number of
+       *  elements and only the changed blocks are transferred (see DirtyRangeDecoratorRegisterAccessor). */
       template<typename UserType>
       boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> createDeviceVariable(const std::string &deviceAlias,
-          const std::string &registerName, VariableDirection direction, UpdateMode mode, size_t nElements);
+          const std::string &registerName, VariableDirection direction, UpdateMode mode, size_t nElements,
+          size_t writeBlockSize = 0, size_t offset = 0);
+
+      /** Return the block size for createDeviceVariable() for a device register fed by the given application node:
+       *  DirtyRangeWrites::defaultBlockSize if the node has the "writeChangedRanges" tag, 0
+       *  otherwise. Batched writes (see applyWriteBatching()) always transfer the full register, so 0 is returned
+       *  also if the node has the "batchDeviceWrites" tag. */
+      size_t getWriteBlockSize(VariableNetworkNode const &feeder);
 
       /** Create a process variable with the PVManager, which is exported to the control system adapter. nElements will
           be the array size of the created variable. */
@@ -228,6 +369,38 @@ namespace ChimeraTK {
       std::pair< boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>>, boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> >
             createApplicationVariable(VariableNetworkNode const &node, VariableNetworkNode const &consumer={});
 
+      /** Decorate the implementation of a push-type consuming application node with the WaitPolicy given by the tags
+       *  of the node (plain blocking without wait tags and in testable mode). Returns the implementation unchanged for
+       *  poll-type nodes. */
+      template<typename UserType>
+      boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> applyWaitPolicy(
+          boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> impl, VariableNetworkNode const &consumer);
+
+      /** Decorate the given implementation of a device register fed by the given application node to defer its writes
+       *  to the DeviceWriteBatch of the owning module and the device, if the node has the "batchDeviceWrites" tag.
+       *  Returns the implementation unchanged otherwise. */
+      template<typename UserType>
+      boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> applyWriteBatching(
+          boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> impl, VariableNetworkNode const &feeder,
+          const std::string &deviceAlias);
+
+      /** Decorate the given implementation of a poll-type device register fed by the given node to read through the
+       *  shared PollCacheEntry of the register, if enablePollCache() has been called for the register or its device.
+       *  Returns the implementation unchanged otherwise. */
+      template<typename UserType>
+      boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> applyPollCache(
+          boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> impl, VariableNetworkNode const &feeder);
+
+      /** Return the maximum age of the poll cache for the register of the given device node, or nullptr if the poll
+       *  cache is not enabled for the register (see enablePollCache()). */
+      const std::chrono::microseconds* getPollCacheMaxAge(VariableNetworkNode const &feeder) const;
+
+      /** Decorate the given implementation of an application variable connected without a FanOut to count its
+       *  updates in the statistics of the network (see NetworkStatistics). */
+      template<typename UserType>
+      boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> countUpdates(
+          boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> impl, VariableNetwork &network);
+
       /** List of InternalModules */
       std::list<boost::shared_ptr<InternalModule>> internalModuleList;
 
@@ -241,6 +414,13 @@ namespace ChimeraTK {
        *  triggering node. */
       std::map<const void*, boost::shared_ptr<TriggerFanOut>> triggerMap;
 
+      /** InternalModules of the networks created by addNetwork(), indexed by the network. Only these networks can be
+       *  removed again with removeNetwork(). */
+      std::map<const VariableNetwork*, std::list<boost::shared_ptr<InternalModule>>> runtimeNetworkModules;
+
+      /** Flag whether run() has been called and the application has not yet been shut down. */
+      bool isRunning{false};
+
       /** Create a new, empty network */
       VariableNetwork& createNetwork();
 
@@ -316,6 +496,37 @@ namespace ChimeraTK {
        *  id of the VariableNetworkNode.*/
       std::unordered_set<const void*> debugMode_variableList;
 
+      /** Recorder used for all variables if enabled via enableVariableRecording(), otherwise nullptr. */
+      boost::shared_ptr<VariableRecorder> variableRecorder;
+
+      /** Manager for the snapshots if enabled via enablePersistence(), otherwise nullptr. */
+      boost::shared_ptr<PersistenceManager> persistenceManager;
+
+      /** Publisher of the control system variables if enabled via enableSharedMemoryPublication(), otherwise nullptr. */
+      boost::shared_ptr<SharedMemoryPublisher> sharedMemoryPublisher;
+
+      /** Flag whether the modules are placed on the NUMA nodes automatically, see enableNumaPlacement() */
+      bool numaPlacement{false};
+
+      /** Flag and interval of the publication of the statistics, see enableStatistics() */
+      bool statisticsEnabled{false};
+      std::chrono::milliseconds statisticsInterval{1000};
+
+      /** Publisher of the statistics if enabled via enableStatistics(), otherwise nullptr. Created in
+       *  makeConnections(). */
+      boost::shared_ptr<StatisticsModule> statisticsModule;
+
+      /** Batches of deferred device writes, indexed by the owning module of the feeders and the device alias (see
+       *  DeviceWriteBatch) */
+      std::map<std::pair<EntityOwner*, std::string>, boost::shared_ptr<DeviceWriteBatch>> deviceWriteBatches;
+
+      /** Maximum ages of cached poll values, indexed by device alias and register name (empty for the whole device),
+       *  see enablePollCache() */
+      std::map<std::pair<std::string, std::string>, std::chrono::microseconds> pollCacheMaxAges;
+
+      /** Caches of the polled registers, indexed by device alias, register name, number of elements and user type */
+      std::map<std::string, boost::shared_ptr<PollCacheEntryBase>> pollCacheEntries;
+
       template<typename UserType>
       friend class TestDecoratorRegisterAccessor;   // needs access to the testableMode_mutex and testableMode_counter and the idMap
 
@@ -324,6 +535,8 @@ namespace ChimeraTK {
 
       friend class TestFacility;                    // needs access to testableMode_variables
 
+      friend class VariableReplayer;                // needs access to testableMode_counter
+
       template<typename UserType>
       friend class DebugDecoratorRegisterAccessor;   // needs access to the idMap
 
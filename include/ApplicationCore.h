@@ -20,3 +20,5 @@
 #include "ModuleGroup.h"
 #include "VirtualModule.h"
 #include "ApplicationException.h"
+#include "DeadlineMonitor.h"
+#include "DataConsistencyGroup.h"
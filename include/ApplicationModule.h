@@ -13,11 +13,14 @@
 #include <boost/thread.hpp>
 
 #include "ModuleImpl.h"
+#include "ThreadSchedulingPolicy.h"
+#include "WaitPolicy.h"
 
 namespace ChimeraTK {
 
   class Application;
   class ModuleGroup;
+  class DeadlineMonitor;
 
   class ApplicationModule : public ModuleImpl {
 
@@ -48,6 +51,7 @@ namespace ChimeraTK {
       /** Move assignment */
       ApplicationModule& operator=(ApplicationModule &&other) {
         assert(!moduleThread.joinable());   // if the thread is already running, moving is no longer allowed!
+        passThroughPairs = std::move(other.passThroughPairs);
         ModuleImpl::operator=(std::move(other));
         return *this;
       }
@@ -64,14 +68,56 @@ namespace ChimeraTK {
 
       ModuleType getModuleType() const override { return ModuleType::ApplicationModule; }
 
+      /** Return the list of input/output pairs declared with declarePassThrough() */
+      const std::list<std::pair<VariableNetworkNode, VariableNetworkNode>>& getPassThroughPairs() const {
+        return passThroughPairs;
+      }
+
+      /** Check whether the module has been eliminated by the connection logic, because it only passes through values
+       *  (see declarePassThrough()). The main loop of an eliminated module will not be executed. */
+      bool hasBeenEliminated() const { return eliminated; }
+
+      /** Obtain the scheduling policy of the module thread from the tags of the module (see ThreadSchedulingPolicy).
+       *  Throws ApplicationExceptionWithID<illegalParameter> if the tags cannot be parsed. */
+      ThreadSchedulingPolicy getSchedulingPolicy() const { return ThreadSchedulingPolicy::fromTags(_tags); }
+
+      /** Obtain the policy how Application::readAny() waits in the module thread from the tags of the module (see
+       *  WaitPolicy). Throws ApplicationExceptionWithID<illegalParameter> if the tags cannot be parsed. */
+      WaitPolicy getWaitPolicy() const { return WaitPolicy::fromTags(_tags); }
+
     protected:
 
+      friend class Application;
+
+      /** Declare that the given output always receives the unaltered values of the given push-type input, without
+       *  any further action of the module. If all accessors of the module are declared as such pass-through pairs, the
+       *  connection logic may remove the module entirely by directly connecting the input's feeder to the output's
+       *  consumers. In that case the main loop of the module is never executed. */
+      void declarePassThrough(VariableNetworkNode input, VariableNetworkNode output) {
+        passThroughPairs.emplace_back(input, output);
+      }
+
+      /** List of pass-through pairs (input, output) */
+      std::list<std::pair<VariableNetworkNode, VariableNetworkNode>> passThroughPairs;
+
+      /** Flag whether the module has been eliminated by the connection logic */
+      bool eliminated{false};
+
       /** Wrapper around mainLoop(), to execute additional tasks in the thread before entering the main loop */
       void mainLoopWrapper();
 
       /** The thread executing mainLoop() */
       boost::thread moduleThread;
 
+      /** Scheduling policy applied by the module thread, obtained when the thread is started */
+      ThreadSchedulingPolicy schedulingPolicy;
+
+      /** Wait policy used by Application::readAny() in the module thread, obtained when the thread is started */
+      WaitPolicy waitPolicy;
+
+      /** DeadlineMonitor of the module, if any. Obtained when the thread is started. */
+      DeadlineMonitor *deadlineMonitor{nullptr};
+
   };
 
 } /* namespace ChimeraTK */
@@ -0,0 +1,51 @@
+/*
+ * BatchedWriteDecoratorRegisterAccessor.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_BATCHED_WRITE_DECORATOR_REGISTER_ACCCESSOR
+#define CHIMERATK_BATCHED_WRITE_DECORATOR_REGISTER_ACCCESSOR
+
+#include <mtca4u/NDRegisterAccessorDecorator.h>
+
+#include "DeviceWriteBatch.h"
+
+namespace ChimeraTK {
+
+  /** Decorator of a device register accessor which defers the writes to the given DeviceWriteBatch. The value is
+   *  copied into the target on write, the transfer is executed when the batch is flushed. The target is part of the
+   *  TransferGroup of the batch and hence must not be written directly. */
+  template<typename UserType>
+  class BatchedWriteDecoratorRegisterAccessor : public mtca4u::NDRegisterAccessorDecorator<UserType> {
+    public:
+      BatchedWriteDecoratorRegisterAccessor(boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> accessor,
+                                            boost::shared_ptr<DeviceWriteBatch> batch)
+      : mtca4u::NDRegisterAccessorDecorator<UserType>(accessor), _batch(batch)
+      {
+        _batch->add(accessor);
+      }
+
+      void doPreWrite() override {
+        // copy instead of swapping, since the target keeps the value until the batch is flushed
+        for(size_t i=0; i<buffer_2D.size(); ++i) _target->accessChannel(i) = buffer_2D[i];
+      }
+
+      bool doWriteTransfer(ChimeraTK::VersionNumber={}) override {
+        _batch->markPending();
+        return false;
+      }
+
+      void doPostWrite() override {}
+
+    protected:
+
+      using mtca4u::NDRegisterAccessorDecorator<UserType>::_target;
+      using mtca4u::NDRegisterAccessor<UserType>::buffer_2D;
+
+      boost::shared_ptr<DeviceWriteBatch> _batch;
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_BATCHED_WRITE_DECORATOR_REGISTER_ACCCESSOR */
@@ -30,13 +30,16 @@ namespace ChimeraTK {
 
       void doPostRead() override {
         mtca4u::NDRegisterAccessorDecorator<UserType>::doPostRead();
+        auto version = FanOut<UserType>::impl->getVersionNumber();
+        bool dataLost = false;
         for(auto &slave : FanOut<UserType>::slaves) {     // send out copies to slaves
           // do not send copy if no data is expected (e.g. trigger)
           if(slave->getNumberOfSamples() != 0) {
             slave->accessChannel(0) = buffer_2D[0];
           }
-          slave->write();
+          if(slave->write(version)) dataLost = true;
         }
+        FanOut<UserType>::countUpdate(dataLost);
       }
 
     protected:
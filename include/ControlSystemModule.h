@@ -9,6 +9,7 @@
 #define CHIMERATK_CONTROL_SYSTEM_MODULE_H
 
 #include <list>
+#include <unordered_map>
 
 #include <mtca4u/RegisterPath.h>
 
@@ -60,12 +61,12 @@ namespace ChimeraTK {
       mtca4u::RegisterPath variableNamePrefix;
 
       // List of sub modules accessed through the operator[]. This is mutable since it is little more than a cache and
-      // thus does not change the logical state of this module
-      mutable std::map<std::string, ControlSystemModule> subModules;
+      // thus does not change the logical state of this module. References to the elements stay valid on insertion.
+      mutable std::unordered_map<std::string, ControlSystemModule> subModules;
 
       // List of variables accessed through the operator(). This is mutable since it is little more than a cache and
       // thus does not change the logical state of this module
-      mutable std::map<std::string, VariableNetworkNode> variables;
+      mutable std::unordered_map<std::string, VariableNetworkNode> variables;
 
   };
 
@@ -0,0 +1,110 @@
+/*
+ * DataConsistencyGroup.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_DATA_CONSISTENCY_GROUP_H
+#define CHIMERATK_DATA_CONSISTENCY_GROUP_H
+
+#include <list>
+#include <vector>
+#include <functional>
+#include <cstdint>
+
+#include <mtca4u/TransferElement.h>
+#include <mtca4u/TransferElementAbstractor.h>
+#include <mtca4u/VersionNumber.h>
+
+namespace ChimeraTK {
+
+  /** Group of push-type inputs of an ApplicationModule which are expected to receive their values with the same
+   *  VersionNumber, e.g. because they are fed from the same trigger through a TriggerFanOut. The group tracks the
+   *  VersionNumbers of the inputs and reports when all inputs hold the same VersionNumber, i.e. when a complete and
+   *  consistent set of values is available.
+   *
+   *  The inputs of a set may arrive in any order. When an input receives a newer VersionNumber than the other inputs
+   *  have, the set of the older VersionNumber can no longer be completed and is discarded (e.g. because a value was
+   *  lost in a full queue). Inputs lagging behind with an older VersionNumber are ignored until they catch up.
+   *
+   *  Typical use in the main loop of a module:
+   *
+   *    ctk::DataConsistencyGroup group{input1, input2, input3};
+   *    ...
+   *    while(true) {
+   *      group.readConsistent();
+   *      // all inputs hold values of the same VersionNumber
+   *    }
+   *
+   *  Alternatively, update() can be called with the id returned by readAny(), if the module also waits for inputs not
+   *  belonging to the group. The matching does not allocate memory. The group is intended for a small number of
+   *  inputs, the id is searched linearly. */
+  class DataConsistencyGroup {
+
+    public:
+
+      /** Handling of incomplete sets which are discarded because an input received a newer VersionNumber */
+      enum class IncompletePolicy {
+        discard,        ///< the set is discarded silently, readConsistent() continues waiting for a complete set
+        deliver         ///< readConsistent() returns false, so the module can handle the incomplete set
+      };
+
+      DataConsistencyGroup(IncompletePolicy policy = IncompletePolicy::discard) : policy(policy) {}
+
+      DataConsistencyGroup(std::initializer_list<std::reference_wrapper<mtca4u::TransferElementAbstractor>> elements,
+                           IncompletePolicy policy = IncompletePolicy::discard);
+
+      /** Add an input to the group. Only push-type inputs are allowed. Must be called before the module is started. */
+      void add(mtca4u::TransferElementAbstractor &element);
+
+      /** Process an update of the input with the given id, e.g. the return value of readAny(). Returns true if all
+       *  inputs of the group hold the same VersionNumber after this update, i.e. if this update completed a set.
+       *  Returns false for ids which do not belong to the group. */
+      bool update(const mtca4u::TransferElementID &id);
+
+      /** Wait until a complete set of values with the same VersionNumber is available in all inputs of the group and
+       *  return true. With IncompletePolicy::deliver, the function returns false as soon as an incomplete set has been
+       *  discarded. The inputs then hold the values received most recently. */
+      bool readConsistent();
+
+      /** Check if all inputs hold the same VersionNumber, as reported by the last call to update() */
+      bool isConsistent() const { return nMatching == elements.size() && hasVersion; }
+
+      /** Return the VersionNumber of the current set. Only valid if update() has been called before. */
+      ChimeraTK::VersionNumber getVersionNumber() const { return version; }
+
+      /** Return the number of incomplete sets discarded so far */
+      uint64_t getNumberOfDiscardedSets() const { return nDiscarded; }
+
+    protected:
+
+      /** Input of the group with the flag whether it holds the VersionNumber of the current set */
+      struct Element {
+        std::reference_wrapper<mtca4u::TransferElementAbstractor> accessor;
+        bool matching;
+      };
+
+      std::vector<Element> elements;
+
+      /** The inputs in the form needed by readAny() */
+      std::list<std::reference_wrapper<mtca4u::TransferElementAbstractor>> readAnyList;
+
+      IncompletePolicy policy;
+
+      /** VersionNumber of the current set, only valid if hasVersion is true */
+      ChimeraTK::VersionNumber version;
+      bool hasVersion{false};
+
+      /** Number of inputs holding the VersionNumber of the current set */
+      size_t nMatching{0};
+
+      uint64_t nDiscarded{0};
+
+      /** Flag whether the last call to update() discarded an incomplete set */
+      bool discardedInLastUpdate{false};
+
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_DATA_CONSISTENCY_GROUP_H */
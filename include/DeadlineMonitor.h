@@ -0,0 +1,82 @@
+/*
+ * DeadlineMonitor.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_DEADLINE_MONITOR_H
+#define CHIMERATK_DEADLINE_MONITOR_H
+
+#include <chrono>
+#include <vector>
+
+#include "VariableGroup.h"
+#include "ScalarAccessor.h"
+#include "ArrayAccessor.h"
+#include "Profiler.h"
+
+namespace ChimeraTK {
+
+  /** Monitor of the cycle time of an ApplicationModule. A cycle is the time from waking up in a blocking read of a
+   *  push-type input (read(), readAll() or readAny()) until the next blocking read, i.e. the time the module thread
+   *  needs to process an update. Spinning according to a WaitPolicy is not part of the cycle. Each cycle is compared
+   *  against the expected period or deadline of the module and the statistics are published as process variables:
+   *
+   *  - "cycles": number of cycles
+   *  - "overruns": number of cycles which took longer than the deadline
+   *  - "worstCycleTime": longest cycle time in microseconds
+   *  - "cycleTimeHistogram": number of cycles per bin of the cycle time. The bins have a width of 1/10 of the deadline
+   *    (by default), the last bin collects all longer cycles.
+   *
+   *  The counters wrap around after 2^32 cycles.
+   *
+   *  To enable the monitoring, add a DeadlineMonitor to the module, e.g.
+   *
+   *    ctk::DeadlineMonitor deadline{this, "deadline", std::chrono::microseconds(500)};
+   *
+   *  Only one DeadlineMonitor per module is supported. The statistics are collected in the module thread using the
+   *  time measurement of the Profiler, which costs a few nanoseconds per cycle. The process variables are written by
+   *  the module thread at the end of a cycle, at most once per publication interval. */
+  class DeadlineMonitor : public VariableGroup, public Profiler::CycleObserver {
+
+    public:
+
+      /** Create the monitor with the given deadline. The histogram has nBins bins, covering cycle times from 0 to
+       *  nBins/10 times the deadline. The statistics are published at most once per publicationInterval (0 to
+       *  publish after each cycle). */
+      DeadlineMonitor(EntityOwner *owner, const std::string &name, std::chrono::microseconds deadline,
+                      size_t nBins=20, std::chrono::milliseconds publicationInterval=std::chrono::milliseconds(1000),
+                      const std::string &description="Cycle time statistics of the module",
+                      bool eliminateHierarchy=false, const std::unordered_set<std::string> &tags={});
+
+      void cycleCompleted(std::chrono::high_resolution_clock::duration cycleTime,
+                          std::chrono::high_resolution_clock::time_point now) override;
+
+      /** Write the current statistics to the process variables. Must be called in the module thread. */
+      void publish();
+
+      std::chrono::microseconds getDeadline() const { return _deadline; }
+
+      ScalarOutput<uint32_t> cycles{this, "cycles", "", "Number of cycles"};
+      ScalarOutput<uint32_t> overruns{this, "overruns", "", "Number of cycles exceeding the deadline"};
+      ScalarOutput<uint32_t> worstCycleTime{this, "worstCycleTime", "us", "Longest cycle time"};
+      ArrayOutput<uint32_t> cycleTimeHistogram;
+
+    protected:
+
+      std::chrono::microseconds _deadline{0};
+      std::chrono::high_resolution_clock::duration _binWidth{1};
+      std::chrono::high_resolution_clock::duration _publicationInterval{0};
+      std::chrono::high_resolution_clock::time_point _nextPublication;
+
+      /** Statistics, only accessed in the module thread */
+      uint32_t _cycles{0};
+      uint32_t _overruns{0};
+      std::chrono::high_resolution_clock::duration _worstCycleTime{0};
+      std::vector<uint32_t> _histogram;
+
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_DEADLINE_MONITOR_H */
@@ -0,0 +1,78 @@
+/*
+ * DeviceWriteBatch.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_DEVICE_WRITE_BATCH_H
+#define CHIMERATK_DEVICE_WRITE_BATCH_H
+
+#include <vector>
+
+#include <mtca4u/TransferElement.h>
+#include <mtca4u/TransferGroup.h>
+
+#include "Profiler.h"
+
+namespace ChimeraTK {
+
+  /** Batch of the device registers written by one ApplicationModule to the same device. The writes of the outputs
+   *  connected to the registers are deferred and executed together through a TransferGroup, which merges adjacent
+   *  registers into block transfers. This reduces the number of bus transactions if a module writes many registers
+   *  of the same device in each cycle.
+   *
+   *  The batch is flushed at the end of each cycle of the module thread, i.e. when the thread starts waiting for new
+   *  data (see Profiler), and in Module::writeAll(). Since all registers of the batch are written together, registers
+   *  which have not been changed in a cycle are written again with their last value. Hence only registers without
+   *  side effects on writing should be batched.
+   *
+   *  Batching is enabled with the "batchDeviceWrites" tag on the outputs of the module (or on the module to apply it
+   *  to all outputs). It is applied to outputs connected directly to a device register and to device registers fed
+   *  through a FeedingFanOut. Each batch must only be written by a single thread. */
+  class DeviceWriteBatch {
+
+    public:
+
+      /** Add the accessor of a device register to the batch. The accessor must no longer be written directly. */
+      void add(boost::shared_ptr<mtca4u::TransferElement> accessor) {
+        group.addAccessor(accessor);
+      }
+
+      /** Mark the batch as changed, so it is written by the next flush() of the current thread */
+      void markPending();
+
+      /** Write all registers of the batch, if the batch has been changed since the last flush */
+      void flush();
+
+      /** Flush all batches changed by the current thread */
+      static void flushCurrentThread();
+
+      /** Name of the tag enabling the batching */
+      static constexpr const char *tag = "batchDeviceWrites";
+
+    protected:
+
+      mtca4u::TransferGroup group;
+
+      bool pending{false};
+
+      /** Observer flushing the batches of a thread at the end of each cycle */
+      struct ThreadFlusher : public Profiler::CycleObserver {
+        void cycleCompleted(std::chrono::high_resolution_clock::duration,
+                            std::chrono::high_resolution_clock::time_point) override {
+          flushCurrentThread();
+        }
+
+        /** Batches changed by the thread since the last flush */
+        std::vector<DeviceWriteBatch*> pendingBatches;
+
+        bool registered{false};
+      };
+
+      static ThreadFlusher& getThreadFlusher();
+
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_DEVICE_WRITE_BATCH_H */
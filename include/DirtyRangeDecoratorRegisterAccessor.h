@@ -0,0 +1,114 @@
+/*
+ * DirtyRangeDecoratorRegisterAccessor.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_DIRTY_RANGE_DECORATOR_REGISTER_ACCCESSOR
+#define CHIMERATK_DIRTY_RANGE_DECORATOR_REGISTER_ACCCESSOR
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include <mtca4u/NDRegisterAccessorDecorator.h>
+
+namespace ChimeraTK {
+
+  /** Settings of the DirtyRangeDecoratorRegisterAccessor, independent of the UserType */
+  struct DirtyRangeWrites {
+
+      /** Tag to enable the decorator on the feeder of a device register, see Application::getWriteBlockSize() */
+      static constexpr const char *tag = "writeChangedRanges";
+
+      /** Default number of elements per block */
+      static constexpr size_t defaultBlockSize = 256;
+
+  };
+
+  /*******************************************************************************************************************/
+
+  /** Decorator of a one-dimensional device register accessor which transfers only the changed parts of the array on
+   *  write. The register is divided into blocks of a fixed number of elements, each block has its own register
+   *  accessor with the corresponding offset. On write, the value is compared block-wise with the last written value
+   *  and only the changed blocks are written. The first write transfers all blocks. The target itself is never
+   *  transferred.
+   *
+   *  Since the comparison is done against the last value written through this accessor, changes of the register by
+   *  other means (e.g. by the firmware or another application) are not restored by a write of the unchanged value.
+   *  The decorator is hence only used if requested with the "writeChangedRanges" tag on the feeding variable (see
+   *  DirtyRangeWrites). */
+  template<typename UserType>
+  class DirtyRangeDecoratorRegisterAccessor : public mtca4u::NDRegisterAccessorDecorator<UserType> {
+    public:
+
+      /** The blocks must be accessors of consecutive ranges of the register covering the full target, in order. */
+      DirtyRangeDecoratorRegisterAccessor(boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> accessor,
+                                          std::vector<boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>>> blocks)
+      : mtca4u::NDRegisterAccessorDecorator<UserType>(accessor), _blocks(blocks)
+      {
+        size_t offset = 0;
+        for(auto &block : _blocks) {
+          _offsets.push_back(offset);
+          offset += block->getNumberOfSamples();
+        }
+        assert(offset == accessor->getNumberOfSamples());
+      }
+
+      void doPreWrite() override {
+        auto &value = buffer_2D[0];
+        _dirtyBlocks.clear();
+        for(size_t i=0; i<_blocks.size(); ++i) {
+          auto begin = value.begin()+_offsets[i];
+          auto end = begin+_blocks[i]->getNumberOfSamples();
+          // std::equal is reduced to a memcmp() for integral types
+          if(!_lastWritten.empty() && std::equal(begin, end, _lastWritten.begin()+_offsets[i])) continue;
+          std::copy(begin, end, _blocks[i]->accessChannel(0).begin());
+          _dirtyBlocks.push_back(i);
+        }
+      }
+
+      bool doWriteTransfer(ChimeraTK::VersionNumber versionNumber={}) override {
+        bool dataLost = false;
+        for(auto i : _dirtyBlocks) {
+          dataLost |= _blocks[i]->write(versionNumber);
+          _transferredElements += _blocks[i]->getNumberOfSamples();
+        }
+        return dataLost;
+      }
+
+      void doPostWrite() override {
+        if(_lastWritten.empty()) {
+          _lastWritten = buffer_2D[0];
+          return;
+        }
+        for(auto i : _dirtyBlocks) {
+          auto begin = buffer_2D[0].begin()+_offsets[i];
+          std::copy(begin, begin+_blocks[i]->getNumberOfSamples(), _lastWritten.begin()+_offsets[i]);
+        }
+      }
+
+      /** Return the number of elements transferred to the device so far. Must be called from the writing thread. */
+      uint64_t getNumberOfTransferredElements() const { return _transferredElements; }
+
+    protected:
+
+      using mtca4u::NDRegisterAccessor<UserType>::buffer_2D;
+
+      /** Accessors of the blocks and their offsets relative to the target */
+      std::vector<boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>>> _blocks;
+      std::vector<size_t> _offsets;
+
+      /** Last value written, empty before the first write */
+      std::vector<UserType> _lastWritten;
+
+      /** Indices of the blocks to be written by the current write */
+      std::vector<size_t> _dirtyBlocks;
+
+      uint64_t _transferredElements{0};
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_DIRTY_RANGE_DECORATOR_REGISTER_ACCCESSOR */
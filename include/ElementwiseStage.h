@@ -0,0 +1,86 @@
+/*
+ * ElementwiseStage.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_ELEMENTWISE_STAGE_H
+#define CHIMERATK_ELEMENTWISE_STAGE_H
+
+#include <cstddef>
+#include <list>
+#include <type_traits>
+#include <functional>
+
+#include <mtca4u/TransferElementAbstractor.h>
+
+#include "VariableNetworkNode.h"
+
+namespace ChimeraTK {
+
+  /** Interface for stateless modules applying an element-wise operation to one input and writing the result to one
+   *  output, like the Multiplier or the LimitValue modules. Linear chains of such modules connected 1:1 are fused by
+   *  the connection logic into a single FusedElementwiseChain: the chain is executed in one thread in a single pass
+   *  over the values, and the variables between the stages are removed. The threads of the modules themselves will
+   *  not be started then (see ApplicationModule::hasBeenEliminated()). The chain processes arrays block-wise: each
+   *  block is passed through all stages while it is in the cache, before the next block is read.
+   *
+   *  Inside a fused chain, the values are passed between the stages as double. Each stage must reproduce the
+   *  conversion into its output type (e.g. the rounding for integral types) in applyStage(), so the results are
+   *  identical to the unfused chain. */
+  class ElementwiseStage {
+
+    public:
+
+      virtual ~ElementwiseStage() {}
+
+      /** Node of the input which is processed element-wise */
+      virtual VariableNetworkNode getStageInput() = 0;
+
+      /** Node of the output receiving the result */
+      virtual VariableNetworkNode getStageOutput() = 0;
+
+      /** Accessor of the input, read by the fused chain if this is the first stage */
+      virtual TransferElementAbstractor& getStageInputAccessor() = 0;
+
+      /** Further push-type inputs the operation depends on (e.g. the factor of the Multiplier) */
+      virtual std::list<std::reference_wrapper<TransferElementAbstractor>> getStageParameters() { return {}; }
+
+      /** Check whether the stage can be fused. This requires all values to be exactly representable as double. */
+      virtual bool isFusable() const = 0;
+
+      /** Number of elements of the input and the output */
+      virtual size_t getStageNumberOfElements() = 0;
+
+      /** Copy n elements of the input starting at the given offset into values (first stage only) */
+      virtual void readStageInput(double *values, size_t offset, size_t n) = 0;
+
+      /** Apply the operation in place to n values, including the conversion into the output type. For arrays, this
+       *  is called once per block of the array (see FusedElementwiseChain::blockSize). */
+      virtual void applyStage(double *values, size_t n) = 0;
+
+      /** Copy n values into the output buffer starting at the given offset, without writing it (last stage only) */
+      virtual void storeStageOutput(const double *values, size_t offset, size_t n) = 0;
+
+      /** Write the output after all blocks have been stored (last stage only) */
+      virtual void writeStageOutput() = 0;
+
+      /** Write additional outputs, if needed (e.g. LimitValue::isLimited). Called for all stages after the last stage
+       *  has written its output, so the order of writes is the same as in the unfused chain. */
+      virtual void writeStageSideOutputs() {}
+
+  };
+
+  namespace detail {
+
+    /** Check whether all values of the given type are exactly representable as double */
+    template<typename T>
+    constexpr bool isExactInDouble() {
+      return std::is_floating_point<T>::value || (std::is_integral<T>::value && sizeof(T) <= 4);
+    }
+
+  }
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_ELEMENTWISE_STAGE_H */
@@ -10,6 +10,7 @@
 
 #include <string>
 #include <list>
+#include <functional>
 
 #include "VariableNetworkNode.h"
 
@@ -80,22 +81,23 @@ namespace ChimeraTK {
 
       /** Return a VirtualModule containing the part of the tree structure matching the given tag. The resulting
        *  VirtualModule might have virtual sub-modules, if this EntityOwner contains sub-EntityOwners with
-       *  entities matchting the tag. "tag" is interpreted as a regular expression (see std::regex_match). */
+       *  entities matchting the tag. "tag" is interpreted as a TagQuery, i.e. regular expressions (see
+       *  std::regex_match) combined with the operators "&", "|" and "!". */
       VirtualModule findTag(const std::string &tag) const;
 
       /** Return a VirtualModule containing the part of the tree structure not matching the given tag. This is
        *  the negation of findTag(), this function will keep those variables which findTag() would remove from the
-       *  tree. Again, "tag" is interpreted as a regular expression (see std::regex_match). */
+       *  tree. Again, "tag" is interpreted as a TagQuery. */
       VirtualModule excludeTag(const std::string &tag) const;
 
       /** Called inside the constructor of Accessor: adds the accessor to the list */
-      void registerAccessor(VariableNetworkNode accessor) {
+      virtual void registerAccessor(VariableNetworkNode accessor) {
         for(auto &tag : _tags) accessor.addTag(tag);
         accessorList.push_back(accessor);
       }
 
       /** Called inside the destructor of Accessor: removes the accessor from the list */
-      void unregisterAccessor(VariableNetworkNode accessor) {
+      virtual void unregisterAccessor(VariableNetworkNode accessor) {
         accessorList.remove(accessor);
       }
 
@@ -151,10 +153,11 @@ namespace ChimeraTK {
 
   protected:
 
-      /** Add the part of the tree structure matching the given tag to a VirtualModule. Users normally will use
-       *  findTag() instead. "tag" is interpreted as a regular expression (see std::regex_match). */
-      void findTagAndAppendToModule(VirtualModule &module, const std::string &tag, bool eliminateAllHierarchies=false,
-                                    bool eliminateFirstHierarchy=false, bool negate=false) const;
+      /** Add the part of the tree structure matching the given predicate to a VirtualModule. Users normally will use
+       *  findTag() instead, which passes a predicate evaluating a TagQuery. */
+      void findTagAndAppendToModule(VirtualModule &module, const std::function<bool(const VariableNetworkNode&)> &matches,
+                                    bool eliminateAllHierarchies=false, bool eliminateFirstHierarchy=false,
+                                    bool negate=false) const;
 
       /** The name of this instance */
       std::string _name;
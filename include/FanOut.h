@@ -11,6 +11,7 @@
 #include <mtca4u/NDRegisterAccessor.h>
 
 #include "ApplicationException.h"
+#include "NetworkStatistics.h"
 
 namespace ChimeraTK {
 
@@ -45,12 +46,25 @@ namespace ChimeraTK {
         slaves.push_back(slave);
       }
 
+      /** Set the counters for the updates distributed by this FanOut (see NetworkStatistics). Without counters, the
+       *  updates are not counted. */
+      void setStatisticsCounters(boost::shared_ptr<NetworkStatistics::Counters> counters) {
+        statisticsCounters = counters;
+      }
+
     protected:
 
       boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> impl;
 
       std::list<boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>>> slaves;
 
+      boost::shared_ptr<NetworkStatistics::Counters> statisticsCounters;
+
+      /** Count an update distributed to the slaves, if counters have been set */
+      void countUpdate(bool dataLost) {
+        if(statisticsCounters) statisticsCounters->count(dataLost);
+      }
+
   };
 
 } /* namespace ChimeraTK */
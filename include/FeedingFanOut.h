@@ -107,6 +107,7 @@ namespace ChimeraTK {
           bool ret = slave->doWriteTransfer(versionNumber);
           if(ret) dataLost = true;
         }
+        FanOut<UserType>::countUpdate(dataLost);
         return dataLost;
       }
 
@@ -0,0 +1,114 @@
+/*
+ * FusedElementwiseChain.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_FUSED_ELEMENTWISE_CHAIN_H
+#define CHIMERATK_FUSED_ELEMENTWISE_CHAIN_H
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/thread.hpp>
+
+#include "Application.h"
+#include "InternalModule.h"
+#include "ElementwiseStage.h"
+
+namespace ChimeraTK {
+
+  /** InternalModule executing a chain of ElementwiseStages in a single thread. The input of the first stage and the
+   *  parameters of all stages are read, the operations of all stages are applied in one pass over the values and the
+   *  result is written to the output of the last stage. Arrays are processed in blocks of blockSize elements: each
+   *  block is passed through all stages before the next block is read, so the intermediate values stay in the cache.
+   *  The chain is created by Application::fuseElementwiseChains(). */
+  class FusedElementwiseChain : public InternalModule {
+
+    public:
+
+      /** Number of elements processed by all stages at once */
+      static constexpr size_t blockSize = 1024;
+
+      FusedElementwiseChain(const std::vector<ElementwiseStage*> &stages, const std::string &name)
+      : _stages(stages), _name(name)
+      {
+        assert(_stages.size() > 1);
+        _inputs.push_back(_stages.front()->getStageInputAccessor());
+        for(auto stage : _stages) {
+          auto parameters = stage->getStageParameters();
+          _inputs.insert(_inputs.end(), parameters.begin(), parameters.end());
+        }
+      }
+
+      ~FusedElementwiseChain() {
+        deactivate();
+      }
+
+      void activate() override {
+        assert(!_thread.joinable());
+        _thread = boost::thread([this] { this->run(); });
+      }
+
+      void deactivate() override {
+        if(_thread.joinable()) {
+          _thread.interrupt();
+          _thread.join();
+        }
+        assert(!_thread.joinable());
+      }
+
+      /** Execute the chain. This function is executed in the separate thread. */
+      void run() {
+        Application::registerThread("FusedElementwiseChain "+_name);
+        _schedulingPolicy.apply(Application::threadName());
+        WaitPolicy::currentThread() = _waitPolicy;
+        Application::testableModeLock("start");
+
+        // obtain the initial values. Application::run() does not do this for the accessors of eliminated modules, to
+        // avoid accessing them concurrently with this thread.
+        for(auto &input : _inputs) input.get().readLatest();
+
+        size_t nElements = _stages.front()->getStageNumberOfElements();
+        _values.resize(std::min(nElements, size_t(blockSize)));
+
+        while(true) {
+          // apply all stages block by block (also to the initial values)
+          for(size_t offset = 0; offset < nElements; offset += blockSize) {
+            size_t n = std::min(size_t(blockSize), nElements-offset);
+            _stages.front()->readStageInput(_values.data(), offset, n);
+            for(auto stage : _stages) stage->applyStage(_values.data(), n);
+            _stages.back()->storeStageOutput(_values.data(), offset, n);
+          }
+          _stages.back()->writeStageOutput();
+          for(auto stage : _stages) stage->writeStageSideOutputs();
+
+          // wait for new input values
+          boost::this_thread::interruption_point();
+          Application::readAny(_inputs);
+          boost::this_thread::interruption_point();
+        }
+      }
+
+    protected:
+
+      /** The fused stages in the order of execution */
+      std::vector<ElementwiseStage*> _stages;
+
+      /** Input of the first stage and parameters of all stages */
+      std::list<std::reference_wrapper<TransferElementAbstractor>> _inputs;
+
+      /** Values of the current block passed through the stages */
+      std::vector<double> _values;
+
+      /** Name used for the thread */
+      std::string _name;
+
+      /** Thread executing the chain */
+      boost::thread _thread;
+
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_FUSED_ELEMENTWISE_CHAIN_H */
@@ -12,6 +12,9 @@
 
 #include <ChimeraTK/ControlSystemAdapter/ProcessArray.h>
 
+#include "ThreadSchedulingPolicy.h"
+#include "WaitPolicy.h"
+
 namespace ChimeraTK {
 
   /** Base class for internal modules which are created by the variable connection code
@@ -26,6 +29,24 @@ namespace ChimeraTK {
 
       /** Deactivate synchronisation thread if running*/
       virtual void deactivate() {}
+
+      /** Set the scheduling policy of the synchronisation thread. Must be called before activate(). */
+      void setSchedulingPolicy(const ThreadSchedulingPolicy &policy) { _schedulingPolicy = policy; }
+
+      const ThreadSchedulingPolicy& getSchedulingPolicy() const { return _schedulingPolicy; }
+
+      /** Set the policy how the synchronisation thread waits for new data. Must be called before activate(). */
+      void setWaitPolicy(const WaitPolicy &policy) { _waitPolicy = policy; }
+
+      const WaitPolicy& getWaitPolicy() const { return _waitPolicy; }
+
+    protected:
+
+      /** Scheduling policy applied by the synchronisation thread when it starts */
+      ThreadSchedulingPolicy _schedulingPolicy;
+
+      /** Policy how the synchronisation thread waits for new data */
+      WaitPolicy _waitPolicy;
   };
 
 
@@ -69,7 +69,8 @@ namespace ChimeraTK {
       /** Just call readLatest() on all readable variables in the group. */
       void readAllLatest();
 
-      /** Just call write() on all writable variables in the group. */
+      /** Just call write() on all writable variables in the group. Device writes deferred by the current thread (see
+       *  DeviceWriteBatch) are executed afterwards. */
       void writeAll();
 
       /** Function call operator: Return VariableNetworkNode of the given variable name */
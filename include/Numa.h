@@ -0,0 +1,59 @@
+/*
+ * Numa.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_NUMA_H
+#define CHIMERATK_NUMA_H
+
+#include <cstddef>
+#include <vector>
+
+namespace ChimeraTK {
+
+  /** Helper functions for the placement of threads and memory on NUMA nodes. The topology is read from sysfs and the
+   *  memory policy is set with system calls, so no additional library is needed. On systems without NUMA
+   *  support, there is a single node 0 with all CPUs and the memory functions have no effect. */
+  class Numa {
+
+    public:
+
+      /** Number of NUMA nodes of the system */
+      static int getNumberOfNodes();
+
+      /** CPUs belonging to the given NUMA node. Empty if the node does not exist. */
+      static std::vector<int> getCpusOfNode(int node);
+
+      /** NUMA node of the given CPU, 0 if it cannot be determined */
+      static int getNodeOfCpu(int cpu);
+
+      /** NUMA node of the CPU the calling thread is currently running on */
+      static int getCurrentNode();
+
+      /** NUMA node on which the page containing the given address is allocated. Returns -1 if the page has not been
+       *  touched yet or the node cannot be determined. */
+      static int getNodeOfAddress(const void *address);
+
+      /** While an instance exists, memory first touched by the calling thread is preferably allocated on the given
+       *  NUMA node. Afterwards, the memory policy the calling thread had before is restored, so scopes can be nested.
+       *  A negative node has no effect. */
+      class PreferredNodeScope {
+        public:
+          PreferredNodeScope(int node);
+          ~PreferredNodeScope();
+          PreferredNodeScope(const PreferredNodeScope&) = delete;
+          PreferredNodeScope& operator=(const PreferredNodeScope&) = delete;
+        protected:
+          bool active{false};
+
+          /** Memory policy and node mask of the calling thread before the scope */
+          int savedPolicy{0};
+          std::vector<unsigned long> savedMask;
+      };
+
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_NUMA_H */
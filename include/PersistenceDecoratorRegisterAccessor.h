@@ -0,0 +1,109 @@
+/*
+ * PersistenceDecoratorRegisterAccessor.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_PERSISTENCE_DECORATOR_REGISTER_ACCCESSOR
+#define CHIMERATK_PERSISTENCE_DECORATOR_REGISTER_ACCCESSOR
+
+#include <mtca4u/NDRegisterAccessorDecorator.h>
+
+#include "PersistenceManager.h"
+
+namespace ChimeraTK {
+
+  /** Decorator of the NDRegisterAccessor which keeps the last value transferred through the accessor in the
+   *  PersistenceManager. If the accessor is readable and the loaded snapshot contains a value for it, the first read
+   *  operation returns the value from the snapshot without waiting for the target. A readLatest() prefers a newer
+   *  value already present in the target. See Application::enablePersistence(). */
+  template<typename UserType>
+  class PersistenceDecoratorRegisterAccessor : public mtca4u::NDRegisterAccessorDecorator<UserType> {
+    public:
+      PersistenceDecoratorRegisterAccessor(boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> accessor,
+                                           boost::shared_ptr<PersistenceManager> manager, uint32_t variableId)
+      : mtca4u::NDRegisterAccessorDecorator<UserType>(accessor),
+        _manager(manager), _variableId(variableId), _restoredValue(accessor->getNumberOfSamples())
+      {
+        if(this->isReadable()) _restorePending = _manager->getRestoredValue(_variableId, _restoredValue);
+      }
+
+      void doReadTransfer() override {
+        if(_restorePending) {
+          deliverRestoredValue();
+          return;
+        }
+        _target->doReadTransfer();
+      }
+
+      bool doReadTransferNonBlocking() override {
+        if(_restorePending) {
+          deliverRestoredValue();
+          return true;
+        }
+        return _target->doReadTransferNonBlocking();
+      }
+
+      bool doReadTransferLatest() override {
+        if(_target->doReadTransferLatest()) {
+          // the control system has sent a value already, which supersedes the snapshot
+          _restorePending = false;
+          return true;
+        }
+        if(_restorePending) {
+          deliverRestoredValue();
+          return true;
+        }
+        return false;
+      }
+
+      void doPostRead() override {
+        if(_deliveringRestoredValue) {
+          buffer_2D[0].swap(_restoredValue);
+          _deliveringRestoredValue = false;
+          std::vector<UserType>().swap(_restoredValue);    // no longer needed, release the memory
+        }
+        else {
+          mtca4u::NDRegisterAccessorDecorator<UserType>::doPostRead();
+        }
+        VariableRecorder::serialiseBuffer(_payload, buffer_2D[0]);
+        _manager->update(_variableId, _payload);
+      }
+
+      void doPreWrite() override {
+        // serialise now, since the buffer is swapped into the target afterwards
+        VariableRecorder::serialiseBuffer(_payload, buffer_2D[0]);
+        mtca4u::NDRegisterAccessorDecorator<UserType>::doPreWrite();
+      }
+
+      bool doWriteTransfer(ChimeraTK::VersionNumber versionNumber={}) override {
+        _manager->update(_variableId, _payload);
+        return _target->doWriteTransfer(versionNumber);
+      }
+
+    protected:
+
+      using mtca4u::NDRegisterAccessor<UserType>::buffer_2D;
+      using mtca4u::NDRegisterAccessorDecorator<UserType>::_target;
+
+      /** The next read operation completes with the restored value instead of a value from the target */
+      void deliverRestoredValue() {
+        _restorePending = false;
+        _deliveringRestoredValue = true;
+      }
+
+      boost::shared_ptr<PersistenceManager> _manager;
+      uint32_t _variableId;
+
+      /** Value from the loaded snapshot, until it has been delivered */
+      std::vector<UserType> _restoredValue;
+      bool _restorePending{false};
+      bool _deliveringRestoredValue{false};
+
+      /** Serialised data, kept as a member to avoid memory allocations in each transfer */
+      std::string _payload;
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_PERSISTENCE_DECORATOR_REGISTER_ACCCESSOR */
@@ -0,0 +1,167 @@
+/*
+ * PersistenceManager.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_PERSISTENCE_MANAGER_H
+#define CHIMERATK_PERSISTENCE_MANAGER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <functional>
+#include <cstdint>
+
+#include <boost/thread.hpp>
+
+#include "InternalModule.h"
+#include "VariableRecorder.h"
+
+namespace ChimeraTK {
+
+  /** Persistence of the application state for a fast warm restart. The manager keeps the last value of each
+   *  registered process variable and periodically writes all values into a snapshot file. When the application is
+   *  started again, the values of the control system inputs are restored from the snapshot before the modules start,
+   *  so the application continues with the last settings instead of waiting for the control system to send them.
+   *
+   *  The snapshot is written into a temporary file through a memory mapping, synchronised to the disk and then
+   *  renamed to the final file name. Since the rename is atomic, the snapshot file is always complete, even if the
+   *  application crashes while writing. The file has the following layout (all integers in the native byte order):
+   *
+   *  - the magic string "CTKSNAP1" (8 bytes)
+   *  - uint32 number of entries
+   *  - for each entry: uint8 kind ('V' for process variables, 'S' for module states), string user type name (see
+   *    VariableRecorder::userTypeName(), empty for module states), uint32 number of elements, string name, uint32
+   *    payload size, payload
+   *
+   *  Strings are stored as uint32 length followed by the characters. The payload of process variables is in the
+   *  format of VariableRecorder::serialiseBuffer(), the payload of module states is what the module provided.
+   *
+   *  The manager is normally not used directly but enabled through Application::enablePersistence(). It is an
+   *  InternalModule, so the snapshot thread is started and stopped together with the FanOuts. A final snapshot is
+   *  written when the thread is stopped. */
+  class PersistenceManager : public InternalModule {
+
+    public:
+
+      /** Load the snapshot from the given file, if it exists, and write new snapshots into the same file every
+       *  interval. A malformed snapshot file is ignored with a warning, so the application can still be started. */
+      PersistenceManager(const std::string &fileName, std::chrono::milliseconds interval);
+
+      ~PersistenceManager();
+
+      void activate() override;
+
+      void deactivate() override;
+
+      /** Register a process variable. If the loaded snapshot contains a value for a variable with the same name, user
+       *  type and number of elements, this value is taken as the current value of the variable. Returns the id of
+       *  the variable to be passed to the other functions. */
+      template<typename UserType>
+      uint32_t addVariable(const std::string &name, size_t nElements);
+
+      /** Obtain the value of the given variable from the loaded snapshot. The buffer must already have the right
+       *  size. Returns false if the snapshot did not contain a matching value. */
+      template<typename UserType>
+      bool getRestoredValue(uint32_t variableId, std::vector<UserType> &buffer);
+
+      /** Store the current value of the given variable. The payload must have been serialised with
+       *  VariableRecorder::serialiseBuffer(). This function is thread safe. */
+      void update(uint32_t variableId, const std::string &payload);
+
+      /** Register the internal state of a module under the given name. The save function is called from the snapshot
+       *  thread, so it must synchronise with the module thread itself. The restore function is called with the payload
+       *  from the loaded snapshot by restoreStates(), before the module threads are started. */
+      void registerState(const std::string &name, std::function<std::string()> save,
+                         std::function<void(const std::string&)> restore);
+
+      /** Call the restore functions of all registered module states with a value in the loaded snapshot. */
+      void restoreStates();
+
+      /** Write a snapshot now. Throws ApplicationExceptionWithID<illegalParameter> if the file cannot be written. */
+      void writeSnapshot();
+
+      /** Magic string at the beginning of each snapshot */
+      static constexpr const char *magic = "CTKSNAP1";
+
+    protected:
+
+      /** Entry of the snapshot, used both for the loaded snapshot and for the current values */
+      struct Entry {
+        char kind;
+        std::string typeName;
+        uint32_t nElements;
+        std::string name;
+        std::string payload;
+        bool valid{false};
+      };
+
+      /** Module state registered with registerState() */
+      struct State {
+        std::string name;
+        std::function<std::string()> save;
+        std::function<void(const std::string&)> restore;
+      };
+
+      /** Read the snapshot file into loadedEntries. */
+      void load();
+
+      /** Register a variable, type-independent part of addVariable(). */
+      uint32_t addVariable(const std::string &typeName, const std::string &name, size_t nElements);
+
+      /** Thread writing the snapshots periodically */
+      void run();
+
+      std::string fileName;
+
+      std::chrono::milliseconds interval;
+
+      /** Entries of the loaded snapshot, indexed by the kind and name */
+      std::map<std::pair<char, std::string>, Entry> loadedEntries;
+
+      /** Current values of the registered variables, the index is the variable id. Protected by the mutex. */
+      std::vector<Entry> variables;
+
+      /** Copy of the variables used by writeSnapshot(), so the mutex is only held while copying. The strings keep
+       *  their capacity, so no memory is allocated in subsequent snapshots. Only used in writeSnapshot(). */
+      std::vector<Entry> snapshotCopy;
+
+      /** Counter of updates, used to skip writing snapshots if nothing has changed. Protected by the mutex. */
+      uint64_t updateCounter{0};
+      uint64_t lastWrittenUpdateCounter{0};
+      bool snapshotWritten{false};
+
+      std::vector<State> states;
+
+      std::mutex mutex;
+
+      /** Serialises calls to writeSnapshot() */
+      std::mutex writeMutex;
+
+      boost::thread _thread;
+
+  };
+
+  /*******************************************************************************************************************/
+
+  template<typename UserType>
+  uint32_t PersistenceManager::addVariable(const std::string &name, size_t nElements) {
+    return addVariable(VariableRecorder::userTypeName(typeid(UserType)), name, nElements);
+  }
+
+  /*******************************************************************************************************************/
+
+  template<typename UserType>
+  bool PersistenceManager::getRestoredValue(uint32_t variableId, std::vector<UserType> &buffer) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto &entry = variables.at(variableId);
+    if(!entry.valid) return false;
+    return VariableRecorder::deserialiseBuffer(entry.payload.data(), entry.payload.size(), buffer);
+  }
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_PERSISTENCE_MANAGER_H */
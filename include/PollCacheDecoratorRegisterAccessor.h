@@ -0,0 +1,130 @@
+/*
+ * PollCacheDecoratorRegisterAccessor.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_POLL_CACHE_DECORATOR_REGISTER_ACCCESSOR
+#define CHIMERATK_POLL_CACHE_DECORATOR_REGISTER_ACCCESSOR
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+
+#include <mtca4u/NDRegisterAccessorDecorator.h>
+
+namespace ChimeraTK {
+
+  /** Type-independent part of a PollCacheEntry, holding the counters of the cache */
+  struct PollCacheEntryBase {
+    PollCacheEntryBase(const std::string &name, std::chrono::microseconds maxAge) : name(name), maxAge(maxAge) {}
+    virtual ~PollCacheEntryBase() {}
+
+    /** Name of the register, in the form "/Device/<alias>/<register>" */
+    const std::string name;
+
+    /** Maximum age of a cached value, measured from the start of the transfer which has obtained the value */
+    const std::chrono::steady_clock::duration maxAge;
+
+    /** Number of polls served from the cache */
+    boost::shared_ptr<std::atomic<uint64_t>> hits{boost::make_shared<std::atomic<uint64_t>>(0)};
+
+    /** Number of polls which required a transfer from the device */
+    boost::shared_ptr<std::atomic<uint64_t>> misses{boost::make_shared<std::atomic<uint64_t>>(0)};
+  };
+
+  /*******************************************************************************************************************/
+
+  /** Cache of a poll-type device register shared by all PollCacheDecoratorRegisterAccessors of the register. The
+   *  register is read from the device only if the cached value is older than the maximum age. A poll which arrives
+   *  while another thread is reading the register waits for this transfer and uses its value, if the transfer has
+   *  started after the poll was requested (less the maximum age). So concurrent polls are coalesced into a single
+   *  transfer even with a maximum age of 0. */
+  template<typename UserType>
+  class PollCacheEntry : public PollCacheEntryBase {
+    public:
+      PollCacheEntry(const std::string &name, boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> accessor,
+                     std::chrono::microseconds maxAge)
+      : PollCacheEntryBase(name, maxAge), accessor(accessor)
+      {}
+
+      /** Make sure the cached value is not older than the maximum age, relative to the given request time */
+      void update(std::chrono::steady_clock::time_point requestTime) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(hasValue && lastTransferStarted+maxAge >= requestTime) {
+          ++(*hits);
+          return;
+        }
+        lastTransferStarted = std::chrono::steady_clock::now();
+        accessor->read();
+        hasValue = true;
+        ++(*misses);
+      }
+
+      /** Copy the cached value into the given buffer */
+      void copyTo(std::vector<std::vector<UserType>> &buffer) {
+        std::lock_guard<std::mutex> lock(mutex);
+        for(size_t i=0; i<buffer.size(); ++i) buffer[i] = accessor->accessChannel(i);
+      }
+
+    protected:
+
+      /** Accessor of the register, only used with the mutex held */
+      boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> accessor;
+
+      std::mutex mutex;
+
+      /** Start time of the last transfer and flag whether a value has been read yet, protected by the mutex */
+      std::chrono::steady_clock::time_point lastTransferStarted;
+      bool hasValue{false};
+  };
+
+  /*******************************************************************************************************************/
+
+  /** Decorator of a poll-type device register accessor which reads the value through the given PollCacheEntry
+   *  instead of reading the target directly. Each consumer of the register has its own decorator, since the buffers
+   *  of the decorators are owned by the consumers. See Application::enablePollCache(). */
+  template<typename UserType>
+  class PollCacheDecoratorRegisterAccessor : public mtca4u::NDRegisterAccessorDecorator<UserType> {
+    public:
+      PollCacheDecoratorRegisterAccessor(boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> accessor,
+                                         boost::shared_ptr<PollCacheEntry<UserType>> entry)
+      : mtca4u::NDRegisterAccessorDecorator<UserType>(accessor), _entry(entry)
+      {}
+
+      // the target itself is never transferred, the value is obtained through the cache entry
+      void doPreRead() override {}
+
+      void doReadTransfer() override {
+        _entry->update(std::chrono::steady_clock::now());
+      }
+
+      bool doReadTransferNonBlocking() override {
+        doReadTransfer();
+        return true;
+      }
+
+      bool doReadTransferLatest() override {
+        doReadTransfer();
+        return true;
+      }
+
+      void doPostRead() override {
+        _entry->copyTo(buffer_2D);
+      }
+
+    protected:
+
+      using mtca4u::NDRegisterAccessor<UserType>::buffer_2D;
+
+      boost::shared_ptr<PollCacheEntry<UserType>> _entry;
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_POLL_CACHE_DECORATOR_REGISTER_ACCCESSOR */
@@ -12,6 +12,8 @@
 #include <atomic>
 #include <chrono>
 #include <list>
+#include <vector>
+#include <algorithm>
 #include <mutex>
 #include <assert.h>
 
@@ -21,6 +23,18 @@ namespace ChimeraTK {
 
     public:
 
+      /** Interface to observe the active phases of a thread, e.g. to monitor deadlines (see DeadlineMonitor). An
+       *  active phase (or cycle) starts when the thread wakes up from waiting for data and ends when it starts waiting
+       *  again. */
+      class CycleObserver {
+        public:
+          virtual ~CycleObserver() {}
+
+          /** Called in the observed thread at the end of each active phase with its duration and the current time */
+          virtual void cycleCompleted(std::chrono::high_resolution_clock::duration cycleTime,
+                                      std::chrono::high_resolution_clock::time_point now) = 0;
+      };
+
       class ThreadData {
 
         public:
@@ -38,6 +52,17 @@ namespace ChimeraTK {
             return time;
           }
 
+          /** Return the integrated time the thread spent spinning while waiting for data in microseconds (see
+           *  WaitPolicy). This time is not included in the active time. */
+          uint64_t getIntegratedSpinTime() const { return integratedSpinTime; }
+
+          /** Return the integrated spin time of the thread in microseconds and atomically reset the counter to 0. */
+          uint64_t getAndResetIntegratedSpinTime() {
+            uint64_t time = integratedSpinTime;
+            integratedSpinTime.fetch_sub(time);
+            return time;
+          }
+
         private:
 
           friend class Profiler;
@@ -54,6 +79,18 @@ namespace ChimeraTK {
           /** Integrated time this thread was active in microseconds */
           std::atomic<uint64_t> integratedTime;
 
+          /** Reference point for the measurement of the spin time */
+          std::chrono::high_resolution_clock::time_point lastSpinStarted;
+
+          /** Flag whether this thread is currently spinning */
+          bool isSpinning{false};
+
+          /** Integrated time this thread was spinning in microseconds */
+          std::atomic<uint64_t> integratedSpinTime;
+
+          /** Observers of the active phases of this thread */
+          std::vector<CycleObserver*> cycleObservers;
+
       };
 
       /** Register a thread in the profiler. This function must be called in each thread before calling
@@ -83,10 +120,44 @@ namespace ChimeraTK {
       /** Stop the time measurement for the current thread. Call this right before putting the thread to sleep e.g.
        *  before a blocking read. */
       static void stopMeasurement() {
-        if(!getThreadData().isActive) return;
-        getThreadData().isActive = false;
-        auto duration = std::chrono::high_resolution_clock::now() - getThreadData().lastActiated;
-        getThreadData().integratedTime += std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+        auto &data = getThreadData();
+        if(!data.isActive) return;
+        data.isActive = false;
+        auto now = std::chrono::high_resolution_clock::now();
+        auto duration = now - data.lastActiated;
+        data.integratedTime += std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+        // iterate by index, since observers may add further observers (e.g. DeadlineMonitor -> DeviceWriteBatch)
+        for(size_t i=0; i<data.cycleObservers.size(); ++i) data.cycleObservers[i]->cycleCompleted(duration, now);
+      }
+
+      /** Add an observer of the active phases of the current thread. The observer must outlive the thread or be
+       *  removed before it is destroyed. */
+      static void addCycleObserver(CycleObserver *observer) {
+        getThreadData().cycleObservers.push_back(observer);
+      }
+
+      /** Remove an observer added with addCycleObserver() from the current thread */
+      static void removeCycleObserver(CycleObserver *observer) {
+        auto &observers = getThreadData().cycleObservers;
+        observers.erase(std::remove(observers.begin(), observers.end(), observer), observers.end());
+      }
+
+      /** Start the measurement of the spin time for the current thread. Call this before busy waiting for data. The
+       *  active time measurement is stopped. */
+      static void startSpinning() {
+        if(getThreadData().isSpinning) return;
+        stopMeasurement();
+        getThreadData().isSpinning = true;
+        getThreadData().lastSpinStarted = std::chrono::high_resolution_clock::now();
+      }
+
+      /** Stop the measurement of the spin time for the current thread. Call startMeasurement() afterwards if data has
+       *  been received, or block without restarting the active time measurement otherwise. */
+      static void stopSpinning() {
+        if(!getThreadData().isSpinning) return;
+        getThreadData().isSpinning = false;
+        auto duration = std::chrono::high_resolution_clock::now() - getThreadData().lastSpinStarted;
+        getThreadData().integratedSpinTime += std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
       }
 
     private:
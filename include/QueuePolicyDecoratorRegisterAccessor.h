@@ -0,0 +1,119 @@
+/*
+ * QueuePolicyDecoratorRegisterAccessor.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_QUEUE_POLICY_DECORATOR_REGISTER_ACCCESSOR
+#define CHIMERATK_QUEUE_POLICY_DECORATOR_REGISTER_ACCCESSOR
+
+#include <atomic>
+
+#include <boost/thread.hpp>
+
+#include <mtca4u/NDRegisterAccessorDecorator.h>
+
+#include "VariableNetwork.h"
+#include "Profiler.h"
+
+namespace ChimeraTK {
+
+  /** Fill level of a queue between a QueueSenderDecoratorRegisterAccessor and a
+   *  QueueReceiverDecoratorRegisterAccessor, shared by both ends. */
+  struct QueueFillLevel {
+    QueueFillLevel(const QueuePolicy &policy) : policy(policy), depth(policy.getEffectiveDepth()) {}
+
+    const QueuePolicy policy;
+    const size_t depth;
+
+    /** Number of values sent but not yet received */
+    std::atomic<size_t> fill{0};
+
+    /** Mutex and condition variable to wake up a blocked sender */
+    boost::mutex mutex;
+    boost::condition_variable notFull;
+
+    /** Called by the receiver after a value has been received */
+    void valueReceived() {
+      size_t current = fill;
+      while(current > 0 && !fill.compare_exchange_weak(current, current-1)) {}
+      if(policy.overflow == QueuePolicy::Overflow::block) {
+        boost::lock_guard<boost::mutex> lock(mutex);
+        notFull.notify_one();
+      }
+    }
+  };
+
+  /*******************************************************************************************************************/
+
+  /** Decorator of the sending end of a queue, applying the overflow policy of the QueuePolicy. */
+  template<typename UserType>
+  class QueueSenderDecoratorRegisterAccessor : public mtca4u::NDRegisterAccessorDecorator<UserType> {
+    public:
+      QueueSenderDecoratorRegisterAccessor(boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> accessor,
+                                           boost::shared_ptr<QueueFillLevel> fillLevel)
+      : mtca4u::NDRegisterAccessorDecorator<UserType>(accessor), _fillLevel(fillLevel)
+      {}
+
+      bool doWriteTransfer(ChimeraTK::VersionNumber versionNumber={}) override {
+        auto &level = *_fillLevel;
+        if(level.fill >= level.depth) {
+          if(level.policy.overflow == QueuePolicy::Overflow::dropNewest) return true;
+          if(level.policy.overflow == QueuePolicy::Overflow::block) {
+            // the wait is an interruption point, so the thread can still be terminated
+            boost::unique_lock<boost::mutex> lock(level.mutex);
+            Profiler::stopMeasurement();
+            while(level.fill >= level.depth) level.notFull.wait(lock);
+            Profiler::startMeasurement();
+          }
+        }
+        bool dataLost = _target->doWriteTransfer(versionNumber);
+        if(!dataLost) ++level.fill;
+        return dataLost;
+      }
+
+    protected:
+
+      using mtca4u::NDRegisterAccessorDecorator<UserType>::_target;
+
+      boost::shared_ptr<QueueFillLevel> _fillLevel;
+  };
+
+  /*******************************************************************************************************************/
+
+  /** Decorator of the receiving end of a queue, tracking the fill level for the QueueSenderDecoratorRegisterAccessor.
+   *  The fill level is decremented in doPostRead(), which is also called after asynchronous reads (e.g. readAny()). */
+  template<typename UserType>
+  class QueueReceiverDecoratorRegisterAccessor : public mtca4u::NDRegisterAccessorDecorator<UserType> {
+    public:
+      QueueReceiverDecoratorRegisterAccessor(boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> accessor,
+                                             boost::shared_ptr<QueueFillLevel> fillLevel)
+      : mtca4u::NDRegisterAccessorDecorator<UserType>(accessor), _fillLevel(fillLevel)
+      {}
+
+      bool doReadTransferLatest() override {
+        bool newData = _target->doReadTransferLatest();
+        if(!newData) return false;
+
+        // the queue has been emptied. Reduce the fill level only to 1, since it will be decremented in doPostRead().
+        auto &level = *_fillLevel;
+        size_t current = level.fill;
+        while(current > 1 && !level.fill.compare_exchange_weak(current, 1)) {}
+        return true;
+      }
+
+      void doPostRead() override {
+        _fillLevel->valueReceived();
+        mtca4u::NDRegisterAccessorDecorator<UserType>::doPostRead();
+      }
+
+    protected:
+
+      using mtca4u::NDRegisterAccessorDecorator<UserType>::_target;
+
+      boost::shared_ptr<QueueFillLevel> _fillLevel;
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_QUEUE_POLICY_DECORATOR_REGISTER_ACCCESSOR */
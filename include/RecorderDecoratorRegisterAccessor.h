@@ -0,0 +1,59 @@
+/*
+ * RecorderDecoratorRegisterAccessor.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_RECORDER_DECORATOR_REGISTER_ACCCESSOR
+#define CHIMERATK_RECORDER_DECORATOR_REGISTER_ACCCESSOR
+
+#include <mtca4u/NDRegisterAccessorDecorator.h>
+
+#include "VariableRecorder.h"
+
+namespace ChimeraTK {
+
+  /** Decorator of the NDRegisterAccessor which records all values transferred through the accessor with the given
+   *  VariableRecorder. Received values are recorded after each successful read, sent values right before the
+   *  transfer. See Application::enableVariableRecording(). */
+  template<typename UserType>
+  class RecorderDecoratorRegisterAccessor : public mtca4u::NDRegisterAccessorDecorator<UserType> {
+    public:
+      RecorderDecoratorRegisterAccessor(boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> accessor,
+                                        boost::shared_ptr<VariableRecorder> recorder, uint32_t variableId)
+      : mtca4u::NDRegisterAccessorDecorator<UserType>(accessor),
+        _recorder(recorder), _variableId(variableId)
+      {}
+
+      void doPostRead() override {
+        mtca4u::NDRegisterAccessorDecorator<UserType>::doPostRead();
+        VariableRecorder::serialiseBuffer(_payload, buffer_2D[0]);
+        _recorder->commit(_variableId, this->getVersionNumber(), _payload);
+      }
+
+      void doPreWrite() override {
+        // serialise now, since the buffer is swapped into the target afterwards
+        VariableRecorder::serialiseBuffer(_payload, buffer_2D[0]);
+        mtca4u::NDRegisterAccessorDecorator<UserType>::doPreWrite();
+      }
+
+      bool doWriteTransfer(ChimeraTK::VersionNumber versionNumber={}) override {
+        _recorder->commit(_variableId, versionNumber, _payload);
+        return _target->doWriteTransfer(versionNumber);
+      }
+
+    protected:
+
+      using mtca4u::NDRegisterAccessor<UserType>::buffer_2D;
+      using mtca4u::NDRegisterAccessorDecorator<UserType>::_target;
+
+      boost::shared_ptr<VariableRecorder> _recorder;
+      uint32_t _variableId;
+
+      /** Serialised data, kept as a member to avoid memory allocations in each transfer */
+      std::string _payload;
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_RECORDER_DECORATOR_REGISTER_ACCCESSOR */
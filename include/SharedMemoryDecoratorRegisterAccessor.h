@@ -0,0 +1,50 @@
+/*
+ * SharedMemoryDecoratorRegisterAccessor.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_SHARED_MEMORY_DECORATOR_REGISTER_ACCCESSOR
+#define CHIMERATK_SHARED_MEMORY_DECORATOR_REGISTER_ACCCESSOR
+
+#include <mtca4u/NDRegisterAccessorDecorator.h>
+
+#include "SharedMemoryPublisher.h"
+
+namespace ChimeraTK {
+
+  /** Decorator of the NDRegisterAccessor which publishes each value transferred through the accessor in the slot of
+   *  the SharedMemoryPublisher. See Application::enableSharedMemoryPublication(). */
+  template<typename UserType>
+  class SharedMemoryDecoratorRegisterAccessor : public mtca4u::NDRegisterAccessorDecorator<UserType> {
+    public:
+      SharedMemoryDecoratorRegisterAccessor(boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> accessor,
+                                            boost::shared_ptr<SharedMemoryPublisher> publisher,
+                                            SharedMemoryPublisher::Slot slot)
+      : mtca4u::NDRegisterAccessorDecorator<UserType>(accessor), _publisher(publisher), _slot(slot)
+      {}
+
+      void doPostRead() override {
+        mtca4u::NDRegisterAccessorDecorator<UserType>::doPostRead();
+        SharedMemoryPublisher::publish(_slot, buffer_2D[0]);
+      }
+
+      void doPreWrite() override {
+        // publish now, since the buffer is swapped into the target afterwards
+        SharedMemoryPublisher::publish(_slot, buffer_2D[0]);
+        mtca4u::NDRegisterAccessorDecorator<UserType>::doPreWrite();
+      }
+
+    protected:
+
+      using mtca4u::NDRegisterAccessor<UserType>::buffer_2D;
+
+      /** Keeps the segment mapped as long as the accessor exists */
+      boost::shared_ptr<SharedMemoryPublisher> _publisher;
+
+      SharedMemoryPublisher::Slot _slot;
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_SHARED_MEMORY_DECORATOR_REGISTER_ACCCESSOR */
@@ -0,0 +1,265 @@
+/*
+ * SharedMemoryPublisher.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_SHARED_MEMORY_PUBLISHER_H
+#define CHIMERATK_SHARED_MEMORY_PUBLISHER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <cstring>
+#include <cstdint>
+#include <type_traits>
+#include <typeinfo>
+
+#include "ApplicationException.h"
+#include "VariableRecorder.h"
+
+namespace ChimeraTK {
+
+  /** Layout of the shared memory segment written by the SharedMemoryPublisher and read by the SharedMemoryReader. All
+   *  offsets are relative to the beginning of the segment, all integers are in the native byte order. */
+  namespace SharedMemoryLayout {
+
+    /** Header at the beginning of the segment */
+    struct Header {
+      /** The magic string "CTKSHM01", written last when the segment has been initialised */
+      char magic[8];
+      uint64_t segmentSize;
+      uint64_t directoryOffset;
+      uint32_t maxEntries;
+      /** Number of valid entries in the directory. Entries are complete before this number is incremented. */
+      std::atomic<uint32_t> nEntries;
+    };
+
+    /** Entry of the directory, one per process variable */
+    struct DirectoryEntry {
+      /** User type name as returned by VariableRecorder::userTypeName(), zero padded */
+      char typeName[8];
+      uint32_t nElements;
+      uint32_t nameLength;
+      uint64_t nameOffset;
+      uint64_t slotOffset;
+      /** Number of bytes available for the payload behind the SlotHeader */
+      uint64_t capacity;
+    };
+
+    /** Header of the slot holding the value of a process variable. The payload follows directly and has the format
+     *  of VariableRecorder::serialiseBuffer(). */
+    struct SlotHeader {
+      /** Sequence counter of the seqlock: odd while the slot is written, incremented by two per update */
+      std::atomic<uint64_t> sequence;
+      uint64_t payloadSize;
+      /** Number of updates which did not fit into the slot (only possible for strings) */
+      uint64_t droppedUpdates;
+    };
+
+    static_assert(sizeof(Header) == 32 && sizeof(DirectoryEntry) == 40 && sizeof(SlotHeader) == 24,
+                  "Unexpected padding in the layout of the shared memory segment.");
+    static_assert(ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_LLONG_LOCK_FREE == 2,
+                  "Atomics in shared memory must be lock free.");
+
+    /** Magic string at the beginning of the segment */
+    static constexpr const char *magic = "CTKSHM01";
+
+  } /* namespace SharedMemoryLayout */
+
+  /*******************************************************************************************************************/
+
+  /** Publication of the control system variables in a POSIX shared memory segment, so tools on the same host can read
+   *  the latest values without going through the control system and without any interaction with the application
+   *  threads. The publisher mirrors the process variables created by the PVManager, it does not replace it.
+   *
+   *  The segment contains a header, a directory with one entry per variable and one slot per variable holding the
+   *  latest value (see SharedMemoryLayout). Each slot is protected by a seqlock: the writer increments the sequence
+   *  counter before and after writing the value, a reader copies the value and retries if the counter was odd or has
+   *  changed meanwhile. Writers never wait for readers, and readers never block the writers. Slots have a fixed
+   *  capacity, so string values longer than the maximum string length are not published and counted as dropped
+   *  instead.
+   *
+   *  The segment is removed when the publisher is destroyed. Readers which still have it mapped keep their mapping.
+   *
+   *  The publisher is normally not used directly but enabled through Application::enableSharedMemoryPublication().
+   *  Use the SharedMemoryReader to read the values. */
+  class SharedMemoryPublisher {
+
+    public:
+
+      /** Slot of a variable, as returned by addVariable() */
+      struct Slot {
+        SharedMemoryLayout::SlotHeader *header;
+        char *payload;
+        uint64_t capacity;
+      };
+
+      /** Create the shared memory segment with the given name (must start with a slash, see shm_open()) and size. An
+       *  existing segment with the same name is replaced. Throws ApplicationExceptionWithID<illegalParameter> if the
+       *  segment cannot be created. */
+      SharedMemoryPublisher(const std::string &segmentName, size_t segmentSize, size_t maxVariables,
+                            size_t maxStringLength);
+
+      ~SharedMemoryPublisher();
+
+      /** Add a variable to the directory and allocate its slot. Throws ApplicationExceptionWithID<illegalParameter>
+       *  if the segment is full. This function is thread safe. */
+      template<typename UserType>
+      Slot addVariable(const std::string &name, size_t nElements);
+
+      /** Write the value into the slot. Each slot must only be written by one thread at a time. */
+      template<typename UserType>
+      static void publish(const Slot &slot, const std::vector<UserType> &buffer);
+
+    protected:
+
+      /** Type-independent part of addVariable() */
+      Slot addVariable(const std::string &typeName, const std::string &name, size_t nElements, size_t capacity);
+
+      /** Start and finish writing a slot (seqlock write side) */
+      static void beginWrite(const Slot &slot);
+      static void endWrite(const Slot &slot);
+
+      std::string segmentName;
+
+      size_t segmentSize;
+
+      size_t maxStringLength;
+
+      /** The mapped segment */
+      char *segment{nullptr};
+
+      /** Offset of the next free byte behind the directory */
+      uint64_t nextFreeOffset;
+
+      /** Serialises calls to addVariable() */
+      std::mutex mutex;
+
+  };
+
+  /*******************************************************************************************************************/
+
+  /** Reader for the shared memory segment written by the SharedMemoryPublisher. Reading does not require any
+   *  interaction with the application, a value is copied from its slot and the copy is repeated if the value has been
+   *  updated meanwhile. The reader is not thread safe, use one instance per thread. */
+  class SharedMemoryReader {
+
+    public:
+
+      /** Meta data of a published variable */
+      struct VariableInfo {
+        std::string name;
+        std::string typeName;
+        size_t nElements;
+      };
+
+      /** Map the segment with the given name read-only. Throws ApplicationExceptionWithID<illegalParameter> if the
+       *  segment does not exist or has not been created by the SharedMemoryPublisher. */
+      SharedMemoryReader(const std::string &segmentName);
+
+      ~SharedMemoryReader();
+
+      /** Obtain the list of published variables. Variables added after the reader has been created are included. */
+      std::vector<VariableInfo> getVariables();
+
+      /** Read the latest value of the given variable into the buffer, which is resized to the number of elements.
+       *  Returns false if the variable does not exist or has not received a value yet. If updateCounter is given, the
+       *  number of updates of the variable so far is stored there, so new values can be detected. Throws
+       *  ApplicationExceptionWithID<illegalParameter> if the user type does not match the published type. */
+      template<typename UserType>
+      bool read(const std::string &name, std::vector<UserType> &buffer, uint64_t *updateCounter=nullptr);
+
+      /** Number of updates of the given variable which have been dropped since the value did not fit into the slot */
+      uint64_t getDroppedUpdates(const std::string &name);
+
+    protected:
+
+      /** Add the directory entries which have been published since the last call to the index */
+      void updateIndex();
+
+      /** Find the directory entry of the given variable, nullptr if it does not exist */
+      const SharedMemoryLayout::DirectoryEntry* findEntry(const std::string &name);
+
+      /** Copy the payload of the slot consistently into the given string. Returns the sequence number of the copy. */
+      uint64_t copyPayload(const SharedMemoryLayout::DirectoryEntry &entry, std::string &payload);
+
+      const char *segment{nullptr};
+
+      size_t segmentSize{0};
+
+      /** Index of the directory entries by name */
+      std::map<std::string, const SharedMemoryLayout::DirectoryEntry*> index;
+      uint32_t nIndexedEntries{0};
+
+      /** Buffer for the payload, kept to avoid memory allocations */
+      std::string payload;
+
+  };
+
+  /*******************************************************************************************************************/
+
+  template<typename UserType>
+  SharedMemoryPublisher::Slot SharedMemoryPublisher::addVariable(const std::string &name, size_t nElements) {
+    // strings are stored with their length, so the capacity depends on the maximum string length
+    size_t elementSize = std::is_same<UserType, std::string>::value ? sizeof(uint32_t)+maxStringLength
+                                                                    : sizeof(UserType);
+    return addVariable(VariableRecorder::userTypeName(typeid(UserType)), name, nElements, nElements*elementSize);
+  }
+
+  /*******************************************************************************************************************/
+
+  template<typename UserType>
+  void SharedMemoryPublisher::publish(const Slot &slot, const std::vector<UserType> &buffer) {
+    // numeric values are copied directly into the slot
+    beginWrite(slot);
+    size_t size = buffer.size()*sizeof(UserType);
+    std::memcpy(slot.payload, buffer.data(), size);
+    slot.header->payloadSize = size;
+    endWrite(slot);
+  }
+
+  template<>
+  inline void SharedMemoryPublisher::publish<std::string>(const Slot &slot, const std::vector<std::string> &buffer) {
+    size_t size = 0;
+    for(auto &value : buffer) size += sizeof(uint32_t) + value.size();
+    beginWrite(slot);
+    if(size > slot.capacity) {
+      ++(slot.header->droppedUpdates);
+    }
+    else {
+      char *position = slot.payload;
+      for(auto &value : buffer) {
+        uint32_t length = value.size();
+        std::memcpy(position, &length, sizeof(length));
+        position += sizeof(length);
+        std::memcpy(position, value.data(), length);
+        position += length;
+      }
+      slot.header->payloadSize = size;
+    }
+    endWrite(slot);
+  }
+
+  /*******************************************************************************************************************/
+
+  template<typename UserType>
+  bool SharedMemoryReader::read(const std::string &name, std::vector<UserType> &buffer, uint64_t *updateCounter) {
+    auto entry = findEntry(name);
+    if(!entry) return false;
+    if(VariableRecorder::userTypeName(typeid(UserType)) != entry->typeName) {
+      throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+          "The variable '"+name+"' in shared memory has the type '"+entry->typeName+"'.");
+    }
+    uint64_t sequence = copyPayload(*entry, payload);
+    if(updateCounter) *updateCounter = sequence/2;
+    if(sequence == 0) return false;
+    buffer.resize(entry->nElements);
+    return VariableRecorder::deserialiseBuffer(payload.data(), payload.size(), buffer);
+  }
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_SHARED_MEMORY_PUBLISHER_H */
@@ -0,0 +1,145 @@
+/*
+ * StaticConnection.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_STATIC_CONNECTION_H
+#define CHIMERATK_STATIC_CONNECTION_H
+
+#include <type_traits>
+
+#include "Application.h"
+#include "ScalarAccessor.h"
+#include "ArrayAccessor.h"
+
+namespace ChimeraTK {
+
+  /** Compile-time properties of the accessor types which can be used in a StaticConnection. Only the convenience
+   *  accessor classes (ScalarOutput, ScalarPushInput, ArrayPollInput etc.) are supported. */
+  template<typename ACCESSOR>
+  struct StaticAccessorTraits {
+    static constexpr bool isAccessor = false;
+    typedef void ValueType;
+    static constexpr VariableDirection direction = VariableDirection::invalid;
+    static constexpr UpdateMode mode = UpdateMode::invalid;
+  };
+
+  namespace detail {
+    template<typename UserType, VariableDirection DIRECTION, UpdateMode MODE>
+    struct StaticAccessorTraitsBase {
+      static constexpr bool isAccessor = true;
+      typedef UserType ValueType;
+      static constexpr VariableDirection direction = DIRECTION;
+      static constexpr UpdateMode mode = MODE;
+    };
+
+    /** Helper to check a condition for all elements of a parameter pack */
+    constexpr bool allTrue() { return true; }
+    template<typename... BOOLS>
+    constexpr bool allTrue(bool first, BOOLS... rest) { return first && allTrue(rest...); }
+  }
+
+  template<typename UserType>
+  struct StaticAccessorTraits<ScalarOutput<UserType>>
+  : detail::StaticAccessorTraitsBase<UserType, VariableDirection::feeding, UpdateMode::push> {};
+  template<typename UserType>
+  struct StaticAccessorTraits<ScalarPushInput<UserType>>
+  : detail::StaticAccessorTraitsBase<UserType, VariableDirection::consuming, UpdateMode::push> {};
+  template<typename UserType>
+  struct StaticAccessorTraits<ScalarPollInput<UserType>>
+  : detail::StaticAccessorTraitsBase<UserType, VariableDirection::consuming, UpdateMode::poll> {};
+  template<typename UserType>
+  struct StaticAccessorTraits<ArrayOutput<UserType>>
+  : detail::StaticAccessorTraitsBase<UserType, VariableDirection::feeding, UpdateMode::push> {};
+  template<typename UserType>
+  struct StaticAccessorTraits<ArrayPushInput<UserType>>
+  : detail::StaticAccessorTraitsBase<UserType, VariableDirection::consuming, UpdateMode::push> {};
+  template<typename UserType>
+  struct StaticAccessorTraits<ArrayPollInput<UserType>>
+  : detail::StaticAccessorTraitsBase<UserType, VariableDirection::consuming, UpdateMode::poll> {};
+
+  /*******************************************************************************************************************/
+
+  /** Declaration of a connection between application accessors whose topology is known at compile time. The legality
+   *  of the connection (exactly one feeder, only consumers otherwise, identical UserTypes) is checked at compile
+   *  time. The network is then created at runtime by Application::typedMakeConnection() like any other network, only
+   *  the lookup of this function by the value type in Application::makeConnectionsForNetwork() is skipped.
+   *
+   *  Use the function connectStatic() inside Application::defineConnections() instead of this class directly:
+   *
+   *    ctk::connectStatic(producer.output, consumerA.input, consumerB.input);
+   *
+   *  The accessors must not be connected to anything else before. Connecting further nodes (e.g. control system
+   *  variables) to the resulting network afterwards is still possible. */
+  template<typename FEEDER, typename... CONSUMERS>
+  class StaticConnection {
+
+    public:
+
+      typedef typename StaticAccessorTraits<FEEDER>::ValueType UserType;
+
+      static_assert(StaticAccessorTraits<FEEDER>::isAccessor &&
+                    detail::allTrue(StaticAccessorTraits<CONSUMERS>::isAccessor...),
+                    "StaticConnection can only be used with ScalarOutput, ScalarPushInput, ScalarPollInput, "
+                    "ArrayOutput, ArrayPushInput and ArrayPollInput.");
+      static_assert(sizeof...(CONSUMERS) > 0, "A StaticConnection needs at least one consumer.");
+      static_assert(StaticAccessorTraits<FEEDER>::direction == VariableDirection::feeding,
+                    "The first accessor of a StaticConnection must be an output.");
+      static_assert(detail::allTrue(StaticAccessorTraits<CONSUMERS>::direction == VariableDirection::consuming...),
+                    "A StaticConnection can have only one output, all other accessors must be inputs.");
+      static_assert(detail::allTrue(std::is_same<typename StaticAccessorTraits<CONSUMERS>::ValueType,
+                                                 UserType>::value...),
+                    "All accessors of a StaticConnection must have the same UserType.");
+
+      /** Number of consumers in the network */
+      static constexpr size_t nConsumers = sizeof...(CONSUMERS);
+
+      /** Create the network in the Application and return it */
+      static VariableNetwork& connect(FEEDER &feeder, CONSUMERS&... consumers) {
+        // check that none of the nodes is connected yet, before modifying anything
+        int checks[] = { checkUnconnected(feeder), checkUnconnected(consumers)... };
+        (void)checks;
+
+        VariableNetwork &network = Application::getInstance().createNetwork();
+        int adds[] = { addNode(network, feeder), addNode(network, consumers)... };
+        (void)adds;
+
+        network.setTypedMakeConnection(&Application::typedMakeConnection<UserType>);
+        return network;
+      }
+
+    protected:
+
+      template<typename ACCESSOR>
+      static int checkUnconnected(ACCESSOR &accessor) {
+        VariableNetworkNode node = accessor;
+        if(node.hasOwner()) {
+          throw ApplicationExceptionWithID<ApplicationExceptionID::illegalVariableNetwork>(
+              "The accessor '"+node.getQualifiedName()+"' is already connected and cannot be used in a "
+              "StaticConnection.");
+        }
+        return 0;
+      }
+
+      template<typename ACCESSOR>
+      static int addNode(VariableNetwork &network, ACCESSOR &accessor) {
+        VariableNetworkNode node = accessor;
+        network.addNode(node);
+        return 0;
+      }
+
+  };
+
+  /*******************************************************************************************************************/
+
+  /** Connect the given feeding application accessor with the given consuming application accessors. See
+   *  StaticConnection for details. */
+  template<typename FEEDER, typename... CONSUMERS>
+  VariableNetwork& connectStatic(FEEDER &feeder, CONSUMERS&... consumers) {
+    return StaticConnection<FEEDER, CONSUMERS...>::connect(feeder, consumers...);
+  }
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_STATIC_CONNECTION_H */
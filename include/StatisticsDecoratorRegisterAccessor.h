@@ -0,0 +1,48 @@
+/*
+ * StatisticsDecoratorRegisterAccessor.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_STATISTICS_DECORATOR_REGISTER_ACCCESSOR
+#define CHIMERATK_STATISTICS_DECORATOR_REGISTER_ACCCESSOR
+
+#include <mtca4u/NDRegisterAccessorDecorator.h>
+
+#include "NetworkStatistics.h"
+
+namespace ChimeraTK {
+
+  /** Decorator of the NDRegisterAccessor which counts the values written or read in the given counters of the
+   *  NetworkStatistics. Used for the application variables which are connected directly, i.e. without a FanOut. A
+   *  write is counted as lost if the target reports data loss. Reads are counted in doPostRead(), which is also
+   *  called after asynchronous reads (e.g. readAny()). */
+  template<typename UserType>
+  class StatisticsDecoratorRegisterAccessor : public mtca4u::NDRegisterAccessorDecorator<UserType> {
+    public:
+      StatisticsDecoratorRegisterAccessor(boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> accessor,
+                                          boost::shared_ptr<NetworkStatistics::Counters> counters)
+      : mtca4u::NDRegisterAccessorDecorator<UserType>(accessor), _counters(counters)
+      {}
+
+      bool doWriteTransfer(ChimeraTK::VersionNumber versionNumber={}) override {
+        bool dataLost = _target->doWriteTransfer(versionNumber);
+        _counters->count(dataLost);
+        return dataLost;
+      }
+
+      void doPostRead() override {
+        _counters->count(false);
+        mtca4u::NDRegisterAccessorDecorator<UserType>::doPostRead();
+      }
+
+    protected:
+
+      using mtca4u::NDRegisterAccessorDecorator<UserType>::_target;
+
+      boost::shared_ptr<NetworkStatistics::Counters> _counters;
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_STATISTICS_DECORATOR_REGISTER_ACCCESSOR */
@@ -0,0 +1,106 @@
+/*
+ * StatisticsModule.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_STATISTICS_MODULE_H
+#define CHIMERATK_STATISTICS_MODULE_H
+
+#include <string>
+#include <vector>
+#include <set>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <cstdint>
+
+#include <boost/thread.hpp>
+
+#include <ChimeraTK/ControlSystemAdapter/DevicePVManager.h>
+
+#include "InternalModule.h"
+#include "NetworkStatistics.h"
+
+namespace ChimeraTK {
+
+  /** Publication of the NetworkStatistics of all variable networks to the control system. For each network, the
+   *  following process variables are created below "/Statistics" followed by the name of the network (see
+   *  VariableNetwork::getName()):
+   *
+   *  - "updates": number of values sent to the network
+   *  - "dataLost": number of values lost because a queue was full
+   *  - "updateRate": average number of updates per second during the last interval
+   *  - "queueFill": largest fill level of the queues with a QueuePolicy
+   *
+   *  The counters are published as 64 bit unsigned integers. The statistics are aggregated and published by a separate thread
+   *  once per interval, so the threads transporting the values only increment their own counters.
+   *
+   *  The module is normally not used directly but enabled through Application::enableStatistics(). */
+  class StatisticsModule : public InternalModule {
+
+    public:
+
+      StatisticsModule(boost::shared_ptr<DevicePVManager> pvManager, std::chrono::milliseconds interval);
+
+      ~StatisticsModule();
+
+      void activate() override;
+
+      void deactivate() override;
+
+      /** Add a network with the given name and create its process variables. This function is thread safe. */
+      void addNetwork(const std::string &name, boost::shared_ptr<NetworkStatistics> statistics);
+
+      /** Publish the given counter as process variable "/Statistics" followed by the name, e.g. the hits of a poll
+       *  cache (see Application::enablePollCache()). This function is thread safe. */
+      void addCounter(const std::string &name, const std::string &description,
+                      boost::shared_ptr<std::atomic<uint64_t>> counter);
+
+      /** Aggregate the statistics of all networks and write them to the process variables. */
+      void publish();
+
+    protected:
+
+      /** Process variables of a network */
+      struct Entry {
+        boost::shared_ptr<NetworkStatistics> statistics;
+        boost::shared_ptr<ProcessArray<uint64_t>> updates;
+        boost::shared_ptr<ProcessArray<uint64_t>> dataLost;
+        boost::shared_ptr<ProcessArray<double>> updateRate;
+        boost::shared_ptr<ProcessArray<uint64_t>> queueFill;
+      };
+
+      /** Process variable of a counter added with addCounter() */
+      struct Counter {
+        boost::shared_ptr<std::atomic<uint64_t>> counter;
+        boost::shared_ptr<ProcessArray<uint64_t>> pv;
+      };
+
+      /** Return the given name, or the name with a numeric suffix if it has been used before (e.g. for several
+       *  networks fed by the same device register). Must be called with the mutex held. */
+      std::string makeUnique(const std::string &name);
+
+      /** Thread publishing the statistics periodically */
+      void run();
+
+      boost::shared_ptr<DevicePVManager> pvManager;
+
+      std::chrono::milliseconds interval;
+
+      /** Protected by the mutex */
+      std::vector<Entry> entries;
+      std::vector<Counter> counters;
+
+      /** Names used so far */
+      std::set<std::string> names;
+
+      std::mutex mutex;
+
+      boost::thread _thread;
+
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_STATISTICS_MODULE_H */
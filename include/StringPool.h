@@ -0,0 +1,77 @@
+/*
+ * StringPool.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_STRING_POOL_H
+#define CHIMERATK_STRING_POOL_H
+
+#include <string>
+#include <mutex>
+#include <unordered_set>
+#include <ostream>
+
+namespace ChimeraTK {
+
+  /** Pool of immutable strings shared by all VariableNetworkNodes. Names, units, descriptions etc. tend to repeat a
+   *  lot in large applications (e.g. all instances of a module have the same variable names and descriptions), so
+   *  each distinct string is stored only once. Strings are never removed from the pool. */
+  class StringPool {
+
+    public:
+
+      /** Obtain the global instance */
+      static StringPool& getInstance();
+
+      /** Return a reference to the pooled copy of the given string. The reference stays valid until the end of the
+       *  process. This function is thread safe. */
+      const std::string& intern(const std::string &value);
+
+      /** Return the number of distinct strings in the pool */
+      size_t size() const;
+
+    protected:
+
+      mutable std::mutex mutex;
+
+      /** The elements of an unordered_set do not move when the set is rehashed, so references stay valid */
+      std::unordered_set<std::string> strings;
+
+  };
+
+  /*******************************************************************************************************************/
+
+  /** String stored in the StringPool. Only the pointer to the pooled string is stored, so copying and comparing
+   *  InternedStrings is cheap. The value can only be replaced as a whole. */
+  class InternedString {
+
+    public:
+
+      InternedString() : _value(&StringPool::getInstance().intern("")) {}
+
+      InternedString(const std::string &value) : _value(&StringPool::getInstance().intern(value)) {}
+
+      InternedString(const char *value) : _value(&StringPool::getInstance().intern(value)) {}
+
+      /** Access the pooled string */
+      const std::string& str() const { return *_value; }
+      operator const std::string&() const { return *_value; }
+
+      /** Pooled strings are unique, so comparing the pointers is sufficient */
+      bool operator==(const InternedString &other) const { return _value == other._value; }
+      bool operator!=(const InternedString &other) const { return _value != other._value; }
+
+    protected:
+
+      const std::string *_value;
+
+  };
+
+  inline std::ostream& operator<<(std::ostream &stream, const InternedString &value) {
+    return stream << value.str();
+  }
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_STRING_POOL_H */
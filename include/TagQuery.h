@@ -0,0 +1,158 @@
+/*
+ * TagQuery.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_TAG_QUERY_H
+#define CHIMERATK_TAG_QUERY_H
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+
+namespace ChimeraTK {
+
+  /** Set of tags, stored as a bitset of the tag ids assigned by the TagTable. */
+  class TagSet {
+
+    public:
+
+      /** Add the tag with the given id */
+      void add(size_t id) {
+        if(id/64 >= words.size()) words.resize(id/64+1, 0);
+        words[id/64] |= uint64_t(1) << (id%64);
+      }
+
+      /** Check if the tag with the given id is contained */
+      bool contains(size_t id) const {
+        return id/64 < words.size() && (words[id/64] & (uint64_t(1) << (id%64))) != 0;
+      }
+
+      /** Check if at least one tag is contained in both sets */
+      bool intersects(const TagSet &other) const {
+        size_t n = std::min(words.size(), other.words.size());
+        for(size_t i=0; i<n; ++i) {
+          if((words[i] & other.words[i]) != 0) return true;
+        }
+        return false;
+      }
+
+      /** Return the ids of all contained tags in ascending order */
+      std::vector<size_t> getIds() const {
+        std::vector<size_t> ids;
+        for(size_t i=0; i<words.size(); ++i) {
+          for(size_t bit=0; bit<64; ++bit) {
+            if(words[i] & (uint64_t(1) << bit)) ids.push_back(i*64+bit);
+          }
+        }
+        return ids;
+      }
+
+      /** Check if no tag is contained */
+      bool empty() const {
+        for(auto word : words) {
+          if(word != 0) return false;
+        }
+        return true;
+      }
+
+      /** Remove all tags */
+      void clear() { words.clear(); }
+
+    protected:
+
+      std::vector<uint64_t> words;
+
+  };
+
+  /*******************************************************************************************************************/
+
+  /** Table of all tags used in the application. Each distinct tag name is assigned a small integer id on first use,
+   *  which is used as bit number in the TagSet of the VariableNetworkNodes. Ids are never released. */
+  class TagTable {
+
+    public:
+
+      /** Obtain the global instance */
+      static TagTable& getInstance();
+
+      /** Return the id for the given tag name, assigning a new id if the name is not yet known */
+      size_t intern(const std::string &tag);
+
+      /** Return the name of the tag with the given id */
+      std::string getName(size_t id) const;
+
+      /** Return a copy of the names of all tags, the index of the vector is the id */
+      std::vector<std::string> getNames() const;
+
+    protected:
+
+      mutable std::mutex mutex;
+
+      std::unordered_map<std::string, size_t> ids;
+
+      std::vector<std::string> names;
+
+  };
+
+  /*******************************************************************************************************************/
+
+  /** Compiled tag query, used by EntityOwner::findTag() and EntityOwner::excludeTag() to select variables.
+   *
+   *  A query consists of tag patterns combined with the operators "&" (and), "|" (or) and "!" (not). Parentheses
+   *  can be used for grouping, "!" binds stronger than "&", which binds stronger than "|". Whitespace around
+   *  patterns and operators is ignored. Each pattern is a regular expression (see std::regex_match) without these
+   *  special characters, e.g. "A", "Sensor.*" or "[AB]". A pattern is true for a variable if any of its tags matches
+   *  the pattern. A variable without any tags matches a pattern if the empty string matches the pattern.
+   *
+   *  Examples: "A & !B" selects variables having the tag A but not the tag B, "(A | B) & C" selects variables having
+   *  the tag C and at least one of the tags A and B. A plain regular expression without parentheses like "A|B" or
+   *  ".*" has the same meaning as before the query language was introduced.
+   *
+   *  The regular expressions are evaluated once against all tags in the TagTable when the query is compiled. The
+   *  evaluation for a variable then only tests the TagSet of the variable against precomputed bitsets, without
+   *  invoking the regular expression engine. Tags created after compiling the query are not considered by it. */
+  class TagQuery {
+
+    public:
+
+      /** Compile the given query. Throws ApplicationExceptionWithID<illegalParameter> on syntax errors. */
+      TagQuery(const std::string &query);
+
+      /** Evaluate the query for a variable with the given tags */
+      bool matches(const TagSet &tags) const;
+
+    protected:
+
+      /** Instruction of the compiled query. The query is stored in postfix notation and evaluated on a stack of
+       *  booleans. */
+      struct Instruction {
+        enum class Code { pattern, logicalAnd, logicalOr, logicalNot } code;
+        /** Index into the patterns vector, only for Code::pattern */
+        size_t pattern;
+      };
+
+      /** Precomputed result of a pattern: the set of all matching tags and whether it matches the empty string */
+      struct Pattern {
+        TagSet matchingTags;
+        bool matchesEmpty;
+      };
+
+      std::vector<Instruction> program;
+      std::vector<Pattern> patterns;
+
+      /** Maximum depth of the evaluation stack, which is implemented as the bits of one integer */
+      static constexpr size_t maxStackDepth{64};
+
+      /** Recursive descent parser, producing the program */
+      class Parser;
+
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_TAG_QUERY_H */
@@ -0,0 +1,80 @@
+/*
+ * ThreadSchedulingPolicy.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_THREAD_SCHEDULING_POLICY_H
+#define CHIMERATK_THREAD_SCHEDULING_POLICY_H
+
+#include <string>
+#include <vector>
+#include <unordered_set>
+
+namespace ChimeraTK {
+
+  /** Scheduling policy of an application thread: the CPUs the thread may run on, the real-time scheduling class and
+   *  priority, and the nice value. The policy is configured with tags on the ApplicationModules or ModuleGroups (tags
+   *  of a ModuleGroup are passed on to all modules and variables inside the group):
+   *
+   *  - "schedCpus<list>" pins the thread to the given CPUs, e.g. "schedCpus2-3,6"
+   *  - "schedNumaNode<node>" pins the thread to the CPUs of the given NUMA node, unless "schedCpus" is given as well.
+   *    The buffers of the networks consumed by the module are allocated on that node as well. The tag can be added
+   *    automatically, see Application::enableNumaPlacement().
+   *  - "schedFifo<priority>" or "schedRR<priority>" selects SCHED_FIFO or SCHED_RR with the given priority (1 to 99)
+   *  - "schedNice<value>" sets the nice value (-20 to 19), which only affects threads not using a real-time class
+   *
+   *  The policy applies to the thread of the ApplicationModule and to the ThreadedFanOuts and TriggerFanOuts serving
+   *  the networks of its variables (the variables carry the tags of their module). If several modules with different
+   *  policies share such a FanOut, the most urgent policy is used (see isMoreUrgentThan()).
+   *
+   *  Real-time classes and negative nice values require the CAP_SYS_NICE capability (or a suitable RLIMIT_RTPRIO resp.
+   *  RLIMIT_NICE). If the policy cannot be applied, a warning is printed and the thread continues with the default
+   *  policy. The effective placement of each thread with a policy is printed when the thread starts. */
+  struct ThreadSchedulingPolicy {
+
+      enum class SchedulingClass { other, fifo, roundRobin };
+
+      /** CPUs the thread may run on. Empty to not change the affinity. */
+      std::vector<int> cpus;
+
+      /** NUMA node the thread runs on, -1 if not set. Only used to select the CPUs if cpus is empty. */
+      int numaNode{-1};
+
+      SchedulingClass schedulingClass{SchedulingClass::other};
+
+      /** Real-time priority, only used for SchedulingClass::fifo and SchedulingClass::roundRobin */
+      int priority{0};
+
+      /** Nice value of the thread, only applied if hasNice is set */
+      bool hasNice{false};
+      int nice{0};
+
+      /** Check whether the policy changes the scheduling at all */
+      bool isEnabled() const {
+        return !cpus.empty() || numaNode >= 0 || schedulingClass != SchedulingClass::other || hasNice;
+      }
+
+      /** Check whether this policy is more urgent than the other one: a higher real-time priority wins, then a lower
+       *  nice value. Disabled policies are never more urgent. */
+      bool isMoreUrgentThan(const ThreadSchedulingPolicy &other) const;
+
+      /** Obtain the policy from the given tags, ignoring all tags not starting with "sched". Throws
+       *  ApplicationExceptionWithID<illegalParameter> if a tag cannot be parsed, or if conflicting scheduling
+       *  classes are requested. */
+      static ThreadSchedulingPolicy fromTags(const std::unordered_set<std::string> &tags);
+
+      /** Apply the policy to the calling thread and print the effective placement. Errors are reported as warnings,
+       *  since the thread should still run if e.g. the privileges for real-time scheduling are missing. Does nothing
+       *  if the policy is not enabled. */
+      void apply(const std::string &threadName) const;
+
+      /** Describe the effective placement of the calling thread, e.g.
+       *  "CPUs 2-3 (NUMA node 0), SCHED_FIFO priority 80, nice 0". */
+      static std::string describeCurrentThread();
+
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_THREAD_SCHEDULING_POLICY_H */
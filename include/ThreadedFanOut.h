@@ -8,24 +8,42 @@
 #ifndef CHIMERATK_THREADED_FAN_OUT_H
 #define CHIMERATK_THREADED_FAN_OUT_H
 
+#include <atomic>
+#include <chrono>
+#include <cmath>
+
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+
 #include <mtca4u/NDRegisterAccessor.h>
 
 #include "Application.h"
 #include "FanOut.h"
 #include "InternalModule.h"
+#include "VariableNetwork.h"
 
 namespace ChimeraTK {
 
   /** FanOut implementation with an internal thread which waits for new data which is read from the given feeding
-   *  implementation and distributed to any number of slaves. */
+   *  implementation and distributed to any number of slaves. If a PublicationPolicy is given, fast updates are
+   *  coalesced to the latest value and sent at most with the maximum rate, and values within the deadband of the last
+   *  value sent are not sent at all. Values not sent are counted in the given counter. */
   template<typename UserType>
   class ThreadedFanOut : public FanOut<UserType>, public InternalModule {
 
     public:
 
-      ThreadedFanOut(boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> feedingImpl)
-      : FanOut<UserType>(feedingImpl)
-      {}
+      ThreadedFanOut(boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> feedingImpl,
+                     PublicationPolicy policy = {},
+                     boost::shared_ptr<std::atomic<uint64_t>> droppedUpdates = nullptr)
+      : FanOut<UserType>(feedingImpl), _policy(policy), _droppedUpdates(droppedUpdates)
+      {
+        if(!_droppedUpdates) _droppedUpdates = boost::make_shared<std::atomic<uint64_t>>(0);
+        if(_policy.maxRate > 0.) {
+          _minimumInterval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+              std::chrono::duration<double>(1./_policy.maxRate));
+        }
+      }
 
 
       ~ThreadedFanOut() {
@@ -39,6 +57,7 @@ namespace ChimeraTK {
 
       void deactivate() override {
         if(_thread.joinable()) {
+          _wakeUp.notify_all();
           _thread.interrupt();
           _thread.join();
         }
@@ -48,32 +67,105 @@ namespace ChimeraTK {
       /** Synchronise feeder and the consumers. This function is executed in the separate thread. */
       void run() {
         Application::registerThread("ThreadedFanOut "+FanOut<UserType>::impl->getName());
+        _schedulingPolicy.apply(Application::threadName());
         Application::testableModeLock("start");
         while(true) {
           // receive data
           boost::this_thread::interruption_point();
-          Profiler::stopMeasurement();
-          FanOut<UserType>::impl->read();
-          Profiler::startMeasurement();
+          _waitPolicy.wait([this] { return FanOut<UserType>::impl->readNonBlocking(); },
+                           [this] { FanOut<UserType>::impl->read(); });
           boost::this_thread::interruption_point();
-          // send out copies to slaves
+          if(_policy.isEnabled() && !applyPolicy()) continue;
+          // send out copies to slaves, with the VersionNumber of the feeder so the consumers can match values of the same
+          // origin (see DataConsistencyGroup)
+          auto version = FanOut<UserType>::impl->getVersionNumber();
+          bool dataLost = false;
           for(auto &slave : FanOut<UserType>::slaves) {
             // do not send copy if no data is expected (e.g. trigger)
             if(slave->getNumberOfSamples() != 0) {
               slave->accessChannel(0) = FanOut<UserType>::impl->accessChannel(0);
             }
-            slave->write();
+            if(slave->write(version)) dataLost = true;
           }
+          FanOut<UserType>::countUpdate(dataLost);
         }
       }
 
+      /** Return the number of values which have not been sent due to the PublicationPolicy */
+      uint64_t getNumberOfDroppedUpdates() const { return *_droppedUpdates; }
+
     protected:
 
+      /** Apply the PublicationPolicy to the value just read. The value is replaced by the latest value available when
+       *  the minimum interval since the last value sent has passed. Returns false if the value must not be sent. */
+      bool applyPolicy() {
+        auto &value = FanOut<UserType>::impl->accessChannel(0);
+        if(_policy.maxRate > 0.) {
+          auto now = std::chrono::steady_clock::now();
+          if(now < _nextSendTime) {
+            // wait without holding the testable mode lock, so the rest of the application is not blocked meanwhile
+            Profiler::stopMeasurement();
+            Application::testableModeUnlock("waitPublicationInterval");
+            {
+              boost::unique_lock<boost::mutex> lock(_waitMutex);
+              _wakeUp.wait_for(lock, boost::chrono::nanoseconds(
+                  std::chrono::duration_cast<std::chrono::nanoseconds>(_nextSendTime-now).count()));
+            }
+            Application::testableModeLock("publicationIntervalPassed");
+            Profiler::startMeasurement();
+          }
+          // coalesce all values received meanwhile to the latest one
+          while(FanOut<UserType>::impl->readNonBlocking()) ++(*_droppedUpdates);
+        }
+        if(_policy.deadband >= 0. && _lastValueSent.size() == value.size()) {
+          bool changed = false;
+          for(size_t i=0; i<value.size() && !changed; ++i) changed = differs(value[i], _lastValueSent[i]);
+          if(!changed) {
+            ++(*_droppedUpdates);
+            return false;
+          }
+        }
+        if(_policy.deadband >= 0.) _lastValueSent = value;
+        _nextSendTime = std::chrono::steady_clock::now() + _minimumInterval;
+        return true;
+      }
+
+      /** Check whether the value differs from the last value sent by more than the deadband */
+      bool differs(const UserType &value, const UserType &lastValue) const {
+        if(_policy.deadband == 0.) return value != lastValue;
+        return std::abs(static_cast<double>(value) - static_cast<double>(lastValue)) > _policy.deadband;
+      }
+
       /** Thread handling the synchronisation, if needed */
       boost::thread _thread;
 
+      PublicationPolicy _policy;
+
+      /** Counter of values not sent due to the policy */
+      boost::shared_ptr<std::atomic<uint64_t>> _droppedUpdates;
+
+      /** Minimum interval between two values sent, derived from the maximum rate */
+      std::chrono::steady_clock::duration _minimumInterval{0};
+
+      /** Earliest time the next value may be sent */
+      std::chrono::steady_clock::time_point _nextSendTime;
+
+      /** Last value sent, only kept if the deadband is enabled */
+      std::vector<UserType> _lastValueSent;
+
+      /** Used to wait for the minimum interval, interrupted by deactivate() */
+      boost::mutex _waitMutex;
+      boost::condition_variable _wakeUp;
+
   };
 
+  /*******************************************************************************************************************/
+
+  template<>
+  inline bool ThreadedFanOut<std::string>::differs(const std::string &value, const std::string &lastValue) const {
+    return value != lastValue;
+  }
+
 } /* namespace ChimeraTK */
 
 #endif /* CHIMERATK_THREADED_FAN_OUT_H */
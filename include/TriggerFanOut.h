@@ -60,18 +60,19 @@ namespace ChimeraTK {
       /** Synchronise feeder and the consumers. This function is executed in the separate thread. */
       void run() {
         Application::registerThread("TriggerFanOut "+externalTrigger->getName());
+        _schedulingPolicy.apply(Application::threadName());
         Application::testableModeLock("start");
         while(true) {
           // wait for external trigger
           boost::this_thread::interruption_point();
-          Profiler::stopMeasurement();
-          externalTrigger->read();
-          Profiler::startMeasurement();
+          _waitPolicy.wait([this] { return externalTrigger->readNonBlocking(); },
+                           [this] { externalTrigger->read(); });
           boost::this_thread::interruption_point();
           // receive data
           transferGroup.read();
-          // send the data to the consumers
-          boost::fusion::for_each(fanOutMap.table, SendDataToConsumers());
+          // send the data to the consumers, all with the VersionNumber of the trigger so the consumers can match values
+          // belonging to the same trigger (see DataConsistencyGroup)
+          boost::fusion::for_each(fanOutMap.table, SendDataToConsumers{externalTrigger->getVersionNumber()});
         }
       }
 
@@ -89,11 +90,14 @@ namespace ChimeraTK {
             auto feeder = network.first;
             auto fanOut = network.second;
             fanOut->accessChannel(0).swap(feeder->accessChannel(0));
-            fanOut->write();
+            fanOut->write(version);
             // no need to swap back since we don't need the data
           }
 
         }
+
+        /** VersionNumber of the trigger */
+        ChimeraTK::VersionNumber version;
       };
 
       /** TransferElement acting as our trigger */
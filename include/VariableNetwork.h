@@ -12,17 +12,82 @@
 #include <string>
 #include <iostream>
 #include <typeinfo>
+#include <atomic>
 #include <boost/mpl/for_each.hpp>
+#include <boost/make_shared.hpp>
 
 #include <ChimeraTK/ControlSystemAdapter/ProcessVariable.h>
 
 #include "Flags.h"
 #include "VariableNetworkNode.h"
+#include "ThreadSchedulingPolicy.h"
+#include "WaitPolicy.h"
+#include "NetworkStatistics.h"
 #include "Visitor.h"
 
 namespace ChimeraTK {
 
   class AccessorBase;
+  class Application;
+
+  /** Policy for distributing the values of a network with a push-type feeder (e.g. a device register published to
+   *  the control system). The ThreadedFanOut of the network then coalesces fast updates to the latest value and sends
+   *  them at most with the given rate, and/or sends only values which differ enough from the last value sent. Values
+   *  which are not sent are counted, see VariableNetwork::getNumberOfDroppedUpdates().
+   *
+   *  The policy can be set with VariableNetwork::setPublicationPolicy() in Application::defineConnections(), or with
+   *  tags on any node of the network: "publishMaxRate<rate in Hz>" (e.g. "publishMaxRate10") and
+   *  "publishDeadband<deadband>" (e.g. "publishDeadband0.5"). */
+  struct PublicationPolicy {
+    /** Maximum rate of values sent to the consumers in Hz. 0 disables the rate limit. */
+    double maxRate{0.};
+
+    /** A value is only sent if at least one element differs from the last value sent by more than the deadband.
+     *  0 sends only changed values, a negative deadband disables the check. Strings are sent on any change. */
+    double deadband{-1.};
+
+    /** Check whether the policy changes the distribution of values at all */
+    bool isEnabled() const { return maxRate > 0. || deadband >= 0.; }
+  };
+
+  /** Policy for the queues between the feeder and the consumers of a network. By default, the queues have the length
+   *  given by the ControlSystemAdapter and a new value always enters the queue, discarding an older value if the queue
+   *  is full. For slow consumers interested only in the latest value, use a depth of 1. For consumers which must not
+   *  lose any value (e.g. DAQ), use a deep queue with Overflow::block.
+   *
+   *  The policy can be set with VariableNetwork::setQueuePolicy() in Application::defineConnections(), or with tags
+   *  on any node of the network: "queueDepth<depth>" (e.g. "queueDepth100"), and one of "queueDropOldest",
+   *  "queueDropNewest" and "queueBlock".
+   *
+   *  The depth applies to all queues of the network, including the process variables exported to the control system.
+   *  The overflow policies dropNewest and block require both ends of the queue inside the application, so they only
+   *  apply to the queues towards ApplicationModules (incl. those behind FanOuts). They are ignored in testable mode,
+   *  since blocking the sender would stall the application while holding the testable mode lock. With Overflow::block,
+   *  a FanOut distributing the values to several consumers waits for the slowest consumer. */
+  struct QueuePolicy {
+
+    enum class Overflow {
+      dropOldest,   ///< the new value is sent, an older value in the queue is discarded (default)
+      dropNewest,   ///< the new value is discarded
+      block         ///< the sender blocks until the consumer has read a value
+    };
+
+    /** Number of values the queue can hold. 0 uses the default of the ControlSystemAdapter for Overflow::dropOldest,
+     *  and 1 for the other overflow policies. */
+    size_t depth{0};
+
+    Overflow overflow{Overflow::dropOldest};
+
+    /** Check whether the policy differs from the default */
+    bool isEnabled() const { return depth > 0 || overflow != Overflow::dropOldest; }
+
+    /** Number of values the queue can hold, only valid if the policy is enabled */
+    size_t getEffectiveDepth() const { return depth > 0 ? depth : 1; }
+
+    /** Number of buffers of the ProcessArray implementing the queue, only valid if the policy is enabled. The
+     *  receiver always holds one buffer, so one more buffer than the queue depth is needed. */
+    size_t getNumberOfBuffers() const { return getEffectiveDepth()+1; }
+  };
 
   /** This class describes a network of variables all connected to each other. */
   class VariableNetwork {
@@ -102,6 +167,13 @@ namespace ChimeraTK {
       /** Return the description */
       const std::string& getDescription() const { return description; }
 
+      /** Override the engineering unit and the description, e.g. when the network is merged with another network by
+       *  the optimisations in the Application. */
+      void setMetaData(const std::string &unit, const std::string &newDescription) {
+        engineeringUnit = unit;
+        description = newDescription;
+      }
+
       /** Return the network providing the external trigger to this network, if TriggerType::external. If the network
        *  has another trigger type, an exception will be thrown. */
       //VariableNetwork& getExternalTrigger();
@@ -130,6 +202,68 @@ namespace ChimeraTK {
         return externalTriggerImpl;
       }
 
+      /** Set the policy for distributing the values of this network (see PublicationPolicy). The policy is only
+       *  applied if the network uses a ThreadedFanOut, i.e. if the feeder has UpdateMode::push. This overrides the
+       *  policy given by tags. */
+      void setPublicationPolicy(const PublicationPolicy &policy) {
+        publicationPolicy = policy;
+        hasPublicationPolicy = true;
+      }
+
+      /** Return the policy for distributing the values of this network, either set with setPublicationPolicy() or
+       *  given by the tags of the nodes. */
+      PublicationPolicy getPublicationPolicy() const;
+
+      /** Return the number of values which have not been sent to the consumers due to the PublicationPolicy */
+      uint64_t getNumberOfDroppedUpdates() const { return *droppedUpdates; }
+
+      /** Return the counter of dropped values, which is incremented by the FanOut */
+      boost::shared_ptr<std::atomic<uint64_t>> getDroppedUpdatesCounter() const { return droppedUpdates; }
+
+      /** Return the statistics of the updates of this network (see NetworkStatistics) */
+      boost::shared_ptr<NetworkStatistics> getStatistics() const { return statistics; }
+
+      /** Return a name identifying the network in the statistics, derived from the feeding node: the qualified name
+       *  of an application feeder, "/ControlSystem" followed by the public name of a control system feeder or
+       *  "/Device/<alias>/<register>" for a device feeder. Returns an empty string for networks fed by a constant. */
+      std::string getName() const;
+
+      /** Set the policy for the queues of this network (see QueuePolicy). This overrides the policy given by tags. */
+      void setQueuePolicy(const QueuePolicy &policy) {
+        queuePolicy = policy;
+        hasQueuePolicy = true;
+      }
+
+      /** Return the policy for the queues of this network, either set with setQueuePolicy() or given by the tags of
+       *  the nodes. Throws ApplicationExceptionWithID<illegalParameter> if the tags cannot be parsed or conflict. */
+      QueuePolicy getQueuePolicy() const;
+
+      /** Return the scheduling policy for the thread of a FanOut serving this network. This is the most urgent policy
+       *  given by the tags of the nodes (see ThreadSchedulingPolicy). */
+      ThreadSchedulingPolicy getSchedulingPolicy() const;
+
+      /** Return the NUMA node of the consumers, i.e. the first node given by the "schedNumaNode" tag of a consuming
+       *  node (see ThreadSchedulingPolicy). Returns -1 if no consumer has a NUMA node. */
+      int getConsumerNumaNode() const;
+
+      /** Return the policy how the thread of a FanOut serving this network waits for new data. This is the longest
+       *  spinning policy given by the tags of the nodes (see WaitPolicy). */
+      WaitPolicy getWaitPolicy() const;
+
+      /** Type of the UserType-dependent part of the connection logic in the Application */
+      typedef void (Application::*TypedMakeConnectionFunction)(VariableNetwork &network);
+
+      /** Set the function creating the connections for this network, if the UserType is already known at compile
+       *  time (see StaticConnection). Otherwise the function is selected at runtime based on getValueType(). */
+      void setTypedMakeConnection(TypedMakeConnectionFunction function) {
+        typedMakeConnection = function;
+      }
+
+      /** Return the function set with setTypedMakeConnection(), or nullptr if not set. */
+      TypedMakeConnectionFunction getTypedMakeConnection() const {
+        return typedMakeConnection;
+      }
+
     protected:
 
       /** List of nodes in the network */
@@ -157,6 +291,24 @@ namespace ChimeraTK {
       /** Flag if the network connections have been created already */
       bool flagIsCreated{false};
 
+      /** Function creating the connections for this network, if known at compile time */
+      TypedMakeConnectionFunction typedMakeConnection{nullptr};
+
+      /** Policy set with setPublicationPolicy() */
+      PublicationPolicy publicationPolicy;
+      bool hasPublicationPolicy{false};
+
+      /** Policy set with setQueuePolicy() */
+      QueuePolicy queuePolicy;
+      bool hasQueuePolicy{false};
+
+      /** Counter of values not sent due to the PublicationPolicy. Shared with the FanOut, since the FanOut may be
+       *  destroyed after the network. */
+      boost::shared_ptr<std::atomic<uint64_t>> droppedUpdates{boost::make_shared<std::atomic<uint64_t>>(0)};
+
+      /** Statistics of the updates, shared with the FanOuts and accessors counting the updates */
+      boost::shared_ptr<NetworkStatistics> statistics{boost::make_shared<NetworkStatistics>()};
+
   };
 
 } /* namespace ChimeraTK */
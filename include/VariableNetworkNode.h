@@ -14,12 +14,16 @@
 #include <assert.h>
 
 #include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/pool/pool_alloc.hpp>
 
 #include <mtca4u/NDRegisterAccessorAbstractor.h>
 
 #include "Flags.h"
 #include "ConstantAccessor.h"
 #include "Visitor.h"
+#include "TagQuery.h"
+#include "StringPool.h"
 
 namespace ChimeraTK {
 
@@ -130,7 +134,8 @@ namespace ChimeraTK {
       const std::string& getPublicName() const;
       const std::string& getDeviceAlias() const;
       const std::string& getRegisterName() const;
-      const std::unordered_set<std::string>& getTags() const;
+      std::unordered_set<std::string> getTags() const;
+      const TagSet& getTagSet() const;
       void setNumberOfElements(size_t nElements);
       size_t getNumberOfElements() const;
       mtca4u::TransferElementAbstractor& getAppAccessorNoType();
@@ -162,7 +167,11 @@ namespace ChimeraTK {
   /*********************************************************************************************************************/
 
   /** We use a pimpl pattern so copied instances of VariableNetworkNode refer to the same instance of the data
-    *  structure and thus stay consistent all the time. */
+    *  structure and thus stay consistent all the time.
+    *
+    *  Large applications have many thousands of nodes, so the data structure is kept compact: strings which typically
+    *  repeat across nodes are stored in the StringPool, and the instances are allocated from a memory pool (see
+    *  makeNodeData()) instead of individually on the heap. */
   struct VariableNetworkNode_data {
 
     VariableNetworkNode_data() {}
@@ -181,10 +190,10 @@ namespace ChimeraTK {
     const std::type_info* valueType{&typeid(AnyType)};
 
     /** Engineering unit. If equal to mtca4u::TransferElement::unitNotSet, no unit has been defined (and any unit is allowed). */
-    std::string unit{mtca4u::TransferElement::unitNotSet};
+    InternedString unit{mtca4u::TransferElement::unitNotSet};
 
     /** Description */
-    std::string description{""};
+    InternedString description;
 
     /** The network this node belongs to */
     VariableNetwork *network{nullptr};
@@ -203,21 +212,22 @@ namespace ChimeraTK {
     VariableNetworkNode externalTrigger{nullptr};
 
     /** Public name if type == ControlSystem */
-    std::string publicName;
+    InternedString publicName;
 
-    /** Accessor name if type == Application */
-    std::string name;
+    /** Accessor name if type == Application. The qualified name is unique for each node and hence not pooled. */
+    InternedString name;
     std::string qualifiedName;
 
     /** Device information if type == Device */
-    std::string deviceAlias;
-    std::string registerName;
+    InternedString deviceAlias;
+    InternedString registerName;
 
     /** Number of elements in the variable. 0 means not yet decided. */
     size_t nElements{0};
 
-    /** Set of tags  if type == Application */
-    std::unordered_set<std::string> tags;
+    /** Set of tags if type == Application, as ids of the TagTable. TagQuerys are evaluated on this set without
+     *  comparing strings, the names are obtained from the TagTable by getTags(). */
+    TagSet tagSet;
 
     /** Map to store triggered versions of this node. The map key is the trigger node and the value is the node
      *  with the respective trigger added. */
@@ -228,6 +238,17 @@ namespace ChimeraTK {
 
   };
 
+  /*********************************************************************************************************************/
+
+  /** Allocate a new VariableNetworkNode_data from the memory pool shared by all nodes. The pool groups the nodes in
+   *  large chunks, which avoids the per-allocation overhead of the heap and keeps the nodes close together in
+   *  memory. Memory returned to the pool is reused for new nodes but not released to the system. */
+  template<typename... Args>
+  boost::shared_ptr<VariableNetworkNode_data> makeNodeData(Args&&... args) {
+    return boost::allocate_shared<VariableNetworkNode_data>(boost::fast_pool_allocator<VariableNetworkNode_data>(),
+                                                            std::forward<Args>(args)...);
+  }
+
   /*********************************************************************************************************************/
   /*** Implementations *************************************************************************************************/
   /*********************************************************************************************************************/
@@ -235,7 +256,7 @@ namespace ChimeraTK {
   template<typename UserType>
   VariableNetworkNode VariableNetworkNode::makeConstant(bool makeFeeder, UserType value, size_t length) {
     VariableNetworkNode node;
-    node.pdata = boost::make_shared<VariableNetworkNode_data>();
+    node.pdata = makeNodeData();
     node.pdata->constNode.reset(new ConstantAccessor<UserType>(value, length));
     node.pdata->type = NodeType::Constant;
     node.pdata->valueType = &typeid(UserType);
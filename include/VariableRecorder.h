@@ -0,0 +1,211 @@
+/*
+ * VariableRecorder.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_VARIABLE_RECORDER_H
+#define CHIMERATK_VARIABLE_RECORDER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <typeinfo>
+#include <cstdint>
+
+#include <mtca4u/VersionNumber.h>
+
+namespace ChimeraTK {
+
+  /** Recorder for the values of process variables, used to record the traffic of an application in production and to
+   *  replay it later (see VariableReplayer). The recorder writes a compact binary file with the following layout
+   *  (all integers in the native byte order of the recording machine):
+   *
+   *  - the magic string "CTKVREC1" (8 bytes)
+   *  - a sequence of entries, each starting with a one-byte tag:
+   *    - 'V' (variable declaration): uint32 id, uint8 kind (see VariableKind), string user type name, uint32 number
+   *      of elements, string name, string device alias (empty for control system variables)
+   *    - 'D' (data): uint32 variable id, uint64 version ordinal, int64 timestamp (nanoseconds since epoch), uint32
+   *      payload size, payload
+   *
+   *  Strings are stored as uint32 length followed by the characters. The payload contains all elements of the first
+   *  channel, numeric values in their binary representation, strings as described above. The version ordinal is a
+   *  consecutive number assigned to each distinct VersionNumber seen by the recorder, so values which have been sent
+   *  with the same VersionNumber can be identified in the recording.
+   *
+   *  VersionNumbers cannot be converted into an integer, so the recorder keeps a map of the most recently seen
+   *  VersionNumbers to their ordinals. The map is limited to versionMapSize entries (see constructor). If a
+   *  VersionNumber is seen again after more than versionMapSize newer VersionNumbers, it has already been evicted from
+   *  the map and will get a new ordinal. Values sent with such an old VersionNumber will then appear in the recording as
+   *  if they had a different VersionNumber than the earlier values.
+   *
+   *  The recorder is normally not used directly but enabled through Application::enableVariableRecording(). */
+  class VariableRecorder {
+
+    public:
+
+      /** Kind of a recorded variable */
+      enum class VariableKind : uint8_t { controlSystemInput = 0, deviceInput = 1, controlSystemOutput = 2,
+                                          devicePushInput = 3 };
+
+      /** Open the given file for writing. An existing file will be overwritten. The versionMapSize limits the number
+       *  of VersionNumbers remembered to assign the version ordinals (see class description). */
+      VariableRecorder(const std::string &fileName, size_t versionMapSize = 1024);
+
+      ~VariableRecorder();
+
+      /** Declare a new variable in the recording. Returns the id of the variable to be passed to commit(). */
+      template<typename UserType>
+      uint32_t addVariable(VariableKind kind, const std::string &name, const std::string &deviceAlias,
+                           size_t nElements);
+
+      /** Append a data entry for the given variable to the recording. The payload must have been serialised with
+       *  serialiseBuffer(). This function is thread safe. */
+      void commit(uint32_t variableId, const ChimeraTK::VersionNumber &version, const std::string &payload);
+
+      /** Serialise the given buffer into the payload format of the recording. The payload is cleared first, but its
+       *  capacity is kept, so passing the same string repeatedly avoids memory allocations. */
+      template<typename UserType>
+      static void serialiseBuffer(std::string &payload, const std::vector<UserType> &buffer);
+
+      /** Deserialise a payload created by serialiseBuffer() into the given buffer. The buffer must already have the
+       *  right size. Returns false if the payload is too short or otherwise malformed. */
+      template<typename UserType>
+      static bool deserialiseBuffer(const char *payload, size_t size, std::vector<UserType> &buffer);
+
+      /** Convert a payload into a human readable string, e.g. to print differences between recorded values. */
+      template<typename UserType>
+      static std::string payloadToString(const char *payload, size_t size, size_t nElements);
+
+      /** Return the name of the given user type as stored in the recording (e.g. "int32"). */
+      static std::string userTypeName(const std::type_info &type);
+
+      /** Magic string at the beginning of each recording */
+      static constexpr const char *magic = "CTKVREC1";
+
+    protected:
+
+      /** Obtain the ordinal for the given VersionNumber. Must be called with the mutex held. */
+      uint64_t getVersionOrdinal(const ChimeraTK::VersionNumber &version);
+
+      /** Write raw data to the file. Must be called with the mutex held. */
+      template<typename T>
+      void writeRaw(const T &value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+      }
+      void writeString(const std::string &value) {
+        writeRaw(static_cast<uint32_t>(value.size()));
+        file.write(value.data(), value.size());
+      }
+
+      /** Declare variable, type-independent part of addVariable(). */
+      uint32_t addVariable(VariableKind kind, const std::string &typeName, const std::string &name,
+                           const std::string &deviceAlias, size_t nElements);
+
+      std::mutex mutex;
+
+      std::ofstream file;
+
+      uint32_t nextVariableId{0};
+
+      /** Map of recently seen VersionNumbers to their ordinals. Only the most recent VersionNumbers are kept, since
+       *  the map would grow without limit otherwise. */
+      std::map<ChimeraTK::VersionNumber, uint64_t> versionMap;
+      uint64_t nextVersionOrdinal{0};
+
+      /** Maximum number of entries in the versionMap */
+      size_t versionMapSize;
+
+      /** Time of the last flush of the file. The file is flushed at most once per second to limit the overhead while
+       *  making sure not too much data is lost if the application crashes. */
+      std::chrono::steady_clock::time_point lastFlush;
+
+  };
+
+  /*******************************************************************************************************************/
+
+  template<typename UserType>
+  uint32_t VariableRecorder::addVariable(VariableKind kind, const std::string &name, const std::string &deviceAlias,
+                                         size_t nElements) {
+    return addVariable(kind, userTypeName(typeid(UserType)), name, deviceAlias, nElements);
+  }
+
+  /*******************************************************************************************************************/
+
+  template<typename UserType>
+  void VariableRecorder::serialiseBuffer(std::string &payload, const std::vector<UserType> &buffer) {
+    payload.assign(reinterpret_cast<const char*>(buffer.data()), buffer.size()*sizeof(UserType));
+  }
+
+  template<>
+  inline void VariableRecorder::serialiseBuffer<std::string>(std::string &payload,
+                                                             const std::vector<std::string> &buffer) {
+    payload.clear();
+    for(auto &value : buffer) {
+      uint32_t length = value.size();
+      payload.append(reinterpret_cast<const char*>(&length), sizeof(length));
+      payload.append(value);
+    }
+  }
+
+  /*******************************************************************************************************************/
+
+  template<typename UserType>
+  bool VariableRecorder::deserialiseBuffer(const char *payload, size_t size, std::vector<UserType> &buffer) {
+    if(size != buffer.size()*sizeof(UserType)) return false;
+    std::memcpy(buffer.data(), payload, size);
+    return true;
+  }
+
+  template<>
+  inline bool VariableRecorder::deserialiseBuffer<std::string>(const char *payload, size_t size,
+                                                               std::vector<std::string> &buffer) {
+    const char *end = payload+size;
+    for(auto &value : buffer) {
+      uint32_t length;
+      if(end-payload < static_cast<ptrdiff_t>(sizeof(length))) return false;
+      std::memcpy(&length, payload, sizeof(length));
+      payload += sizeof(length);
+      if(end-payload < static_cast<ptrdiff_t>(length)) return false;
+      value.assign(payload, length);
+      payload += length;
+    }
+    return payload == end;
+  }
+
+  /*******************************************************************************************************************/
+
+  template<typename UserType>
+  std::string VariableRecorder::payloadToString(const char *payload, size_t size, size_t nElements) {
+    std::vector<UserType> buffer(nElements);
+    if(!deserialiseBuffer(payload, size, buffer)) return "(malformed data)";
+    std::stringstream s;
+    for(size_t i=0; i<buffer.size(); ++i) {
+      if(i > 0) s << ", ";
+      // print 8 bit integers as numbers, not as characters
+      s << +buffer[i];
+    }
+    return s.str();
+  }
+
+  template<>
+  inline std::string VariableRecorder::payloadToString<std::string>(const char *payload, size_t size,
+                                                                     size_t nElements) {
+    std::vector<std::string> buffer(nElements);
+    if(!deserialiseBuffer(payload, size, buffer)) return "(malformed data)";
+    std::string result;
+    for(size_t i=0; i<buffer.size(); ++i) {
+      if(i > 0) result += ", ";
+      result += "\""+buffer[i]+"\"";
+    }
+    return result;
+  }
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_VARIABLE_RECORDER_H */
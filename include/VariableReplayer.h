@@ -0,0 +1,106 @@
+/*
+ * VariableReplayer.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_VARIABLE_REPLAYER_H
+#define CHIMERATK_VARIABLE_REPLAYER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <iostream>
+
+#include <boost/shared_ptr.hpp>
+
+#include "VariableRecorder.h"
+
+namespace ChimeraTK {
+
+  class TestFacility;
+
+  /** Replay a recording created with Application::enableVariableRecording() into an application running under the
+   *  TestFacility. The recorded inputs are fed into the application as fast as possible, and after each step the
+   *  control system outputs of the application are compared against the recorded outputs.
+   *
+   *  The recording is split into steps at the inputs triggering the application, which are the control system
+   *  inputs and the push-type device inputs: each new VersionNumber of such an input starts a new step, so
+   *  consecutive triggering inputs carrying the same VersionNumber form one step. Polled device inputs and control
+   *  system outputs following these inputs until the next step belong to the same step. Before the triggering inputs
+   *  of a step are written, the recorded polled device inputs of that step are written into the device registers.
+   *  Device inputs are written through the device, which requires a backend reflecting written values to readers, like
+   *  the dummy backends (for push-type inputs it must also notify the readers waiting for new data). Then the
+   *  application is stepped and all control system outputs are read and compared with the last value recorded for
+   *  them in that step. A recording without any triggering input is replayed as a single step.
+   *
+   *  The application must have been started with TestFacility::runApplication() before calling replay(). */
+  class VariableReplayer {
+
+    public:
+
+      /** Load the given recording. The file is read completely into memory. */
+      VariableReplayer(TestFacility &testFacility, const std::string &fileName);
+
+      ~VariableReplayer();
+
+      /** A difference between a recorded and a replayed output */
+      struct Difference {
+        /** Step in which the difference occurred, counting from 1 */
+        size_t step;
+        /** Name of the control system variable */
+        std::string variable;
+        /** Recorded value, or "(no update)" if the output was not written in this step during recording */
+        std::string expected;
+        /** Replayed value, or "(no update)" if the output was not written in this step during the replay */
+        std::string actual;
+      };
+
+      /** Replay the complete recording. Returns the number of steps executed. The differences found can be obtained
+       *  afterwards with getDifferences(). */
+      size_t replay();
+
+      /** Return list of differences found during replay() */
+      const std::vector<Difference>& getDifferences() const { return differences; }
+
+      /** Print the differences found during replay() */
+      void printDifferences(std::ostream &stream = std::cout) const;
+
+      /** Base class for the typed replay variables, implemented in the .cc file */
+      class Variable;
+
+    protected:
+
+      /** A single data entry of the recording. The payload points into the fileContent. */
+      struct Record {
+        Variable *variable;
+        uint64_t versionOrdinal;
+        int64_t timestamp;
+        const char *payload;
+        uint32_t payloadSize;
+      };
+
+      /** Check whether the variable is an input triggering the application, which starts a new step */
+      static bool isTrigger(const Variable &variable);
+
+      /** Parse the file content into the variable list and the records */
+      void parse(const std::string &fileName);
+
+      TestFacility &_testFacility;
+
+      /** Complete content of the recording */
+      std::string fileContent;
+
+      /** Variables declared in the recording, indexed by the id used in the recording */
+      std::map<uint32_t, boost::shared_ptr<Variable>> variables;
+
+      /** All data entries of the recording in the recorded order */
+      std::vector<Record> records;
+
+      std::vector<Difference> differences;
+
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_VARIABLE_REPLAYER_H */
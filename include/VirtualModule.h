@@ -9,6 +9,7 @@
 #define CHIMERATK_VIRTUAL_MODULE_H
 
 #include <list>
+#include <unordered_map>
 
 #include <boost/thread.hpp>
 
@@ -16,7 +17,9 @@
 
 namespace ChimeraTK {
 
-  /** A virtual module generated by EntityOwner::findTag(). */
+  /** A virtual module generated by EntityOwner::findTag(). Variables and sub-modules are indexed by their names, so
+   *  the lookup with operator() and operator[] and hence connectTo() do not depend on the number of entities in the
+   *  module. */
   class VirtualModule : public Module {
 
     public:
@@ -29,9 +32,15 @@ namespace ChimeraTK {
       /** Copy constructor */
       VirtualModule(const VirtualModule &other);
 
+      /** Move constructor. The sub-modules are moved and not copied, which is much faster for large trees. */
+      VirtualModule(VirtualModule &&other);
+
       /** Assignment operator */
       VirtualModule& operator=(const VirtualModule &other);
 
+      /** Move assignment operator */
+      VirtualModule& operator=(VirtualModule &&other);
+
       /** Destructor */
       virtual ~VirtualModule();
 
@@ -44,6 +53,13 @@ namespace ChimeraTK {
       /** Add a virtual sub-module. The module instance will be added to an internal list. */
       void addSubModule(VirtualModule module);
 
+      /** Return the virtual sub-module with the given name, or nullptr if there is no such sub-module */
+      VirtualModule* findVirtualSubmodule(const std::string &moduleName) const;
+
+      void registerAccessor(VariableNetworkNode accessor) override;
+
+      void unregisterAccessor(VariableNetworkNode accessor) override;
+
       ModuleType getModuleType() const override { return _moduleType; }
 
       const Module& virtualise() const override;
@@ -53,6 +69,17 @@ namespace ChimeraTK {
       std::list<VirtualModule> submodules;
       ModuleType _moduleType;
 
+      /** Index of the submodules by their names. If several sub-modules have the same name, the index points to the
+       *  first of them. */
+      std::unordered_map<std::string, VirtualModule*> submoduleIndex;
+
+      /** Index of the accessorList by the variable names. If several variables have the same name, the index points
+       *  to the first of them in the accessorList. */
+      std::unordered_map<std::string, VariableNetworkNode> accessorIndex;
+
+      /** Rebuild the accessorIndex from the accessorList */
+      void rebuildAccessorIndex();
+
   };
 
 } /* namespace ChimeraTK */
@@ -0,0 +1,106 @@
+/*
+ * WaitPolicy.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_WAIT_POLICY_H
+#define CHIMERATK_WAIT_POLICY_H
+
+#include <chrono>
+#include <string>
+#include <unordered_set>
+
+#include <boost/thread.hpp>
+
+#include "Profiler.h"
+
+namespace ChimeraTK {
+
+  /** Policy how a thread waits for new data in a blocking read. By default the thread blocks in the queue of the
+   *  variable, so each wake-up costs the latency of the futex and the scheduler. For latency-critical modules, the
+   *  thread can instead spin for a while checking for new data before blocking, or spin until data arrives, trading
+   *  CPU time for latency. The policy is configured with tags on accessors, ApplicationModules or ModuleGroups:
+   *
+   *  - "waitSpin<microseconds>" spins for up to the given time before blocking, e.g. "waitSpin50"
+   *  - "waitBusyPoll" spins until new data arrives and never blocks
+   *
+   *  The policy is honoured by read() of push-type inputs carrying the tag, by Application::readAny() in modules
+   *  carrying the tag, and by the ThreadedFanOuts and TriggerFanOuts serving networks with the tag. The time spent
+   *  spinning is accounted separately by the Profiler (see Profiler::ThreadData::getIntegratedSpinTime()). Busy
+   *  polling threads occupy a CPU completely, so they should be pinned to a dedicated CPU (see
+   *  ThreadSchedulingPolicy).
+   *
+   *  The policy is ignored in testable mode, since the threads must block to release the testable mode lock. */
+  struct WaitPolicy {
+
+      enum class Mode { block, spinThenBlock, busyPoll };
+
+      Mode mode{Mode::block};
+
+      /** Maximum time to spin before blocking, only used for Mode::spinThenBlock */
+      std::chrono::microseconds spinTime{0};
+
+      /** Check whether the policy differs from plain blocking */
+      bool isEnabled() const { return mode != Mode::block; }
+
+      /** Check whether this policy spins longer than the other one */
+      bool spinsLongerThan(const WaitPolicy &other) const;
+
+      /** Obtain the policy from the given tags, ignoring all tags not starting with "wait". Throws
+       *  ApplicationExceptionWithID<illegalParameter> if a tag cannot be parsed. */
+      static WaitPolicy fromTags(const std::unordered_set<std::string> &tags);
+
+      /** Policy used by Application::readAny() in the calling thread. Set by the threads of the ApplicationModules. */
+      static WaitPolicy& currentThread();
+
+      /** Wait for new data according to the policy. tryRead is called while spinning and must return true when new
+       *  data has been received, blockingRead is called afterwards if no data has been received. The spin time is
+       *  accounted by the Profiler, the blocking time is excluded from the active time. The spinning thread can be
+       *  interrupted with boost::thread::interrupt(). */
+      template<typename TRY_READ, typename BLOCKING_READ>
+      void wait(TRY_READ tryRead, BLOCKING_READ blockingRead) const;
+
+      /** Hint to the CPU that the calling thread is spinning */
+      static void relax() {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+      }
+
+  };
+
+  /*******************************************************************************************************************/
+
+  template<typename TRY_READ, typename BLOCKING_READ>
+  void WaitPolicy::wait(TRY_READ tryRead, BLOCKING_READ blockingRead) const {
+    if(mode != Mode::block) {
+      Profiler::startSpinning();
+      auto end = std::chrono::steady_clock::now() + spinTime;
+      for(size_t i = 0; ; ++i) {
+        if(tryRead()) {
+          Profiler::stopSpinning();
+          Profiler::startMeasurement();
+          return;
+        }
+        // checking the clock and the interruption is much more expensive than the pause instruction
+        if(i % 64 == 63) {
+          if(mode == Mode::spinThenBlock && std::chrono::steady_clock::now() >= end) break;
+          boost::this_thread::interruption_point();
+        }
+        relax();
+      }
+      Profiler::stopSpinning();
+    }
+    else {
+      Profiler::stopMeasurement();
+    }
+    blockingRead();
+    Profiler::startMeasurement();
+  }
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_WAIT_POLICY_H */
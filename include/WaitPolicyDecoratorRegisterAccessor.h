@@ -0,0 +1,41 @@
+/*
+ * WaitPolicyDecoratorRegisterAccessor.h
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#ifndef CHIMERATK_WAIT_POLICY_DECORATOR_REGISTER_ACCCESSOR
+#define CHIMERATK_WAIT_POLICY_DECORATOR_REGISTER_ACCCESSOR
+
+#include <mtca4u/NDRegisterAccessorDecorator.h>
+
+#include "WaitPolicy.h"
+
+namespace ChimeraTK {
+
+  /** Decorator of the NDRegisterAccessor which waits in blocking reads according to the given WaitPolicy, i.e. it
+   *  spins on non-blocking reads of the target before (or instead of) blocking. Used for all push-type inputs of
+   *  ApplicationModules, so the time spent waiting is excluded from the active time of the thread (see Profiler). */
+  template<typename UserType>
+  class WaitPolicyDecoratorRegisterAccessor : public mtca4u::NDRegisterAccessorDecorator<UserType> {
+    public:
+      WaitPolicyDecoratorRegisterAccessor(boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> accessor,
+                                          const WaitPolicy &policy)
+      : mtca4u::NDRegisterAccessorDecorator<UserType>(accessor), _policy(policy)
+      {}
+
+      void doReadTransfer() override {
+        _policy.wait([this] { return _target->doReadTransferNonBlocking(); },
+                     [this] { _target->doReadTransfer(); });
+      }
+
+    protected:
+
+      using mtca4u::NDRegisterAccessorDecorator<UserType>::_target;
+
+      WaitPolicy _policy;
+  };
+
+} /* namespace ChimeraTK */
+
+#endif /* CHIMERATK_WAIT_POLICY_DECORATOR_REGISTER_ACCCESSOR */
@@ -7,7 +7,10 @@
 
 #include <string>
 #include <thread>
+#include <algorithm>
 #include <exception>
+#include <map>
+#include <set>
 
 #include <boost/fusion/container/map.hpp>
 
@@ -25,6 +28,18 @@
 #include "ConstantAccessor.h"
 #include "TestDecoratorRegisterAccessor.h"
 #include "DebugDecoratorRegisterAccessor.h"
+#include "RecorderDecoratorRegisterAccessor.h"
+#include "PersistenceDecoratorRegisterAccessor.h"
+#include "SharedMemoryDecoratorRegisterAccessor.h"
+#include "WaitPolicyDecoratorRegisterAccessor.h"
+#include "QueuePolicyDecoratorRegisterAccessor.h"
+#include "StatisticsDecoratorRegisterAccessor.h"
+#include "StatisticsModule.h"
+#include "BatchedWriteDecoratorRegisterAccessor.h"
+#include "PollCacheDecoratorRegisterAccessor.h"
+#include "DirtyRangeDecoratorRegisterAccessor.h"
+#include "FusedElementwiseChain.h"
+#include "Numa.h"
 #include "Visitor.h"
 #include "VariableNetworkGraphDumpingVisitor.h"
 #include "XMLGeneratorVisitor.h"
@@ -65,6 +80,9 @@ void Application::initialise() {
   // connect any unconnected accessors with constant values
   processUnconnectedNodes();
 
+  // place the modules on the NUMA nodes before the connections are made, so the FanOuts and buffers follow them
+  if(numaPlacement) placeModulesOnNumaNodes();
+
   // realise the connections between variable accessors as described in the initialise() function
   makeConnections();
 }
@@ -103,16 +121,7 @@ void Application::processUnconnectedNodes() {
           std::cerr << "*** Warning: Variable '" << accessor.getName() << "' is not connected. "    // LCOV_EXCL_LINE
                        "Reading will always result in 0, writing will be ignored." << std::endl;    // LCOV_EXCL_LINE
         }
-        networkList.emplace_back();
-        networkList.back().addNode(accessor);
-
-        bool makeFeeder = !(networkList.back().hasFeedingNode());
-        size_t length = accessor.getNumberOfElements();
-        auto callable = CreateConstantForUnconnectedVar(accessor.getValueType(), makeFeeder, length);
-        boost::fusion::for_each(mtca4u::userTypeMap(), callable);
-        assert(callable.done);
-        constantList.emplace_back(callable.theNode);
-        networkList.back().addNode(constantList.back());
+        connectToConstant(accessor);
       }
     }
   }
@@ -120,6 +129,97 @@ void Application::processUnconnectedNodes() {
 
 /*********************************************************************************************************************/
 
+void Application::placeModulesOnNumaNodes() {
+
+  // find the groups of modules communicating with each other, i.e. sharing a network (union-find)
+  std::map<ApplicationModule*, ApplicationModule*> parent;
+  auto findRoot = [&parent](ApplicationModule *module) {
+    while(parent[module] != module) module = parent[module] = parent[parent[module]];
+    return module;
+  };
+  std::map<const VariableNetwork*, ApplicationModule*> firstModuleOfNetwork;
+  std::list<ApplicationModule*> modules;
+  for(auto &module : getSubmoduleListRecursive()) {
+    auto appModule = dynamic_cast<ApplicationModule*>(module);
+    if(!appModule) continue;
+    modules.push_back(appModule);
+    parent[appModule] = appModule;
+    for(auto &accessor : appModule->getAccessorListRecursive()) {
+      if(!accessor.hasOwner()) continue;
+      auto &first = firstModuleOfNetwork[&accessor.getOwner()];
+      if(!first) first = appModule;
+      else parent[findRoot(appModule)] = findRoot(first);
+    }
+  }
+  std::map<ApplicationModule*, size_t> groupIndex;
+  std::vector<std::list<ApplicationModule*>> groups;
+  for(auto module : modules) {
+    auto root = findRoot(module);
+    if(!groupIndex.count(root)) {
+      groupIndex[root] = groups.size();
+      groups.emplace_back();
+    }
+    groups[groupIndex[root]].push_back(module);
+  }
+
+  // groups containing explicitly placed modules stay on the node of the first of them
+  int nNodes = Numa::getNumberOfNodes();
+  std::vector<size_t> load(nNodes, 0);
+  std::list<std::pair<int, std::list<ApplicationModule*>*>> placement;
+  std::vector<std::list<ApplicationModule*>*> unplacedGroups;
+  for(auto &group : groups) {
+    int node = -1;
+    for(auto module : group) {
+      auto policy = module->getSchedulingPolicy();
+      if(policy.numaNode >= 0) node = policy.numaNode;
+      else if(!policy.cpus.empty()) node = Numa::getNodeOfCpu(policy.cpus.front());
+      if(node >= 0) break;
+    }
+    if(node < 0) {
+      unplacedGroups.push_back(&group);
+      continue;
+    }
+    if(node < nNodes) load[node] += group.size();
+    placement.emplace_back(node, &group);
+  }
+
+  // distribute the other groups evenly, starting with the largest group
+  std::stable_sort(unplacedGroups.begin(), unplacedGroups.end(),
+      [](std::list<ApplicationModule*> *a, std::list<ApplicationModule*> *b) { return a->size() > b->size(); });
+  for(auto group : unplacedGroups) {
+    int node = std::min_element(load.begin(), load.end()) - load.begin();
+    load[node] += group->size();
+    placement.emplace_back(node, group);
+  }
+
+  // add the tags to all modules not placed explicitly
+  for(auto &entry : placement) {
+    for(auto module : *entry.second) {
+      auto policy = module->getSchedulingPolicy();
+      if(policy.numaNode >= 0 || !policy.cpus.empty()) continue;
+      module->addTag("schedNumaNode"+std::to_string(entry.first));
+    }
+  }
+
+}
+
+/*********************************************************************************************************************/
+
+void Application::connectToConstant(VariableNetworkNode node) {
+  networkList.emplace_back();
+  networkList.back().addNode(node);
+
+  bool makeFeeder = !(networkList.back().hasFeedingNode());
+  size_t length = node.getNumberOfElements();
+  auto callable = CreateConstantForUnconnectedVar(node.getValueType(), makeFeeder, length);
+  boost::fusion::for_each(mtca4u::userTypeMap(), callable);
+  assert(callable.done);
+  constantList.emplace_back(callable.theNode);
+  networkList.back().addNode(constantList.back());
+}
+
+/*********************************************************************************************************************/
+
 void Application::checkConnections() {
 
   // check all networks for validity
@@ -151,14 +251,20 @@ void Application::run() {
     module->prepare();
   }
 
+  // restore the internal state of the modules from the snapshot, before their threads are started
+  if(persistenceManager) persistenceManager->restoreStates();
+
   // start the necessary threads for the FanOuts etc.
   for(auto &internalModule : internalModuleList) {
     internalModule->activate();
   }
 
   // read all input variables once, to set the startup value e.g. coming from the config file
-  // (without triggering an action inside the application)
+  // (without triggering an action inside the application). Eliminated modules are skipped, their inputs are either
+  // constants or read by the FusedElementwiseChain replacing them.
   for(auto &module : getSubmoduleListRecursive()) {
+    auto appModule = dynamic_cast<ApplicationModule*>(module);
+    if(appModule && appModule->hasBeenEliminated()) continue;
     for(auto &variable : module->getAccessorList()) {
       if(variable.getDirection() == VariableDirection::consuming) {
         variable.getAppAccessorNoType().readLatest();
@@ -171,6 +277,8 @@ void Application::run() {
     module->run();
   }
 
+  isRunning = true;
+
 }
 
 /*********************************************************************************************************************/
@@ -187,6 +295,7 @@ void Application::shutdown() {
   for(auto &internalModule : internalModuleList) {
     internalModule->deactivate();
   }
+  isRunning = false;
 
   // next deactivate the modules, as they have running threads inside as well
   for(auto &module : getSubmoduleListRecursive()) {
@@ -198,6 +307,35 @@ void Application::shutdown() {
 }
 /*********************************************************************************************************************/
 
+void Application::enableVariableRecording(const std::string &fileName) {
+  variableRecorder = boost::make_shared<VariableRecorder>(fileName);
+}
+
+/*********************************************************************************************************************/
+
+void Application::enablePersistence(const std::string &fileName, std::chrono::milliseconds interval) {
+  persistenceManager = boost::make_shared<PersistenceManager>(fileName, interval);
+  // the snapshot thread is started and stopped together with the FanOuts
+  internalModuleList.push_back(persistenceManager);
+}
+
+/*********************************************************************************************************************/
+
+void Application::enableSharedMemoryPublication(const std::string &segmentName, size_t segmentSize,
+                                                size_t maxVariables, size_t maxStringLength) {
+  sharedMemoryPublisher = boost::make_shared<SharedMemoryPublisher>(segmentName, segmentSize, maxVariables,
+                                                                    maxStringLength);
+}
+
+/*********************************************************************************************************************/
+
+void Application::registerPersistentState(const std::string &name, std::function<std::string()> save,
+                                          std::function<void(const std::string&)> restore) {
+  if(persistenceManager) persistenceManager->registerState(name, save, restore);
+}
+
+/*********************************************************************************************************************/
+
 void Application::generateXML() {
   assert(applicationName != "");
 
@@ -274,9 +412,94 @@ VariableNetwork& Application::connect(VariableNetworkNode a, VariableNetworkNode
 
 /*********************************************************************************************************************/
 
+VariableNetwork& Application::addNetwork(VariableNetworkNode feeder, const std::list<VariableNetworkNode> &consumers) {
+
+  // check the nodes before touching anything, so a failure leaves the application unchanged
+  std::list<VariableNetworkNode> nodes{consumers};
+  nodes.push_front(feeder);
+  for(auto &node : nodes) {
+    if(node.hasOwner()) {
+      throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+          "Cannot add network at runtime: the node '"+node.getName()+"' is already part of a network.");
+    }
+    if(node.getType() != NodeType::Device && node.getType() != NodeType::ControlSystem &&
+       node.getType() != NodeType::Constant) {
+      throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+          "Cannot add network at runtime: only Device, ControlSystem and Constant nodes are supported, but the node '"+
+          node.getName()+"' has a different type.");
+    }
+    if(node.hasExternalTrigger()) {
+      throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+          "Cannot add network at runtime: the node '"+node.getName()+"' requires an external trigger.");
+    }
+  }
+
+  if(consumers.empty()) {
+    throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+        "Cannot add network at runtime: no consumers given for the feeder '"+feeder.getName()+"'.");
+  }
+
+  // build the network with the same code as the connections defined in defineConnections(), which also determines
+  // the direction of the nodes
+  try {
+    for(auto &consumer : consumers) feeder >> consumer;
+    feeder.getOwner().check();
+  }
+  catch(...) {
+    if(feeder.hasOwner()) {
+      VariableNetwork *failed = &(feeder.getOwner());
+      for(auto &node : nodes) {
+        if(node.hasOwner() && &(node.getOwner()) == failed) node.clearOwner();
+      }
+      networkList.remove_if([failed](const VariableNetwork &n) { return &n == failed; });
+    }
+    throw;
+  }
+  VariableNetwork &network = feeder.getOwner();
+
+  // Create the network. All InternalModules added to the end of the internalModuleList belong to this network.
+  size_t nModulesBefore = internalModuleList.size();
+  makeConnectionsForNetwork(network);
+  auto &modules = runtimeNetworkModules[&network];
+  modules.assign(std::next(internalModuleList.begin(), nModulesBefore), internalModuleList.end());
+
+  // start the FanOuts, unless run() will do this later
+  if(isRunning) {
+    for(auto &module : modules) module->activate();
+  }
+
+  return network;
+}
+
+/*********************************************************************************************************************/
+
+void Application::removeNetwork(VariableNetwork &network) {
+
+  auto entry = runtimeNetworkModules.find(&network);
+  if(entry == runtimeNetworkModules.end()) {
+    throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+        "Only networks created with Application::addNetwork() can be removed.");
+  }
+
+  // stop the FanOuts and remove them from the list, so they get destroyed
+  for(auto &module : entry->second) {
+    module->deactivate();
+    internalModuleList.remove(module);
+  }
+  runtimeNetworkModules.erase(entry);
+
+  // release the nodes and remove the network
+  network.getFeedingNode().clearOwner();
+  for(auto &consumer : network.getConsumingNodes()) consumer.clearOwner();
+  networkList.remove_if([&network](const VariableNetwork &n) { return &n == &network; });
+}
+
+/*********************************************************************************************************************/
+
 template<typename UserType>
 boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> Application::createDeviceVariable(const std::string &deviceAlias,
-    const std::string &registerName, VariableDirection direction, UpdateMode mode, size_t nElements) {
+    const std::string &registerName, VariableDirection direction, UpdateMode mode, size_t nElements,
+    size_t writeBlockSize, size_t offset) {
 
   // open device if needed
   if(deviceMap.count(deviceAlias) == 0) {
@@ -289,11 +512,33 @@ boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> Application::createDevic
   if(mode == UpdateMode::push && direction == VariableDirection::consuming) flags = {AccessMode::wait_for_new_data};
 
   // obatin the register accessor from the device
-  auto accessor = deviceMap[deviceAlias]->getRegisterAccessor<UserType>(registerName, nElements, 0, flags);
+  auto accessor = deviceMap[deviceAlias]->getRegisterAccessor<UserType>(registerName, nElements, offset, flags);
 
   // create variable ID
   idMap[accessor->getId()] = getNextVariableId();
 
+  // record the received values if requested. Push-type inputs trigger the application like control system inputs do,
+  // so the VariableReplayer needs to distinguish them from polled inputs.
+  if(variableRecorder && direction == VariableDirection::consuming) {
+    auto kind = mode == UpdateMode::push ? VariableRecorder::VariableKind::devicePushInput
+                                         : VariableRecorder::VariableKind::deviceInput;
+    auto variableId = variableRecorder->addVariable<UserType>(kind, registerName, deviceAlias, nElements);
+    accessor = boost::make_shared<RecorderDecoratorRegisterAccessor<UserType>>(accessor, variableRecorder, variableId);
+  }
+
+  // write only the changed blocks if requested, using one device variable with the corresponding offset per block
+  if(writeBlockSize > 0 && direction == VariableDirection::feeding && accessor->getNumberOfChannels() == 1 &&
+     accessor->getNumberOfSamples() > writeBlockSize) {
+    std::vector<boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>>> blocks;
+    size_t nSamples = accessor->getNumberOfSamples();
+    for(size_t blockOffset = 0; blockOffset < nSamples; blockOffset += writeBlockSize) {
+      size_t length = blockOffset+writeBlockSize <= nSamples ? writeBlockSize : nSamples-blockOffset;
+      blocks.push_back(createDeviceVariable<UserType>(deviceAlias, registerName, direction, mode, length, 0,
+                                                      offset+blockOffset));
+    }
+    accessor = boost::make_shared<DirtyRangeDecoratorRegisterAccessor<UserType>>(accessor, blocks);
+  }
+
   // return accessor
   return accessor;
 }
@@ -312,14 +557,46 @@ boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> Application::createProce
     dir = SynchronizationDirection::deviceToControlSystem;
   }
 
-  // create the ProcessArray for the proper UserType
-  auto pvar = _processVariableManager->createProcessArray<UserType>(dir, node.getPublicName(), node.getNumberOfElements(),
-                                                                    node.getOwner().getUnit(), node.getOwner().getDescription());
+  // create the ProcessArray for the proper UserType, with the queue length given by the QueuePolicy of the network
+  boost::shared_ptr<ProcessArray<UserType>> pvar;
+  auto queuePolicy = node.getOwner().getQueuePolicy();
+  if(queuePolicy.isEnabled()) {
+    pvar = _processVariableManager->createProcessArray<UserType>(dir, node.getPublicName(), node.getNumberOfElements(),
+        node.getOwner().getUnit(), node.getOwner().getDescription(), UserType(), queuePolicy.getNumberOfBuffers());
+  }
+  else {
+    pvar = _processVariableManager->createProcessArray<UserType>(dir, node.getPublicName(), node.getNumberOfElements(),
+        node.getOwner().getUnit(), node.getOwner().getDescription());
+  }
   assert(pvar->getName() != "");
 
   // create variable ID
   idMap[pvar->getId()] = getNextVariableId();
   pvIdMap[pvar->getUniqueId()] = idMap[pvar->getId()];
+  boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> accessor = pvar;
+
+  // record all values if requested. Feeding control system nodes are inputs of the application.
+  if(variableRecorder) {
+    auto kind = node.getDirection() == VariableDirection::feeding ? VariableRecorder::VariableKind::controlSystemInput
+                                                                  : VariableRecorder::VariableKind::controlSystemOutput;
+    auto variableId = variableRecorder->addVariable<UserType>(kind, node.getPublicName(), "",
+                                                              node.getNumberOfElements());
+    accessor = boost::make_shared<RecorderDecoratorRegisterAccessor<UserType>>(accessor, variableRecorder, variableId);
+  }
+
+  // keep the values for the snapshots and restore the control system inputs from the last snapshot if enabled
+  if(persistenceManager) {
+    auto variableId = persistenceManager->addVariable<UserType>(node.getPublicName(), node.getNumberOfElements());
+    accessor = boost::make_shared<PersistenceDecoratorRegisterAccessor<UserType>>(accessor, persistenceManager,
+                                                                                  variableId);
+  }
+
+  // mirror the values into shared memory for local readers if enabled
+  if(sharedMemoryPublisher) {
+    auto slot = sharedMemoryPublisher->addVariable<UserType>(node.getPublicName(), node.getNumberOfElements());
+    accessor = boost::make_shared<SharedMemoryDecoratorRegisterAccessor<UserType>>(accessor, sharedMemoryPublisher,
+                                                                                   slot);
+  }
 
   // Decorate the process variable if testable mode is enabled and this is the receiving end of the variable.
   // Also don't decorate, if the mode is polling. Instead flag the variable to be polling, so the TestFacility is aware of this.
@@ -335,7 +612,7 @@ boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> Application::createProce
     }
 
     if(mode != UpdateMode::poll) {
-      auto pvarDec = boost::make_shared<TestDecoratorRegisterAccessor<UserType>>(pvar);
+      auto pvarDec = boost::make_shared<TestDecoratorRegisterAccessor<UserType>>(accessor);
       testableMode_names[idMap[pvarDec->getId()]] = "ControlSystem:"+node.getPublicName();
       return pvarDec;
     }
@@ -345,7 +622,7 @@ boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> Application::createProce
   }
 
   // return the process variable
-  return pvar;
+  return accessor;
 }
 
 /*********************************************************************************************************************/
@@ -359,10 +636,17 @@ std::pair< boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>>, boost::share
   std::string name = node.getName();
   assert(name != "");
 
-  // create the ProcessArray for the proper UserType
+  // create the ProcessArray for the proper UserType, with the queue length given by the QueuePolicy of the network
   std::pair< boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>>,
             boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> > pvarPair;
-  pvarPair = createSynchronizedProcessArray<UserType>(nElements, name);
+  auto queuePolicy = node.getOwner().getQueuePolicy();
+  if(queuePolicy.isEnabled()) {
+    pvarPair = createSynchronizedProcessArray<UserType>(nElements, name, "", "", UserType(),
+                                                        queuePolicy.getNumberOfBuffers());
+  }
+  else {
+    pvarPair = createSynchronizedProcessArray<UserType>(nElements, name);
+  }
   assert(pvarPair.first->getName() != "");
   assert(pvarPair.second->getName() != "");
 
@@ -371,6 +655,15 @@ std::pair< boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>>, boost::share
   idMap[pvarPair.first->getId()] = varId;
   idMap[pvarPair.second->getId()] = varId;
 
+  // apply the overflow policy of the queue (not in testable mode, see QueuePolicy)
+  if(!testableMode && queuePolicy.overflow != QueuePolicy::Overflow::dropOldest) {
+    auto fillLevel = boost::make_shared<QueueFillLevel>(queuePolicy);
+    node.getOwner().getStatistics()->addQueue(fillLevel);
+    pvarPair.first = boost::make_shared<QueueSenderDecoratorRegisterAccessor<UserType>>(pvarPair.first, fillLevel);
+    pvarPair.second = boost::make_shared<QueueReceiverDecoratorRegisterAccessor<UserType>>(pvarPair.second,
+                                                                                           fillLevel);
+  }
+
   // decorate the process variable if testable mode is enabled and mode is push-type
   if(testableMode && node.getMode() == UpdateMode::push) {
     pvarPair.first = boost::make_shared<TestDecoratorRegisterAccessor<UserType>>(pvarPair.first);
@@ -406,8 +699,99 @@ std::pair< boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>>, boost::share
 
 /*********************************************************************************************************************/
 
+template<typename UserType>
+boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> Application::applyWaitPolicy(
+    boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> impl, VariableNetworkNode const &consumer) {
+
+  if(consumer.getMode() != UpdateMode::push) return impl;
+
+  // the decorator is applied also for plain blocking, since it excludes the time spent waiting from the active time
+  // of the thread (see Profiler). In testable mode the threads must block in the TestDecoratorRegisterAccessor to
+  // release the lock, so the policy from the tags is ignored.
+  WaitPolicy policy;
+  if(!testableMode) policy = WaitPolicy::fromTags(consumer.getTags());
+  return boost::make_shared<WaitPolicyDecoratorRegisterAccessor<UserType>>(impl, policy);
+}
+
+/*********************************************************************************************************************/
+
+template<typename UserType>
+boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> Application::applyWriteBatching(
+    boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> impl, VariableNetworkNode const &feeder,
+    const std::string &deviceAlias) {
+  if(feeder.getTags().count(DeviceWriteBatch::tag) == 0) return impl;
+
+  // one batch per module and device, since the batch is flushed by the module thread
+  auto &batch = deviceWriteBatches[std::make_pair(feeder.getOwningModule(), deviceAlias)];
+  if(!batch) batch = boost::make_shared<DeviceWriteBatch>();
+  return boost::make_shared<BatchedWriteDecoratorRegisterAccessor<UserType>>(impl, batch);
+}
+
+/*********************************************************************************************************************/
+
+size_t Application::getWriteBlockSize(VariableNetworkNode const &feeder) {
+  auto tags = feeder.getTags();
+  if(tags.count(DirtyRangeWrites::tag) == 0) return 0;
+  if(tags.count(DeviceWriteBatch::tag) != 0) return 0;
+  return DirtyRangeWrites::defaultBlockSize;
+}
+
+/*********************************************************************************************************************/
+
+template<typename UserType>
+boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> Application::applyPollCache(
+    boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> impl, VariableNetworkNode const &feeder) {
+  auto maxAge = getPollCacheMaxAge(feeder);
+  if(!maxAge) return impl;
+
+  // one cache per register, the first implementation is used to read the register for all consumers
+  std::string key = feeder.getDeviceAlias()+"/"+feeder.getRegisterName()+"/"+
+                    std::to_string(feeder.getNumberOfElements())+"/"+typeid(UserType).name();
+  auto &entry = pollCacheEntries[key];
+  if(!entry) {
+    std::string name = feeder.getOwner().getName();
+    entry = boost::make_shared<PollCacheEntry<UserType>>(name, impl, *maxAge);
+    if(statisticsModule) {
+      statisticsModule->addCounter(name+"/cacheHits", "Number of polls served from the cache", entry->hits);
+      statisticsModule->addCounter(name+"/cacheMisses", "Number of polls read from the device", entry->misses);
+    }
+  }
+  auto typedEntry = boost::dynamic_pointer_cast<PollCacheEntry<UserType>>(entry);
+  assert(typedEntry != nullptr);
+  return boost::make_shared<PollCacheDecoratorRegisterAccessor<UserType>>(impl, typedEntry);
+}
+
+/*********************************************************************************************************************/
+
+const std::chrono::microseconds* Application::getPollCacheMaxAge(VariableNetworkNode const &feeder) const {
+  const std::string &alias = feeder.getDeviceAlias();
+
+  // the setting for the register takes precedence over the setting for the device
+  auto maxAge = pollCacheMaxAges.find(std::make_pair(alias, feeder.getRegisterName()));
+  if(maxAge == pollCacheMaxAges.end()) maxAge = pollCacheMaxAges.find(std::make_pair(alias, std::string()));
+  if(maxAge == pollCacheMaxAges.end()) return nullptr;
+  return &maxAge->second;
+}
+
+/*********************************************************************************************************************/
+
+template<typename UserType>
+boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> Application::countUpdates(
+    boost::shared_ptr<mtca4u::NDRegisterAccessor<UserType>> impl, VariableNetwork &network) {
+  return boost::make_shared<StatisticsDecoratorRegisterAccessor<UserType>>(impl,
+                                                                          network.getStatistics()->addCounters());
+}
+
+/*********************************************************************************************************************/
+
 void Application::makeConnections() {
 
+  // create the publisher of the statistics, the networks are added when their connections are made
+  if(statisticsEnabled && !statisticsModule) {
+    statisticsModule = boost::make_shared<StatisticsModule>(_processVariableManager, statisticsInterval);
+    internalModuleList.push_back(statisticsModule);
+  }
+
   // apply optimisations
   // note: checks may not be run before since sometimes networks may only be valid after optimisations
   optimiseConnections();
@@ -429,6 +813,13 @@ void Application::optimiseConnections() {
   // list of iterators of networks to be removed from the networkList after the merge operation
   std::list<VariableNetwork*> deleteNetworks;
 
+  auto hasPollingConsumer = [](const VariableNetwork &network) {
+    for(auto &consumer : network.getConsumingNodes()) {
+      if(consumer.getMode() == UpdateMode::poll) return true;
+    }
+    return false;
+  };
+
   // search for networks with the same feeder
   for(auto it1 = networkList.begin(); it1 != networkList.end(); ++it1) {
     for(auto it2 = it1; it2 != networkList.end(); ++it2) {
@@ -456,6 +847,12 @@ void Application::optimiseConnections() {
       // check if transfer mode is the same
       if(feeder1.getMode() != feeder2.getMode()) continue;
 
+      // networks with a poll-type feeder and no trigger which both have their own polling consumer would form an
+      // illegal network when merged. If the poll cache is enabled for the register, they are kept separate and share
+      // the transfers via the cache instead, see enablePollCache().
+      if(feeder1.getMode() == UpdateMode::poll && !feeder1.hasExternalTrigger() && getPollCacheMaxAge(feeder1) &&
+         hasPollingConsumer(*it1) && hasPollingConsumer(*it2)) continue;
+
       // check if triggers are compatible, if present
       if(feeder1.hasExternalTrigger() != feeder2.hasExternalTrigger()) continue;
       if(feeder1.hasExternalTrigger()) {
@@ -489,6 +886,198 @@ void Application::optimiseConnections() {
     networkList.remove(*net);
   }
 
+  // remove modules which just pass through values
+  eliminatePassThroughModules();
+
+  // execute chains of element-wise operations in a single thread
+  fuseElementwiseChains();
+
+}
+
+/*********************************************************************************************************************/
+
+namespace {
+  /** Check whether the given network contains nodes of the given type */
+  bool networkHasNodeType(const VariableNetwork &network, NodeType type) {
+    if(network.getFeedingNode().getType() == type) return true;
+    for(auto &node : network.getConsumingNodes()) {
+      if(node.getType() == type) return true;
+    }
+    return false;
+  }
+
+  /** Check whether the given network is valid (see VariableNetwork::check()) */
+  bool networkIsValid(const VariableNetwork &network) {
+    try {
+      network.check();
+    }
+    catch(ApplicationException&) {
+      return false;
+    }
+    return true;
+  }
+}
+
+/*********************************************************************************************************************/
+
+void Application::eliminatePassThroughModules() {
+
+  for(auto &module : getSubmoduleListRecursive()) {
+    auto appModule = dynamic_cast<ApplicationModule*>(module);
+    if(!appModule || appModule->getPassThroughPairs().empty()) continue;
+
+    // the module can only be eliminated if it does nothing but passing through values
+    if(appModule->getAccessorListRecursive().size() != 2*appModule->getPassThroughPairs().size()) continue;
+
+    // check if all pairs can be spliced
+    bool canEliminate = true;
+    for(auto &pair : appModule->getPassThroughPairs()) {
+      auto &input = pair.first;
+      auto &output = pair.second;
+      if(!input.hasOwner() || !output.hasOwner()) { canEliminate = false; break; }
+      auto &inputNetwork = input.getOwner();
+      auto &outputNetwork = output.getOwner();
+
+      // both networks must be valid by themselves, otherwise the error would be hidden or reported for the spliced
+      // network which has not been declared by the user
+      if(!networkIsValid(inputNetwork) || !networkIsValid(outputNetwork)) { canEliminate = false; break; }
+
+      // the input must be a push-type consumer and the output the feeder of a different network
+      if(&inputNetwork == &outputNetwork) { canEliminate = false; break; }
+      if(input.getDirection() != VariableDirection::consuming || input.getMode() != UpdateMode::push) {
+        canEliminate = false;
+        break;
+      }
+      if(output.getDirection() != VariableDirection::feeding) { canEliminate = false; break; }
+
+      // type and length must match
+      if(input.getValueType() != output.getValueType()) { canEliminate = false; break; }
+      if(input.getNumberOfElements() != output.getNumberOfElements()) { canEliminate = false; break; }
+
+      // the output must not be used as a trigger, since the triggered networks refer to the output node
+      if(networkHasNodeType(outputNetwork, NodeType::TriggerReceiver)) { canEliminate = false; break; }
+
+      // if the output is unconnected, there is nothing to connect the input's feeder to
+      if(networkHasNodeType(outputNetwork, NodeType::Constant)) { canEliminate = false; break; }
+
+      // control system variables in both networks must be able to share the same unit and description
+      if(networkHasNodeType(inputNetwork, NodeType::ControlSystem) &&
+         networkHasNodeType(outputNetwork, NodeType::ControlSystem)) {
+        if(inputNetwork.getUnit() != outputNetwork.getUnit()) { canEliminate = false; break; }
+        if(inputNetwork.getDescription() != outputNetwork.getDescription()) { canEliminate = false; break; }
+      }
+    }
+    if(!canEliminate) continue;
+
+    // splice the networks: move the consumers of the output network to the input network
+    for(auto &pair : appModule->getPassThroughPairs()) {
+      auto input = pair.first;
+      auto output = pair.second;
+      auto &inputNetwork = input.getOwner();
+      auto &outputNetwork = output.getOwner();
+
+      // keep the meta data of published variables
+      bool useOutputMetaData = networkHasNodeType(outputNetwork, NodeType::ControlSystem);
+      std::string unit = outputNetwork.getUnit();
+      std::string description = outputNetwork.getDescription();
+
+      inputNetwork.removeNode(input);
+      input.clearOwner();
+      for(auto consumer : outputNetwork.getConsumingNodes()) {
+        outputNetwork.removeNode(consumer);
+        consumer.clearOwner();
+        inputNetwork.addNode(consumer);
+      }
+      if(useOutputMetaData) inputNetwork.setMetaData(unit, description);
+
+      // remove the now empty output network
+      outputNetwork.removeNode(output);
+      output.clearOwner();
+      VariableNetwork *outputNetworkPtr = &outputNetwork;
+      networkList.remove_if([outputNetworkPtr](const VariableNetwork &network) { return &network == outputNetworkPtr; });
+
+      // the accessors of the module stay valid but are connected to constants, since the module will not run
+      connectToConstant(input);
+      connectToConstant(output);
+    }
+    appModule->eliminated = true;
+  }
+
+}
+
+/*********************************************************************************************************************/
+
+void Application::fuseElementwiseChains() {
+
+  // collect all modules which can be fused, indexed by the unique ID of their input node
+  std::list<ElementwiseStage*> stages;
+  std::map<const void*, ElementwiseStage*> stageByInput;
+  for(auto &module : getSubmoduleListRecursive()) {
+    auto appModule = dynamic_cast<ApplicationModule*>(module);
+    if(!appModule || appModule->hasBeenEliminated()) continue;
+    auto stage = dynamic_cast<ElementwiseStage*>(module);
+    if(!stage || !stage->isFusable()) continue;
+    if(!stage->getStageInput().hasOwner() || !stage->getStageOutput().hasOwner()) continue;
+    stages.push_back(stage);
+    stageByInput[stage->getStageInput().getUniqueId()] = stage;
+  }
+
+  // find the successor of each stage: the output must be connected 1:1 to the input of another stage
+  std::map<ElementwiseStage*, ElementwiseStage*> successor;
+  std::set<ElementwiseStage*> hasPredecessor;
+  for(auto stage : stages) {
+    auto &outputNetwork = stage->getStageOutput().getOwner();
+    if(outputNetwork.countConsumingNodes() != 1) continue;
+    auto next = stageByInput.find(outputNetwork.getConsumingNodes().front().getUniqueId());
+    if(next == stageByInput.end() || next->second == stage) continue;
+
+    // the network is removed below, so it must be checked here (e.g. for matching lengths), since
+    // checkConnections() is called only afterwards
+    if(!networkIsValid(outputNetwork)) continue;
+    if(stage->getStageNumberOfElements() != next->second->getStageNumberOfElements()) continue;
+    successor[stage] = next->second;
+    hasPredecessor.insert(next->second);
+  }
+
+  // build the chains, starting from each stage without predecessor
+  for(auto first : stages) {
+    if(hasPredecessor.count(first) || !successor.count(first)) continue;
+    std::vector<ElementwiseStage*> chain{first};
+    while(successor.count(chain.back())) chain.push_back(successor[chain.back()]);
+
+    // remove the networks between the stages. The accessors are connected to constants instead.
+    for(size_t i=0; i<chain.size()-1; ++i) {
+      auto output = chain[i]->getStageOutput();
+      auto input = chain[i+1]->getStageInput();
+      VariableNetwork *networkPtr = &output.getOwner();
+      networkPtr->removeNode(output);
+      networkPtr->removeNode(input);
+      output.clearOwner();
+      input.clearOwner();
+      networkList.remove_if([networkPtr](const VariableNetwork &network) { return &network == networkPtr; });
+      connectToConstant(output);
+      connectToConstant(input);
+    }
+
+    // the stages are executed by the FusedElementwiseChain, so the module threads must not be started. The thread of
+    // the chain uses the most urgent scheduling policy and the longest spinning wait policy of the stages.
+    ThreadSchedulingPolicy schedulingPolicy;
+    WaitPolicy waitPolicy;
+    for(auto stage : chain) {
+      auto module = dynamic_cast<ApplicationModule*>(stage);
+      module->eliminated = true;
+      auto stagePolicy = module->getSchedulingPolicy();
+      if(stagePolicy.isMoreUrgentThan(schedulingPolicy)) schedulingPolicy = stagePolicy;
+      auto stageWaitPolicy = module->getWaitPolicy();
+      if(stageWaitPolicy.spinsLongerThan(waitPolicy)) waitPolicy = stageWaitPolicy;
+    }
+    auto fusedChain = boost::make_shared<FusedElementwiseChain>(chain,
+        dynamic_cast<ApplicationModule*>(first)->getQualifiedName());
+    fusedChain->setSchedulingPolicy(schedulingPolicy);
+    fusedChain->setWaitPolicy(waitPolicy);
+    internalModuleList.push_back(fusedChain);
+  }
+
 }
 
 /*********************************************************************************************************************/
@@ -501,6 +1090,23 @@ void Application::dumpConnections() {
   std::cout << "=====================================================================" << std::endl;  // LCOV_EXCL_LINE
 }                                                                                                     // LCOV_EXCL_LINE
 
+void Application::dumpStatistics(std::ostream &stream) {
+  stream << "==== Statistics of all variable networks of the current Application ====" << std::endl;
+  for(auto &network : networkList) {
+    if(network.getFeedingNode().getType() == NodeType::Constant) continue;
+    auto snapshot = network.getStatistics()->aggregate();
+    stream << network.getName() << ": " << snapshot.updates << " updates (" << snapshot.updateRate << " Hz), "
+           << snapshot.dataLost << " lost, queue fill " << snapshot.queueFill << std::endl;
+  }
+  for(auto &entry : pollCacheEntries) {
+    stream << entry.second->name << ": " << *(entry.second->hits) << " cache hits, " << *(entry.second->misses)
+           << " cache misses" << std::endl;
+  }
+  stream << "========================================================================" << std::endl;
+}
+
+/*********************************************************************************************************************/
+
 void Application::dumpConnectionGraph(const std::string& fileName) {
     std::fstream file{fileName, std::ios_base::out};
 
@@ -510,20 +1116,23 @@ void Application::dumpConnectionGraph(const std::string& fileName) {
 
 /*********************************************************************************************************************/
 
-Application::TypedMakeConnectionCaller::TypedMakeConnectionCaller(Application &owner, VariableNetwork &network)
-: _owner(owner), _network(network) {}
+template<typename PAIR>
+void Application::TypedMakeConnectionTableFiller::operator()(PAIR&) const {
+  _table[typeid(typename PAIR::first_type)] = &Application::typedMakeConnection<typename PAIR::first_type>;
+}
 
 /*********************************************************************************************************************/
 
-template<typename PAIR>
-void Application::TypedMakeConnectionCaller::operator()(PAIR&) const {
-  if(typeid(typename PAIR::first_type) != _network.getValueType()) return;
-  _owner.typedMakeConnection<typename PAIR::first_type>(_network);
-  done = true;
+std::map<std::type_index, VariableNetwork::TypedMakeConnectionFunction> Application::createTypedMakeConnectionTable() {
+  std::map<std::type_index, VariableNetwork::TypedMakeConnectionFunction> table;
+  boost::fusion::for_each(mtca4u::userTypeMap(), TypedMakeConnectionTableFiller{table});
+  return table;
 }
 
-/*********************************************************************************************************************/
+const std::map<std::type_index, VariableNetwork::TypedMakeConnectionFunction> Application::typedMakeConnectionTable =
+    Application::createTypedMakeConnectionTable();
 
+/*********************************************************************************************************************/
 
 void Application::makeConnectionsForNetwork(VariableNetwork &network) {
 
@@ -536,13 +1145,31 @@ void Application::makeConnectionsForNetwork(VariableNetwork &network) {
     if(!dependency.isCreated()) makeConnectionsForNetwork(dependency);
   }
 
-  // defer actual network creation to templated function
-  auto callable = TypedMakeConnectionCaller(*this, network);
-  boost::fusion::for_each(mtca4u::userTypeMap(), callable);
-  assert(callable.done);
+  // defer actual network creation to templated function. If the function has been set already (see
+  // StaticConnection), call it directly, otherwise select it based on the value type of the network.
+  auto function = network.getTypedMakeConnection();
+  if(!function) {
+    auto entry = typedMakeConnectionTable.find(network.getValueType());
+    if(entry == typedMakeConnectionTable.end()) {
+      throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+          std::string("Unsupported value type of variable network: ")+network.getValueType().name());
+    }
+    function = entry->second;
+  }
+  {
+    // allocate the buffers of the network on the NUMA node of the consumers, since they are written only once per
+    // update but may be read many times
+    Numa::PreferredNodeScope numaScope(network.getConsumerNumaNode());
+    (this->*function)(network);
+  }
 
   // mark the network as created
   network.markCreated();
+
+  // publish the statistics of the network if enabled. Networks fed by constants have no updates.
+  if(statisticsModule && network.getFeedingNode().getType() != NodeType::Constant) {
+    statisticsModule->addNetwork(network.getName(), network.getStatistics());
+  }
 }
 
 /*********************************************************************************************************************/
@@ -570,6 +1197,7 @@ void Application::typedMakeConnection(VariableNetwork &network) {
     if(feeder.getType() == NodeType::Device) {
       feedingImpl = createDeviceVariable<UserType>(feeder.getDeviceAlias(), feeder.getRegisterName(),
           VariableDirection::consuming, feeder.getMode(), feeder.getNumberOfElements());
+      if(!useExternalTrigger && feeder.getMode() == UpdateMode::poll) feedingImpl = applyPollCache(feedingImpl, feeder);
     }
     else if(feeder.getType() == NodeType::ControlSystem) {
       feedingImpl = createProcessVariable<UserType>(feeder);
@@ -582,23 +1210,31 @@ void Application::typedMakeConnection(VariableNetwork &network) {
     if(nNodes == 2 && !useExternalTrigger) {
       auto consumer = consumers.front();
       if(consumer.getType() == NodeType::Application) {
-        consumer.getAppAccessor<UserType>().replace(feedingImpl);
+        consumer.getAppAccessor<UserType>().replace(applyWaitPolicy(countUpdates(feedingImpl, network), consumer));
         connectionMade = true;
       }
       else if(consumer.getType() == NodeType::Device) {
         auto consumingImpl = createDeviceVariable<UserType>(consumer.getDeviceAlias(), consumer.getRegisterName(),
             VariableDirection::feeding, consumer.getMode(), consumer.getNumberOfElements());
         // connect the Device with e.g. a ControlSystem node via a ThreadedFanOut
-        auto fanOut = boost::make_shared<ThreadedFanOut<UserType>>(feedingImpl);
+        auto fanOut = boost::make_shared<ThreadedFanOut<UserType>>(feedingImpl, network.getPublicationPolicy(),
+                                                                   network.getDroppedUpdatesCounter());
         fanOut->addSlave(consumingImpl);
+        fanOut->setStatisticsCounters(network.getStatistics()->addCounters());
+        fanOut->setSchedulingPolicy(network.getSchedulingPolicy());
+        if(!testableMode) fanOut->setWaitPolicy(network.getWaitPolicy());
         internalModuleList.push_back(fanOut);
         connectionMade = true;
       }
       else if(consumer.getType() == NodeType::ControlSystem) {
         auto consumingImpl = createProcessVariable<UserType>(consumer);
         // connect the ControlSystem with e.g. a Device node via an ThreadedFanOut
-        auto fanOut = boost::make_shared<ThreadedFanOut<UserType>>(feedingImpl);
+        auto fanOut = boost::make_shared<ThreadedFanOut<UserType>>(feedingImpl, network.getPublicationPolicy(),
+                                                                   network.getDroppedUpdatesCounter());
         fanOut->addSlave(consumingImpl);
+        fanOut->setStatisticsCounters(network.getStatistics()->addCounters());
+        fanOut->setSchedulingPolicy(network.getSchedulingPolicy());
+        if(!testableMode) fanOut->setWaitPolicy(network.getWaitPolicy());
         internalModuleList.push_back(fanOut);
         connectionMade = true;
       }
@@ -624,12 +1260,24 @@ void Application::typedMakeConnection(VariableNetwork &network) {
           triggerMap[triggerNode.getUniqueId()] = triggerFanOut;
           internalModuleList.push_back(triggerFanOut);
         }
+        // the TriggerFanOut serves several networks, so it uses the most urgent policy of them
+        auto schedulingPolicy = network.getSchedulingPolicy();
+        if(schedulingPolicy.isMoreUrgentThan(triggerFanOut->getSchedulingPolicy())) {
+          triggerFanOut->setSchedulingPolicy(schedulingPolicy);
+        }
+        auto waitPolicy = network.getWaitPolicy();
+        if(!testableMode && waitPolicy.spinsLongerThan(triggerFanOut->getWaitPolicy())) {
+          triggerFanOut->setWaitPolicy(waitPolicy);
+        }
         fanOut = triggerFanOut->addNetwork(feedingImpl);
       }
       else if(useFeederTrigger) {
         // if the trigger is provided by the pushing feeder, use the treaded version of the FanOut to distribute
         // new values immediately to all consumers.
-        auto threadedFanOut = boost::make_shared<ThreadedFanOut<UserType>>(feedingImpl);
+        auto threadedFanOut = boost::make_shared<ThreadedFanOut<UserType>>(feedingImpl, network.getPublicationPolicy(),
+                                                                           network.getDroppedUpdatesCounter());
+        threadedFanOut->setSchedulingPolicy(network.getSchedulingPolicy());
+        if(!testableMode) threadedFanOut->setWaitPolicy(network.getWaitPolicy());
         internalModuleList.push_back(threadedFanOut);
         fanOut = threadedFanOut;
       }
@@ -639,6 +1287,8 @@ void Application::typedMakeConnection(VariableNetwork &network) {
         fanOut = consumingFanOut;
       }
 
+      fanOut->setStatisticsCounters(network.getStatistics()->addCounters());
+
       // In case we have one or more trigger receivers among our consumers, we produce exactly one application variable
       // for it. We never need more, since the distribution is done with a TriggerFanOut.
       bool usedTriggerReceiver{false};        // flag if we already have a trigger receiver
@@ -654,7 +1304,7 @@ void Application::typedMakeConnection(VariableNetwork &network) {
           else {
             auto impls = createApplicationVariable<UserType>(consumer);
             fanOut->addSlave(impls.first);
-            consumer.getAppAccessor<UserType>().replace(impls.second);
+            consumer.getAppAccessor<UserType>().replace(applyWaitPolicy(impls.second, consumer));
           }
         }
         else if(consumer.getType() == NodeType::ControlSystem) {
@@ -690,24 +1340,25 @@ void Application::typedMakeConnection(VariableNetwork &network) {
       auto consumer = consumers.front();
       if(consumer.getType() == NodeType::Application) {
         auto impls = createApplicationVariable<UserType>(feeder,consumer);
-        feeder.getAppAccessor<UserType>().replace(impls.first);
-        consumer.getAppAccessor<UserType>().replace(impls.second);
+        feeder.getAppAccessor<UserType>().replace(countUpdates(impls.first, network));
+        consumer.getAppAccessor<UserType>().replace(applyWaitPolicy(impls.second, consumer));
         connectionMade = true;
       }
       else if(consumer.getType() == NodeType::ControlSystem) {
         auto impl = createProcessVariable<UserType>(consumer);
-        feeder.getAppAccessor<UserType>().replace(impl);
+        feeder.getAppAccessor<UserType>().replace(countUpdates(impl, network));
         connectionMade = true;
       }
       else if(consumer.getType() == NodeType::Device) {
         auto impl = createDeviceVariable<UserType>(consumer.getDeviceAlias(), consumer.getRegisterName(),
-            VariableDirection::feeding, consumer.getMode(), consumer.getNumberOfElements());
-        feeder.getAppAccessor<UserType>().replace(impl);
+            VariableDirection::feeding, consumer.getMode(), consumer.getNumberOfElements(), getWriteBlockSize(feeder));
+        impl = applyWriteBatching(impl, feeder, consumer.getDeviceAlias());
+        feeder.getAppAccessor<UserType>().replace(countUpdates(impl, network));
         connectionMade = true;
       }
       else if(consumer.getType() == NodeType::TriggerReceiver) {
         auto impls = createApplicationVariable<UserType>(feeder,consumer);
-        feeder.getAppAccessor<UserType>().replace(impls.first);
+        feeder.getAppAccessor<UserType>().replace(countUpdates(impls.first, network));
         consumer.getNodeToTrigger().getOwner().setExternalTriggerImpl(impls.second);
         connectionMade = true;
       }
@@ -724,6 +1375,7 @@ void Application::typedMakeConnection(VariableNetwork &network) {
       // create FanOut and use it as the feeder implementation
       auto fanOut = boost::make_shared<FeedingFanOut<UserType>>(feeder.getName(), feeder.getUnit(),
                                                                 feeder.getDescription(), feeder.getNumberOfElements());
+      fanOut->setStatisticsCounters(network.getStatistics()->addCounters());
       feeder.getAppAccessor<UserType>().replace(fanOut);
 
       // In case we have one or more trigger receivers among our consumers, we produce exactly one application variable
@@ -735,7 +1387,7 @@ void Application::typedMakeConnection(VariableNetwork &network) {
         if(consumer.getType() == NodeType::Application) {
           auto impls = createApplicationVariable<UserType>(consumer);
           fanOut->addSlave(impls.first);
-          consumer.getAppAccessor<UserType>().replace(impls.second);
+          consumer.getAppAccessor<UserType>().replace(applyWaitPolicy(impls.second, consumer));
         }
         else if(consumer.getType() == NodeType::ControlSystem) {
           auto impl = createProcessVariable<UserType>(consumer);
@@ -743,7 +1395,9 @@ void Application::typedMakeConnection(VariableNetwork &network) {
         }
         else if(consumer.getType() == NodeType::Device) {
           auto impl = createDeviceVariable<UserType>(consumer.getDeviceAlias(), consumer.getRegisterName(),
-              VariableDirection::feeding, consumer.getMode(), consumer.getNumberOfElements());
+              VariableDirection::feeding, consumer.getMode(), consumer.getNumberOfElements(),
+              getWriteBlockSize(feeder));
+          impl = applyWriteBatching(impl, feeder, consumer.getDeviceAlias());
           fanOut->addSlave(impl);
         }
         else if(consumer.getType() == NodeType::TriggerReceiver) {
@@ -840,13 +1494,35 @@ void Application::stepApplication() {
 
 /*********************************************************************************************************************/
 
+/** Implementation of Application::readAny() outside testable mode, which spins according to the WaitPolicy of the
+ *  calling thread before blocking. The waiting time is excluded from the active time of the thread (see Profiler). */
+template<typename ELEMENT>
+static mtca4u::TransferElementID readAnyWithWaitPolicy(std::list<std::reference_wrapper<ELEMENT>> &elementsToRead) {
+  mtca4u::TransferElementID id;
+  WaitPolicy::currentThread().wait([&elementsToRead, &id] {
+                for(auto &element : elementsToRead) {
+                  if(element.get().readNonBlocking()) {
+                    id = element.get().getId();
+                    return true;
+                  }
+                }
+                return false;
+              },
+              [&elementsToRead, &id] { id = ChimeraTK::readAny(elementsToRead); });
+  return id;
+}
+
+/*********************************************************************************************************************/
+
 mtca4u::TransferElementID Application::readAny(std::list<std::reference_wrapper<TransferElementAbstractor>> elementsToRead) {
   if(!Application::getInstance().testableMode) {
-    return ChimeraTK::readAny(elementsToRead);
+    return readAnyWithWaitPolicy(elementsToRead);
   }
   else {
     testableModeUnlock("readAny");
+    Profiler::stopMeasurement();
     auto ret = ChimeraTK::readAny(elementsToRead);
+    Profiler::startMeasurement();
     assert(testableModeTestLock());  // lock is acquired inside readAny(), since TestDecoratorTransferFuture::wait() is called there.
     return ret;
   }
@@ -856,11 +1532,13 @@ mtca4u::TransferElementID Application::readAny(std::list<std::reference_wrapper<
 
 mtca4u::TransferElementID Application::readAny(std::list<std::reference_wrapper<TransferElement>> elementsToRead) {
   if(!Application::getInstance().testableMode) {
-    return ChimeraTK::readAny(elementsToRead);
+    return readAnyWithWaitPolicy(elementsToRead);
   }
   else {
     testableModeUnlock("readAny");
+    Profiler::stopMeasurement();
     auto ret = ChimeraTK::readAny(elementsToRead);
+    Profiler::startMeasurement();
     assert(testableModeTestLock());  // lock is acquired inside readAny(), since TestDecoratorTransferFuture::wait() is called there.
     return ret;
   }
@@ -25,8 +25,18 @@ namespace ChimeraTK {
 
   void ApplicationModule::run() {
 
+    // modules eliminated by the connection logic have nothing to do
+    if(eliminated) return;
+
     // start the module thread
     assert(!moduleThread.joinable());
+    schedulingPolicy = getSchedulingPolicy();
+    waitPolicy = getWaitPolicy();
+    deadlineMonitor = nullptr;
+    for(auto submodule : getSubmoduleListRecursive()) {
+      deadlineMonitor = dynamic_cast<DeadlineMonitor*>(submodule);
+      if(deadlineMonitor) break;
+    }
     moduleThread = boost::thread(&ApplicationModule::mainLoopWrapper, this);
   }
 
@@ -50,7 +60,13 @@ namespace ChimeraTK {
 
   void ApplicationModule::mainLoopWrapper() {
     Application::registerThread("ApplicationModule "+getName());
+    schedulingPolicy.apply(Application::threadName());
+    WaitPolicy::currentThread() = waitPolicy;
     Application::testableModeLock("start");
+    // the first cycle starts when entering the main loop, not when the thread has been started
+    Profiler::stopMeasurement();
+    if(deadlineMonitor) Profiler::addCycleObserver(deadlineMonitor);
+    Profiler::startMeasurement();
     // enter the main loop
     mainLoop();
     Application::testableModeUnlock("terminate");
@@ -0,0 +1,69 @@
+/*
+ * DataConsistencyGroup.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "DataConsistencyGroup.h"
+#include "Application.h"
+
+namespace ChimeraTK {
+
+  DataConsistencyGroup::DataConsistencyGroup(
+      std::initializer_list<std::reference_wrapper<mtca4u::TransferElementAbstractor>> elements,
+      IncompletePolicy policy)
+  : policy(policy)
+  {
+    for(auto &element : elements) add(element.get());
+  }
+
+/*********************************************************************************************************************/
+
+  void DataConsistencyGroup::add(mtca4u::TransferElementAbstractor &element) {
+    elements.push_back({element, false});
+    readAnyList.emplace_back(element);
+  }
+
+/*********************************************************************************************************************/
+
+  bool DataConsistencyGroup::update(const mtca4u::TransferElementID &id) {
+    discardedInLastUpdate = false;
+    for(auto &element : elements) {
+      // note: the id must be obtained here, since the implementation of the accessor is replaced when connecting
+      if(element.accessor.get().getId() != id) continue;
+      auto elementVersion = element.accessor.get().getVersionNumber();
+
+      // a newer VersionNumber starts a new set, discarding the current one if it is incomplete
+      if(!hasVersion || version < elementVersion) {
+        if(hasVersion && nMatching > 0 && nMatching < elements.size()) {
+          ++nDiscarded;
+          discardedInLastUpdate = true;
+        }
+        for(auto &other : elements) other.matching = false;
+        nMatching = 0;
+        version = elementVersion;
+        hasVersion = true;
+      }
+
+      // inputs with an older VersionNumber are lagging behind and will catch up later
+      if(elementVersion == version && !element.matching) {
+        element.matching = true;
+        ++nMatching;
+        return nMatching == elements.size();
+      }
+      return false;
+    }
+    return false;
+  }
+
+/*********************************************************************************************************************/
+
+  bool DataConsistencyGroup::readConsistent() {
+    while(true) {
+      auto id = Application::readAny(readAnyList);
+      if(update(id)) return true;
+      if(discardedInLastUpdate && policy == IncompletePolicy::deliver) return false;
+    }
+  }
+
+} /* namespace ChimeraTK */
@@ -0,0 +1,58 @@
+/*
+ * DeadlineMonitor.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <algorithm>
+
+#include "DeadlineMonitor.h"
+#include "ApplicationException.h"
+
+namespace ChimeraTK {
+
+  DeadlineMonitor::DeadlineMonitor(EntityOwner *owner, const std::string &name, std::chrono::microseconds deadline,
+                                   size_t nBins, std::chrono::milliseconds publicationInterval,
+                                   const std::string &description, bool eliminateHierarchy,
+                                   const std::unordered_set<std::string> &tags)
+  : VariableGroup(owner, name, description, eliminateHierarchy, tags),
+    cycleTimeHistogram(this, "cycleTimeHistogram", "", nBins,
+                       "Number of cycles per bin of the cycle time, each bin covers a tenth of the deadline"),
+    _deadline(deadline),
+    _binWidth(std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(deadline)/10),
+    _publicationInterval(publicationInterval),
+    _histogram(nBins, 0)
+  {
+    if(deadline.count() <= 0 || nBins == 0) {
+      throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+          "DeadlineMonitor '"+name+"': the deadline and the number of bins must be positive.");
+    }
+    if(_binWidth.count() == 0) _binWidth = std::chrono::high_resolution_clock::duration(1);
+  }
+
+/*********************************************************************************************************************/
+
+  void DeadlineMonitor::cycleCompleted(std::chrono::high_resolution_clock::duration cycleTime,
+                                       std::chrono::high_resolution_clock::time_point now) {
+    ++_cycles;
+    if(cycleTime > _deadline) ++_overruns;
+    if(cycleTime > _worstCycleTime) _worstCycleTime = cycleTime;
+    size_t bin = cycleTime/_binWidth;
+    ++_histogram[std::min(bin, _histogram.size()-1)];
+    if(now >= _nextPublication) {
+      publish();
+      _nextPublication = now+_publicationInterval;
+    }
+  }
+
+/*********************************************************************************************************************/
+
+  void DeadlineMonitor::publish() {
+    cycles = _cycles;
+    overruns = _overruns;
+    worstCycleTime = std::chrono::duration_cast<std::chrono::microseconds>(_worstCycleTime).count();
+    std::copy(_histogram.begin(), _histogram.end(), cycleTimeHistogram.begin());
+    writeAll();
+  }
+
+} /* namespace ChimeraTK */
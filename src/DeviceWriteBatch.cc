@@ -0,0 +1,49 @@
+/*
+ * DeviceWriteBatch.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "DeviceWriteBatch.h"
+
+namespace ChimeraTK {
+
+  constexpr const char *DeviceWriteBatch::tag;
+
+/*********************************************************************************************************************/
+
+  void DeviceWriteBatch::markPending() {
+    if(pending) return;
+    pending = true;
+    auto &flusher = getThreadFlusher();
+    flusher.pendingBatches.push_back(this);
+    if(!flusher.registered) {
+      Profiler::addCycleObserver(&flusher);
+      flusher.registered = true;
+    }
+  }
+
+/*********************************************************************************************************************/
+
+  void DeviceWriteBatch::flush() {
+    if(!pending) return;
+    pending = false;
+    group.write();
+  }
+
+/*********************************************************************************************************************/
+
+  void DeviceWriteBatch::flushCurrentThread() {
+    auto &flusher = getThreadFlusher();
+    for(auto batch : flusher.pendingBatches) batch->flush();
+    flusher.pendingBatches.clear();
+  }
+
+/*********************************************************************************************************************/
+
+  DeviceWriteBatch::ThreadFlusher& DeviceWriteBatch::getThreadFlusher() {
+    thread_local static ThreadFlusher flusher;
+    return flusher;
+  }
+
+} /* namespace ChimeraTK */
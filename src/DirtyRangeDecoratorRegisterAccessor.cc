@@ -0,0 +1,14 @@
+/*
+ * DirtyRangeDecoratorRegisterAccessor.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "DirtyRangeDecoratorRegisterAccessor.h"
+
+namespace ChimeraTK {
+
+  constexpr const char *DirtyRangeWrites::tag;
+  constexpr size_t DirtyRangeWrites::defaultBlockSize;
+
+} /* namespace ChimeraTK */
@@ -6,7 +6,6 @@
  */
 
 #include <cassert>
-#include <regex>
 #include <iostream>
 
 #include "EntityOwner.h"
@@ -92,7 +91,9 @@ namespace ChimeraTK {
     VirtualModule module{_name, _description, getModuleType()};
 
     // add everything matching the tag to the virtual module and return it
-    findTagAndAppendToModule(module, tag, false, true);
+    TagQuery query(tag);
+    auto matches = [&query](const VariableNetworkNode &node) { return query.matches(node.getTagSet()); };
+    findTagAndAppendToModule(module, matches, false, true);
     return module;
   }
 
@@ -103,15 +104,19 @@ namespace ChimeraTK {
     // create new module to return
     VirtualModule module{_name, _description, getModuleType()};
 
-    // add everything matching the tag to the virtual module and return it
-    findTagAndAppendToModule(module, tag, false, true, true);
+    // add everything not matching the tag to the virtual module and return it
+    TagQuery query(tag);
+    auto matches = [&query](const VariableNetworkNode &node) { return query.matches(node.getTagSet()); };
+    findTagAndAppendToModule(module, matches, false, true, true);
     return module;
   }
 
 /*********************************************************************************************************************/
 
-  void EntityOwner::findTagAndAppendToModule(VirtualModule &module, const std::string &tag, bool eliminateAllHierarchies,
-                                             bool eliminateFirstHierarchy, bool negate) const {
+  void EntityOwner::findTagAndAppendToModule(VirtualModule &module,
+                                             const std::function<bool(const VariableNetworkNode&)> &matches,
+                                             bool eliminateAllHierarchies, bool eliminateFirstHierarchy,
+                                             bool negate) const {
 
     VirtualModule nextmodule{_name, _description, getModuleType()};
     VirtualModule *moduleToAddTo;
@@ -126,16 +131,8 @@ namespace ChimeraTK {
     }
 
     // add nodes to the module if matching the tag
-    std::regex expr(tag);
     for(auto node : getAccessorList()) {
-      bool addNode = false;
-      for(auto &nodeTag : node.getTags()) {
-        if(std::regex_match(nodeTag, expr)) {
-          addNode = true;
-          break;
-        }
-      }
-      if(node.getTags().size() == 0) if(std::regex_match("", expr)) addNode = true;     // check if empty tag matches, if no tag applied to node
+      bool addNode = matches(node);
       if(negate) addNode = !addNode;
       if(addNode) moduleToAddTo->registerAccessor(node);
     }
@@ -143,21 +140,24 @@ namespace ChimeraTK {
     // iterate through submodules
     for(auto submodule : getSubmoduleList()) {
       // check if submodule already exists by this name and its hierarchy should not be eliminated
-      if(!moduleToAddTo->getEliminateHierarchy() && moduleToAddTo->hasSubmodule(submodule->getName())) {
+      VirtualModule *existingSubModule = nullptr;
+      if(!moduleToAddTo->getEliminateHierarchy()) {
+        existingSubModule = moduleToAddTo->findVirtualSubmodule(submodule->getName());
+      }
+      if(existingSubModule != nullptr) {
         // exists: add to the existing module
-        auto *existingSubModule = dynamic_cast<VirtualModule*>(moduleToAddTo->getSubmodule(submodule->getName()));
-        assert(existingSubModule != nullptr);
-        submodule->findTagAndAppendToModule(*existingSubModule, tag, eliminateAllHierarchies, true, negate);
+        submodule->findTagAndAppendToModule(*existingSubModule, matches, eliminateAllHierarchies, true, negate);
       }
       else {
         // does not yet exist: add as new submodule to the current module
-        submodule->findTagAndAppendToModule(*moduleToAddTo, tag, eliminateAllHierarchies, false, negate);
+        submodule->findTagAndAppendToModule(*moduleToAddTo, matches, eliminateAllHierarchies, false, negate);
       }
     }
 
     if(needToAddSubModule) {
       if( nextmodule.getAccessorList().size() > 0 || nextmodule.getSubmoduleList().size() > 0 ) {
-        module.addSubModule(nextmodule);
+        // move instead of copy, since copying would duplicate the entire sub-tree on each level of the hierarchy
+        module.addSubModule(std::move(nextmodule));
       }
     }
 
@@ -8,6 +8,7 @@
 #include "Application.h"
 #include "Module.h"
 #include "VirtualModule.h"
+#include "DeviceWriteBatch.h"
 
 namespace ChimeraTK {
 
@@ -68,11 +69,13 @@ namespace ChimeraTK {
   void Module::readAll() {
     auto accessorList = getAccessorListRecursive();
     // first blockingly read all push-type variables
+    Profiler::stopMeasurement();
     for(auto accessor : accessorList) {
       if(accessor.getDirection() != VariableDirection::consuming) continue;
       if(accessor.getMode() != UpdateMode::push) continue;
       accessor.getAppAccessorNoType().read();
     }
+    Profiler::startMeasurement();
     // next non-blockingly read the latest values of all poll-type variables
     for(auto accessor : accessorList) {
       if(accessor.getDirection() != VariableDirection::consuming) continue;
@@ -115,6 +118,8 @@ namespace ChimeraTK {
       if(accessor.getDirection() != VariableDirection::feeding) continue;
       accessor.getAppAccessorNoType().write();
     }
+    // execute the deferred device writes right away, see DeviceWriteBatch
+    DeviceWriteBatch::flushCurrentThread();
   }
 
 } /* namespace ChimeraTK */
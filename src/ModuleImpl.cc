@@ -24,7 +24,10 @@ namespace ChimeraTK {
 
   const Module& ModuleImpl::virtualise() const {
     if(!virtualisedModule_isValid) {
-      virtualisedModule = findTag(".*");
+      // same as findTag(".*"), but without evaluating the regular expression for each variable
+      VirtualModule module{_name, _description, getModuleType()};
+      findTagAndAppendToModule(module, [](const VariableNetworkNode&) { return true; }, false, true);
+      virtualisedModule = std::move(module);
       virtualisedModule_isValid = true;
     }
     return virtualisedModule;
@@ -0,0 +1,51 @@
+/*
+ * NetworkStatistics.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <algorithm>
+
+#include <boost/align/aligned_allocator.hpp>
+#include <boost/make_shared.hpp>
+
+#include "NetworkStatistics.h"
+#include "QueuePolicyDecoratorRegisterAccessor.h"
+
+namespace ChimeraTK {
+
+  boost::shared_ptr<NetworkStatistics::Counters> NetworkStatistics::addCounters() {
+    // operator new does not guarantee the alignment of the Counters before C++17
+    auto counters = boost::allocate_shared<Counters>(boost::alignment::aligned_allocator<Counters, 64>());
+    std::lock_guard<std::mutex> lock(_mutex);
+    _counters.push_back(counters);
+    return counters;
+  }
+
+/*********************************************************************************************************************/
+
+  void NetworkStatistics::addQueue(boost::shared_ptr<QueueFillLevel> fillLevel) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _queues.push_back(fillLevel);
+  }
+
+/*********************************************************************************************************************/
+
+  NetworkStatistics::Snapshot NetworkStatistics::aggregate() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    Snapshot snapshot;
+    for(auto &counters : _counters) {
+      snapshot.updates += counters->updates.load(std::memory_order_relaxed);
+      snapshot.dataLost += counters->dataLost.load(std::memory_order_relaxed);
+    }
+    for(auto &queue : _queues) snapshot.queueFill = std::max(snapshot.queueFill, queue->fill.load());
+
+    auto now = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed = now-_lastAggregation;
+    if(elapsed.count() > 0.) snapshot.updateRate = (snapshot.updates-_lastUpdates)/elapsed.count();
+    _lastUpdates = snapshot.updates;
+    _lastAggregation = now;
+    return snapshot;
+  }
+
+} /* namespace ChimeraTK */
@@ -0,0 +1,108 @@
+/*
+ * Numa.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <unistd.h>
+#include <sys/syscall.h>
+
+#include "Numa.h"
+
+using namespace ChimeraTK;
+
+namespace {
+
+  /** Memory policy of set_mempolicy() */
+  constexpr int preferredPolicy = 1;                   // MPOL_PREFERRED
+
+  /** Number of nodes covered by the node masks of get_mempolicy(), must not be smaller than the maximum number of
+   *  nodes supported by the kernel */
+  constexpr size_t maxNodes = 1024;
+
+  /** Read a list like "0-3,6" from the given sysfs file. Returns an empty list if the file does not exist. */
+  std::vector<int> readList(const std::string &fileName) {
+    std::vector<int> list;
+    std::ifstream file(fileName);
+    std::string range;
+    while(std::getline(file, range, ',')) {
+      int first, last;
+      char dash;
+      std::stringstream stream(range);
+      if(!(stream >> first)) break;
+      if(!(stream >> dash >> last) || dash != '-') last = first;
+      for(int i = first; i <= last; ++i) list.push_back(i);
+    }
+    return list;
+  }
+
+}
+
+/*********************************************************************************************************************/
+
+int Numa::getNumberOfNodes() {
+  auto nodes = readList("/sys/devices/system/node/online");
+  return nodes.empty() ? 1 : nodes.back()+1;
+}
+
+/*********************************************************************************************************************/
+
+std::vector<int> Numa::getCpusOfNode(int node) {
+  auto cpus = readList("/sys/devices/system/node/node"+std::to_string(node)+"/cpulist");
+  // without NUMA support in the kernel, all CPUs belong to node 0
+  if(cpus.empty() && node == 0 && getNumberOfNodes() == 1) {
+    for(long cpu = 0; cpu < sysconf(_SC_NPROCESSORS_CONF); ++cpu) cpus.push_back(cpu);
+  }
+  return cpus;
+}
+
+/*********************************************************************************************************************/
+
+int Numa::getNodeOfCpu(int cpu) {
+  for(int node = 0; node < getNumberOfNodes(); ++node) {
+    for(auto nodeCpu : getCpusOfNode(node)) {
+      if(nodeCpu == cpu) return node;
+    }
+  }
+  return 0;
+}
+
+/*********************************************************************************************************************/
+
+int Numa::getCurrentNode() {
+  unsigned int cpu, node;
+  if(syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) return 0;
+  return node;
+}
+
+/*********************************************************************************************************************/
+
+int Numa::getNodeOfAddress(const void *address) {
+  // move_pages() without target nodes only queries the node of each page
+  static const uintptr_t pageSize = sysconf(_SC_PAGESIZE);
+  void *page = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(address) & ~(pageSize-1));
+  int status;
+  if(syscall(SYS_move_pages, 0, 1, &page, nullptr, &status, 0) < 0 || status < 0) return -1;
+  return status;
+}
+
+/*********************************************************************************************************************/
+
+Numa::PreferredNodeScope::PreferredNodeScope(int node) {
+  if(node < 0 || node >= int(8*sizeof(unsigned long))) return;
+  savedMask.resize(maxNodes/(8*sizeof(unsigned long)));
+  if(syscall(SYS_get_mempolicy, &savedPolicy, savedMask.data(), maxNodes, nullptr, 0) != 0) return;
+  unsigned long mask = 1UL << node;
+  active = syscall(SYS_set_mempolicy, preferredPolicy, &mask, 8*sizeof(mask)) == 0;
+}
+
+/*********************************************************************************************************************/
+
+Numa::PreferredNodeScope::~PreferredNodeScope() {
+  if(active) syscall(SYS_set_mempolicy, savedPolicy, savedMask.data(), maxNodes);
+}
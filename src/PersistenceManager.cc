@@ -0,0 +1,313 @@
+/*
+ * PersistenceManager.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <iostream>
+#include <cstdio>
+#include <cerrno>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "PersistenceManager.h"
+#include "Application.h"
+#include "ApplicationException.h"
+
+using namespace ChimeraTK;
+
+constexpr const char *PersistenceManager::magic;
+
+namespace {
+
+  /** Bounds-checked reader for the mapped snapshot file */
+  struct SnapshotReader {
+    const char *pos;
+    const char *end;
+
+    template<typename T>
+    bool read(T &value) {
+      if(static_cast<size_t>(end-pos) < sizeof(T)) return false;
+      std::memcpy(&value, pos, sizeof(T));
+      pos += sizeof(T);
+      return true;
+    }
+
+    bool read(std::string &value) {
+      uint32_t length;
+      if(!read(length) || static_cast<size_t>(end-pos) < length) return false;
+      value.assign(pos, length);
+      pos += length;
+      return true;
+    }
+  };
+
+  /** Writer into the mapped snapshot file. The size has been computed before, so no bounds check is needed. */
+  struct SnapshotWriter {
+    char *pos;
+
+    template<typename T>
+    void write(const T &value) {
+      std::memcpy(pos, &value, sizeof(T));
+      pos += sizeof(T);
+    }
+
+    void write(const std::string &value) {
+      write(static_cast<uint32_t>(value.size()));
+      std::memcpy(pos, value.data(), value.size());
+      pos += value.size();
+    }
+  };
+
+  /** Size of an entry in the snapshot file */
+  size_t entrySize(const std::string &typeName, const std::string &name, const std::string &payload) {
+    return sizeof(uint8_t) + 4*sizeof(uint32_t) + typeName.size() + name.size() + payload.size();
+  }
+
+}
+
+/*********************************************************************************************************************/
+
+PersistenceManager::PersistenceManager(const std::string &fileName, std::chrono::milliseconds interval)
+: fileName(fileName), interval(interval)
+{
+  if(interval.count() <= 0) {
+    throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+        "The snapshot interval of the PersistenceManager must be positive.");
+  }
+  load();
+}
+
+/*********************************************************************************************************************/
+
+PersistenceManager::~PersistenceManager() {
+  if(_thread.joinable()) {
+    _thread.interrupt();
+    _thread.join();
+  }
+}
+
+/*********************************************************************************************************************/
+
+void PersistenceManager::activate() {
+  assert(!_thread.joinable());
+  _thread = boost::thread([this] { this->run(); });
+}
+
+/*********************************************************************************************************************/
+
+void PersistenceManager::deactivate() {
+  if(_thread.joinable()) {
+    _thread.interrupt();
+    _thread.join();
+    // write the final state, so a regular restart does not lose the changes since the last snapshot
+    try {
+      writeSnapshot();
+    }
+    catch(ApplicationException &e) {
+      std::cerr << "PersistenceManager: " << e.what() << std::endl;
+    }
+  }
+  assert(!_thread.joinable());
+}
+
+/*********************************************************************************************************************/
+
+void PersistenceManager::run() {
+  Application::registerThread("PersistenceManager");
+  while(true) {
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(interval.count()));
+    try {
+      writeSnapshot();
+    }
+    catch(ApplicationException &e) {
+      // keep the application running, the next attempt might succeed (e.g. if the disk was full)
+      std::cerr << "PersistenceManager: " << e.what() << std::endl;
+    }
+  }
+}
+
+/*********************************************************************************************************************/
+
+void PersistenceManager::load() {
+  int fd = open(fileName.c_str(), O_RDONLY);
+  if(fd < 0) {
+    if(errno != ENOENT) {
+      std::cerr << "PersistenceManager: cannot open snapshot '" << fileName << "', starting without it." << std::endl;
+    }
+    return;
+  }
+  struct stat fileStatus;
+  if(fstat(fd, &fileStatus) != 0 || fileStatus.st_size == 0) {
+    close(fd);
+    return;
+  }
+  size_t size = fileStatus.st_size;
+  void *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if(mapping == MAP_FAILED) {
+    std::cerr << "PersistenceManager: cannot map snapshot '" << fileName << "', starting without it." << std::endl;
+    return;
+  }
+
+  SnapshotReader reader{static_cast<const char*>(mapping), static_cast<const char*>(mapping)+size};
+  bool good = size >= std::strlen(magic) && std::memcmp(reader.pos, magic, std::strlen(magic)) == 0;
+  reader.pos += std::strlen(magic);
+  uint32_t nEntries = 0;
+  good = good && reader.read(nEntries);
+  for(uint32_t i=0; good && i<nEntries; ++i) {
+    Entry entry;
+    uint8_t kind;
+    good = reader.read(kind) && reader.read(entry.typeName) && reader.read(entry.nElements) &&
+           reader.read(entry.name) && reader.read(entry.payload);
+    entry.kind = kind;
+    entry.valid = true;
+    if(good) loadedEntries[std::make_pair(entry.kind, entry.name)] = std::move(entry);
+  }
+  munmap(mapping, size);
+
+  if(!good) {
+    std::cerr << "PersistenceManager: snapshot '" << fileName << "' is malformed, starting without it." << std::endl;
+    loadedEntries.clear();
+  }
+}
+
+/*********************************************************************************************************************/
+
+uint32_t PersistenceManager::addVariable(const std::string &typeName, const std::string &name, size_t nElements) {
+  std::lock_guard<std::mutex> lock(mutex);
+  Entry entry;
+  entry.kind = 'V';
+  entry.typeName = typeName;
+  entry.nElements = nElements;
+  entry.name = name;
+
+  // take the value from the loaded snapshot, so it is kept in the next snapshot even if it is never updated
+  auto loaded = loadedEntries.find(std::make_pair('V', name));
+  if(loaded != loadedEntries.end() && loaded->second.typeName == typeName && loaded->second.nElements == nElements) {
+    entry.payload = loaded->second.payload;
+    entry.valid = true;
+  }
+
+  variables.push_back(std::move(entry));
+  return variables.size()-1;
+}
+
+/*********************************************************************************************************************/
+
+void PersistenceManager::update(uint32_t variableId, const std::string &payload) {
+  std::lock_guard<std::mutex> lock(mutex);
+  auto &entry = variables[variableId];
+  entry.payload.assign(payload);
+  entry.valid = true;
+  ++updateCounter;
+}
+
+/*********************************************************************************************************************/
+
+void PersistenceManager::registerState(const std::string &name, std::function<std::string()> save,
+                                       std::function<void(const std::string&)> restore) {
+  std::lock_guard<std::mutex> lock(mutex);
+  states.push_back({name, save, restore});
+}
+
+/*********************************************************************************************************************/
+
+void PersistenceManager::restoreStates() {
+  for(auto &state : states) {
+    auto loaded = loadedEntries.find(std::make_pair('S', state.name));
+    if(loaded != loadedEntries.end()) state.restore(loaded->second.payload);
+  }
+}
+
+/*********************************************************************************************************************/
+
+void PersistenceManager::writeSnapshot() {
+  std::lock_guard<std::mutex> writeLock(writeMutex);
+
+  // copy the current values, so the mutex is not held while writing
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    // module states may change without notification, so always write if there are any
+    if(snapshotWritten && updateCounter == lastWrittenUpdateCounter && states.empty()) return;
+    lastWrittenUpdateCounter = updateCounter;
+    snapshotCopy.resize(variables.size());
+    for(size_t i=0; i<variables.size(); ++i) {
+      snapshotCopy[i].kind = 'V';
+      snapshotCopy[i].typeName.assign(variables[i].typeName);
+      snapshotCopy[i].nElements = variables[i].nElements;
+      snapshotCopy[i].name.assign(variables[i].name);
+      snapshotCopy[i].payload.assign(variables[i].payload);
+      snapshotCopy[i].valid = variables[i].valid;
+    }
+  }
+  std::vector<std::pair<const std::string*, std::string>> stateValues;
+  for(auto &state : states) stateValues.emplace_back(&state.name, state.save());
+
+  // compute the size of the file
+  uint32_t nEntries = 0;
+  size_t size = std::strlen(magic) + sizeof(uint32_t);
+  for(auto &entry : snapshotCopy) {
+    if(!entry.valid) continue;
+    size += entrySize(entry.typeName, entry.name, entry.payload);
+    ++nEntries;
+  }
+  for(auto &state : stateValues) {
+    size += entrySize("", *state.first, state.second);
+    ++nEntries;
+  }
+
+  // write the temporary file through a memory mapping
+  std::string temporaryName = fileName+".tmp";
+  int fd = open(temporaryName.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if(fd < 0) {
+    throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+        "Cannot open file '"+temporaryName+"' for writing the snapshot.");
+  }
+  if(ftruncate(fd, size) != 0) {
+    close(fd);
+    throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+        "Cannot resize file '"+temporaryName+"' for writing the snapshot.");
+  }
+  void *mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if(mapping == MAP_FAILED) {
+    close(fd);
+    throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+        "Cannot map file '"+temporaryName+"' for writing the snapshot.");
+  }
+
+  SnapshotWriter writer{static_cast<char*>(mapping)};
+  std::memcpy(writer.pos, magic, std::strlen(magic));
+  writer.pos += std::strlen(magic);
+  writer.write(nEntries);
+  for(auto &entry : snapshotCopy) {
+    if(!entry.valid) continue;
+    writer.write(static_cast<uint8_t>('V'));
+    writer.write(entry.typeName);
+    writer.write(entry.nElements);
+    writer.write(entry.name);
+    writer.write(entry.payload);
+  }
+  for(auto &state : stateValues) {
+    writer.write(static_cast<uint8_t>('S'));
+    writer.write(std::string());
+    writer.write(uint32_t(0));
+    writer.write(*state.first);
+    writer.write(state.second);
+  }
+  assert(writer.pos == static_cast<char*>(mapping)+size);
+
+  bool synced = msync(mapping, size, MS_SYNC) == 0;
+  munmap(mapping, size);
+  close(fd);
+
+  // atomically replace the previous snapshot
+  if(!synced || std::rename(temporaryName.c_str(), fileName.c_str()) != 0) {
+    throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+        "Cannot replace the snapshot file '"+fileName+"'.");
+  }
+  snapshotWritten = true;
+}
@@ -0,0 +1,243 @@
+/*
+ * SharedMemoryPublisher.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <algorithm>
+#include <new>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "SharedMemoryPublisher.h"
+
+using namespace ChimeraTK;
+
+namespace {
+
+  /** Round the offset up to the next multiple of 8 bytes, so the slot headers are aligned */
+  uint64_t align(uint64_t offset) {
+    return (offset+7) & ~uint64_t(7);
+  }
+
+}
+
+/*********************************************************************************************************************/
+
+SharedMemoryPublisher::SharedMemoryPublisher(const std::string &segmentName, size_t segmentSize, size_t maxVariables,
+                                             size_t maxStringLength)
+: segmentName(segmentName), segmentSize(segmentSize), maxStringLength(maxStringLength)
+{
+  uint64_t directoryOffset = align(sizeof(SharedMemoryLayout::Header));
+  nextFreeOffset = align(directoryOffset + maxVariables*sizeof(SharedMemoryLayout::DirectoryEntry));
+  if(maxVariables == 0 || nextFreeOffset > segmentSize) {
+    throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+        "The shared memory segment '"+segmentName+"' is too small for the directory.");
+  }
+
+  // replace a segment left over from a previous run, readers still using it keep their mapping
+  shm_unlink(segmentName.c_str());
+  int fd = shm_open(segmentName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+  if(fd < 0) {
+    throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+        "Cannot create the shared memory segment '"+segmentName+"'.");
+  }
+  // the pages are only allocated by the kernel when they are written, so a generous size does not cost memory
+  void *mapping = MAP_FAILED;
+  if(ftruncate(fd, segmentSize) == 0) {
+    mapping = mmap(nullptr, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  close(fd);
+  if(mapping == MAP_FAILED) {
+    shm_unlink(segmentName.c_str());
+    throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+        "Cannot map the shared memory segment '"+segmentName+"'.");
+  }
+  segment = static_cast<char*>(mapping);
+
+  // initialise the header, the magic string is written last so readers only see a complete header
+  auto header = new(segment) SharedMemoryLayout::Header;
+  header->segmentSize = segmentSize;
+  header->directoryOffset = directoryOffset;
+  header->maxEntries = maxVariables;
+  header->nEntries.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  std::memcpy(header->magic, SharedMemoryLayout::magic, sizeof(header->magic));
+}
+
+/*********************************************************************************************************************/
+
+SharedMemoryPublisher::~SharedMemoryPublisher() {
+  munmap(segment, segmentSize);
+  shm_unlink(segmentName.c_str());
+}
+
+/*********************************************************************************************************************/
+
+SharedMemoryPublisher::Slot SharedMemoryPublisher::addVariable(const std::string &typeName, const std::string &name,
+                                                               size_t nElements, size_t capacity) {
+  std::lock_guard<std::mutex> lock(mutex);
+  auto header = reinterpret_cast<SharedMemoryLayout::Header*>(segment);
+  uint32_t index = header->nEntries.load(std::memory_order_relaxed);
+
+  // allocate the name and the slot behind the directory
+  uint64_t nameOffset = nextFreeOffset;
+  uint64_t slotOffset = align(nameOffset + name.size());
+  uint64_t endOffset = align(slotOffset + sizeof(SharedMemoryLayout::SlotHeader) + capacity);
+  if(index >= header->maxEntries || endOffset > segmentSize) {
+    throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+        "The shared memory segment '"+segmentName+"' is too small to publish the variable '"+name+"'.");
+  }
+  nextFreeOffset = endOffset;
+
+  std::memcpy(segment+nameOffset, name.data(), name.size());
+  auto slotHeader = new(segment+slotOffset) SharedMemoryLayout::SlotHeader;
+  slotHeader->sequence.store(0, std::memory_order_relaxed);
+  slotHeader->payloadSize = 0;
+  slotHeader->droppedUpdates = 0;
+
+  auto entry = reinterpret_cast<SharedMemoryLayout::DirectoryEntry*>(segment+header->directoryOffset) + index;
+  std::memset(entry->typeName, 0, sizeof(entry->typeName));
+  std::memcpy(entry->typeName, typeName.data(), std::min(typeName.size(), sizeof(entry->typeName)-1));
+  entry->nElements = nElements;
+  entry->nameLength = name.size();
+  entry->nameOffset = nameOffset;
+  entry->slotOffset = slotOffset;
+  entry->capacity = capacity;
+
+  // publish the complete entry
+  header->nEntries.store(index+1, std::memory_order_release);
+
+  return {slotHeader, segment+slotOffset+sizeof(SharedMemoryLayout::SlotHeader), capacity};
+}
+
+/*********************************************************************************************************************/
+
+void SharedMemoryPublisher::beginWrite(const Slot &slot) {
+  uint64_t sequence = slot.header->sequence.load(std::memory_order_relaxed);
+  slot.header->sequence.store(sequence+1, std::memory_order_relaxed);
+  // the odd sequence number must be visible before any of the data is changed
+  std::atomic_thread_fence(std::memory_order_release);
+}
+
+/*********************************************************************************************************************/
+
+void SharedMemoryPublisher::endWrite(const Slot &slot) {
+  uint64_t sequence = slot.header->sequence.load(std::memory_order_relaxed);
+  slot.header->sequence.store(sequence+1, std::memory_order_release);
+}
+
+/*********************************************************************************************************************/
+/*********************************************************************************************************************/
+
+SharedMemoryReader::SharedMemoryReader(const std::string &segmentName) {
+  int fd = shm_open(segmentName.c_str(), O_RDONLY, 0);
+  if(fd < 0) {
+    throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+        "Cannot open the shared memory segment '"+segmentName+"'.");
+  }
+  struct stat segmentStatus;
+  void *mapping = MAP_FAILED;
+  if(fstat(fd, &segmentStatus) == 0 &&
+     static_cast<size_t>(segmentStatus.st_size) >= sizeof(SharedMemoryLayout::Header)) {
+    segmentSize = segmentStatus.st_size;
+    mapping = mmap(nullptr, segmentSize, PROT_READ, MAP_SHARED, fd, 0);
+  }
+  close(fd);
+  if(mapping == MAP_FAILED) {
+    throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+        "Cannot map the shared memory segment '"+segmentName+"'.");
+  }
+  segment = static_cast<const char*>(mapping);
+
+  auto header = reinterpret_cast<const SharedMemoryLayout::Header*>(segment);
+  bool valid = std::memcmp(header->magic, SharedMemoryLayout::magic, sizeof(header->magic)) == 0;
+  std::atomic_thread_fence(std::memory_order_acquire);
+  valid = valid && header->segmentSize == segmentSize &&
+          header->directoryOffset + header->maxEntries*sizeof(SharedMemoryLayout::DirectoryEntry) <= segmentSize;
+  if(!valid) {
+    munmap(const_cast<char*>(segment), segmentSize);
+    throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+        "The shared memory segment '"+segmentName+"' has not been created by the SharedMemoryPublisher.");
+  }
+}
+
+/*********************************************************************************************************************/
+
+SharedMemoryReader::~SharedMemoryReader() {
+  munmap(const_cast<char*>(segment), segmentSize);
+}
+
+/*********************************************************************************************************************/
+
+void SharedMemoryReader::updateIndex() {
+  auto header = reinterpret_cast<const SharedMemoryLayout::Header*>(segment);
+  uint32_t nEntries = std::min(header->nEntries.load(std::memory_order_acquire), header->maxEntries);
+  auto directory = reinterpret_cast<const SharedMemoryLayout::DirectoryEntry*>(segment+header->directoryOffset);
+  for(; nIndexedEntries < nEntries; ++nIndexedEntries) {
+    auto &entry = directory[nIndexedEntries];
+    // entries pointing outside the segment are ignored
+    if(entry.nameOffset+entry.nameLength > segmentSize ||
+       entry.slotOffset+sizeof(SharedMemoryLayout::SlotHeader)+entry.capacity > segmentSize) continue;
+    index[std::string(segment+entry.nameOffset, entry.nameLength)] = &entry;
+  }
+}
+
+/*********************************************************************************************************************/
+
+const SharedMemoryLayout::DirectoryEntry* SharedMemoryReader::findEntry(const std::string &name) {
+  auto entry = index.find(name);
+  if(entry == index.end()) {
+    updateIndex();
+    entry = index.find(name);
+    if(entry == index.end()) return nullptr;
+  }
+  return entry->second;
+}
+
+/*********************************************************************************************************************/
+
+std::vector<SharedMemoryReader::VariableInfo> SharedMemoryReader::getVariables() {
+  updateIndex();
+  std::vector<VariableInfo> variables;
+  for(auto &entry : index) {
+    variables.push_back({entry.first, std::string(entry.second->typeName, strnlen(entry.second->typeName, 8)),
+                         entry.second->nElements});
+  }
+  return variables;
+}
+
+/*********************************************************************************************************************/
+
+uint64_t SharedMemoryReader::copyPayload(const SharedMemoryLayout::DirectoryEntry &entry, std::string &payload) {
+  auto slotHeader = reinterpret_cast<const SharedMemoryLayout::SlotHeader*>(segment+entry.slotOffset);
+  const char *data = segment+entry.slotOffset+sizeof(SharedMemoryLayout::SlotHeader);
+  while(true) {
+    uint64_t before = slotHeader->sequence.load(std::memory_order_acquire);
+    if(before % 2 == 1) continue;           // the writer is just updating the slot
+    size_t size = std::min(slotHeader->payloadSize, entry.capacity);
+    payload.assign(data, size);
+    // the copy must be complete before the sequence number is checked again
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t after = slotHeader->sequence.load(std::memory_order_relaxed);
+    if(before == after) return before;
+  }
+}
+
+/*********************************************************************************************************************/
+
+uint64_t SharedMemoryReader::getDroppedUpdates(const std::string &name) {
+  auto entry = findEntry(name);
+  if(!entry) return 0;
+  auto slotHeader = reinterpret_cast<const SharedMemoryLayout::SlotHeader*>(segment+entry->slotOffset);
+  while(true) {
+    uint64_t before = slotHeader->sequence.load(std::memory_order_acquire);
+    if(before % 2 == 1) continue;
+    uint64_t droppedUpdates = slotHeader->droppedUpdates;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if(slotHeader->sequence.load(std::memory_order_relaxed) == before) return droppedUpdates;
+  }
+}
@@ -0,0 +1,110 @@
+/*
+ * StatisticsModule.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "StatisticsModule.h"
+#include "Application.h"
+
+using namespace ChimeraTK;
+
+/*********************************************************************************************************************/
+
+StatisticsModule::StatisticsModule(boost::shared_ptr<DevicePVManager> pvManager, std::chrono::milliseconds interval)
+: pvManager(pvManager), interval(interval)
+{}
+
+/*********************************************************************************************************************/
+
+StatisticsModule::~StatisticsModule() {
+  deactivate();
+}
+
+/*********************************************************************************************************************/
+
+void StatisticsModule::activate() {
+  assert(!_thread.joinable());
+  _thread = boost::thread([this] { this->run(); });
+}
+
+/*********************************************************************************************************************/
+
+void StatisticsModule::deactivate() {
+  if(_thread.joinable()) {
+    _thread.interrupt();
+    _thread.join();
+  }
+  assert(!_thread.joinable());
+}
+
+/*********************************************************************************************************************/
+
+void StatisticsModule::addNetwork(const std::string &name, boost::shared_ptr<NetworkStatistics> statistics) {
+  std::lock_guard<std::mutex> lock(mutex);
+  auto dir = SynchronizationDirection::deviceToControlSystem;
+  std::string prefix = "/Statistics"+makeUnique(name)+"/";
+  Entry entry;
+  entry.statistics = statistics;
+  entry.updates = pvManager->createProcessArray<uint64_t>(dir, prefix+"updates", 1, "",
+                                                          "Number of values sent to the network");
+  entry.dataLost = pvManager->createProcessArray<uint64_t>(dir, prefix+"dataLost", 1, "",
+                                                           "Number of values lost because a queue was full");
+  entry.updateRate = pvManager->createProcessArray<double>(dir, prefix+"updateRate", 1, "Hz",
+                                                           "Average number of updates per second");
+  entry.queueFill = pvManager->createProcessArray<uint64_t>(dir, prefix+"queueFill", 1, "",
+                                                            "Largest fill level of the queues of the network");
+  entries.push_back(entry);
+}
+
+/*********************************************************************************************************************/
+
+void StatisticsModule::addCounter(const std::string &name, const std::string &description,
+                                  boost::shared_ptr<std::atomic<uint64_t>> counter) {
+  std::lock_guard<std::mutex> lock(mutex);
+  Counter entry;
+  entry.counter = counter;
+  entry.pv = pvManager->createProcessArray<uint64_t>(SynchronizationDirection::deviceToControlSystem,
+                                                     "/Statistics"+makeUnique(name), 1, "", description);
+  counters.push_back(entry);
+}
+
+/*********************************************************************************************************************/
+
+std::string StatisticsModule::makeUnique(const std::string &name) {
+  std::string uniqueName = name;
+  for(size_t i=2; names.count(uniqueName); ++i) uniqueName = name+"_"+std::to_string(i);
+  names.insert(uniqueName);
+  return uniqueName;
+}
+
+/*********************************************************************************************************************/
+
+void StatisticsModule::publish() {
+  std::lock_guard<std::mutex> lock(mutex);
+  for(auto &entry : entries) {
+    auto snapshot = entry.statistics->aggregate();
+    entry.updates->accessData(0) = snapshot.updates;
+    entry.updates->write();
+    entry.dataLost->accessData(0) = snapshot.dataLost;
+    entry.dataLost->write();
+    entry.updateRate->accessData(0) = snapshot.updateRate;
+    entry.updateRate->write();
+    entry.queueFill->accessData(0) = snapshot.queueFill;
+    entry.queueFill->write();
+  }
+  for(auto &entry : counters) {
+    entry.pv->accessData(0) = *entry.counter;
+    entry.pv->write();
+  }
+}
+
+/*********************************************************************************************************************/
+
+void StatisticsModule::run() {
+  Application::registerThread("StatisticsModule");
+  while(true) {
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(interval.count()));
+    publish();
+  }
+}
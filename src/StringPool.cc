@@ -0,0 +1,30 @@
+/*
+ * StringPool.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "StringPool.h"
+
+namespace ChimeraTK {
+
+  StringPool& StringPool::getInstance() {
+    static StringPool instance;
+    return instance;
+  }
+
+/*********************************************************************************************************************/
+
+  const std::string& StringPool::intern(const std::string &value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return *(strings.insert(value).first);
+  }
+
+/*********************************************************************************************************************/
+
+  size_t StringPool::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return strings.size();
+  }
+
+} /* namespace ChimeraTK */
@@ -0,0 +1,193 @@
+/*
+ * TagQuery.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <regex>
+#include <cctype>
+
+#include "TagQuery.h"
+#include "ApplicationException.h"
+
+namespace ChimeraTK {
+
+  TagTable& TagTable::getInstance() {
+    static TagTable instance;
+    return instance;
+  }
+
+/*********************************************************************************************************************/
+
+  size_t TagTable::intern(const std::string &tag) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = ids.find(tag);
+    if(it != ids.end()) return it->second;
+    size_t id = names.size();
+    names.push_back(tag);
+    ids[tag] = id;
+    return id;
+  }
+
+/*********************************************************************************************************************/
+
+  std::string TagTable::getName(size_t id) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return names.at(id);
+  }
+
+/*********************************************************************************************************************/
+
+  std::vector<std::string> TagTable::getNames() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return names;
+  }
+
+/*********************************************************************************************************************/
+
+  class TagQuery::Parser {
+
+    public:
+
+      Parser(TagQuery &query, const std::string &text)
+      : _query(query), _text(text), _tagNames(TagTable::getInstance().getNames())
+      {}
+
+      void parse() {
+        parseOr();
+        skipWhitespace();
+        if(pos != _text.size()) error("unexpected '"+std::string(1, _text[pos])+"'");
+      }
+
+    protected:
+
+      static bool isOperator(char c) {
+        return c == '&' || c == '|' || c == '!' || c == '(' || c == ')';
+      }
+
+      void skipWhitespace() {
+        while(pos < _text.size() && std::isspace(static_cast<unsigned char>(_text[pos]))) ++pos;
+      }
+
+      bool accept(char c) {
+        skipWhitespace();
+        if(pos < _text.size() && _text[pos] == c) {
+          ++pos;
+          return true;
+        }
+        return false;
+      }
+
+      void emit(Instruction::Code code, size_t pattern=0) {
+        _query.program.push_back({code, pattern});
+      }
+
+      // or-expression: and-expression { "|" and-expression }
+      void parseOr() {
+        parseAnd();
+        while(accept('|')) {
+          parseAnd();
+          emit(Instruction::Code::logicalOr);
+        }
+      }
+
+      // and-expression: factor { "&" factor }
+      void parseAnd() {
+        parseFactor();
+        while(accept('&')) {
+          parseFactor();
+          emit(Instruction::Code::logicalAnd);
+        }
+      }
+
+      // factor: "!" factor | "(" or-expression ")" | pattern
+      void parseFactor() {
+        if(accept('!')) {
+          parseFactor();
+          emit(Instruction::Code::logicalNot);
+          return;
+        }
+        if(accept('(')) {
+          parseOr();
+          if(!accept(')')) error("missing ')'");
+          return;
+        }
+        parsePattern();
+      }
+
+      void parsePattern() {
+        skipWhitespace();
+        size_t begin = pos;
+        while(pos < _text.size() && !isOperator(_text[pos]) && !std::isspace(static_cast<unsigned char>(_text[pos]))) {
+          ++pos;
+        }
+        if(pos == begin) error("pattern expected");
+
+        // evaluate the regular expression against all known tags
+        std::regex expr(_text.substr(begin, pos-begin));
+        Pattern pattern;
+        for(size_t id=0; id<_tagNames.size(); ++id) {
+          if(std::regex_match(_tagNames[id], expr)) pattern.matchingTags.add(id);
+        }
+        pattern.matchesEmpty = std::regex_match("", expr);
+        _query.patterns.push_back(pattern);
+        emit(Instruction::Code::pattern, _query.patterns.size()-1);
+      }
+
+      void error(const std::string &message) {
+        throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+            "Syntax error in tag query '"+_text+"' at position "+std::to_string(pos)+": "+message);
+      }
+
+      TagQuery &_query;
+      const std::string &_text;
+      std::vector<std::string> _tagNames;
+      size_t pos{0};
+
+  };
+
+/*********************************************************************************************************************/
+
+  TagQuery::TagQuery(const std::string &query) {
+    Parser(*this, query).parse();
+
+    // check the required stack depth, so matches() does not need to
+    size_t depth = 0;
+    for(auto &instruction : program) {
+      if(instruction.code == Instruction::Code::pattern) ++depth;
+      else if(instruction.code != Instruction::Code::logicalNot) --depth;
+      if(depth > maxStackDepth) {
+        throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+            "Tag query '"+query+"' is nested too deeply.");
+      }
+    }
+  }
+
+/*********************************************************************************************************************/
+
+  bool TagQuery::matches(const TagSet &tags) const {
+    bool noTags = tags.empty();
+    uint64_t stack = 0;     // bit 0 is the top of the stack
+    for(auto &instruction : program) {
+      switch(instruction.code) {
+        case Instruction::Code::pattern: {
+          auto &pattern = patterns[instruction.pattern];
+          bool result = noTags ? pattern.matchesEmpty : tags.intersects(pattern.matchingTags);
+          stack = (stack << 1) | uint64_t(result);
+          break;
+        }
+        case Instruction::Code::logicalAnd:
+          stack = (stack >> 1) & (stack | ~uint64_t(1));
+          break;
+        case Instruction::Code::logicalOr:
+          stack = (stack >> 1) | (stack & uint64_t(1));
+          break;
+        case Instruction::Code::logicalNot:
+          stack ^= 1;
+          break;
+      }
+    }
+    return (stack & 1) != 0;
+  }
+
+} /* namespace ChimeraTK */
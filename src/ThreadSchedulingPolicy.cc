@@ -0,0 +1,189 @@
+/*
+ * ThreadSchedulingPolicy.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <iostream>
+#include <sstream>
+#include <cstring>
+#include <cerrno>
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+
+#include "ThreadSchedulingPolicy.h"
+#include "ApplicationException.h"
+#include "Numa.h"
+
+using namespace ChimeraTK;
+
+namespace {
+
+  /** Parse an integer which must make up the complete string and be within the given range */
+  int parseInteger(const std::string &value, int min, int max, const std::string &tag) {
+    try {
+      size_t length;
+      int parsedValue = std::stoi(value, &length);
+      if(length == value.size() && parsedValue >= min && parsedValue <= max) return parsedValue;
+    }
+    catch(std::logic_error &e) {}
+    throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+        "Cannot parse the value of the tag '"+tag+"'.");
+  }
+
+  /** Parse a list of CPUs like "0-3,6" */
+  std::vector<int> parseCpuList(const std::string &value, const std::string &tag) {
+    std::vector<int> cpus;
+    std::stringstream stream(value);
+    std::string range;
+    while(std::getline(stream, range, ',')) {
+      auto dash = range.find('-');
+      int first = parseInteger(range.substr(0, dash), 0, CPU_SETSIZE-1, tag);
+      int last = dash == std::string::npos ? first : parseInteger(range.substr(dash+1), first, CPU_SETSIZE-1, tag);
+      for(int cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+    }
+    if(cpus.empty()) {
+      throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+          "The tag '"+tag+"' does not contain any CPU.");
+    }
+    return cpus;
+  }
+
+  /** Format a CPU set as a list of ranges like "0-3,6" */
+  std::string formatCpuSet(const cpu_set_t &set) {
+    std::string list;
+    for(int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if(!CPU_ISSET(cpu, &set)) continue;
+      int last = cpu;
+      while(last+1 < CPU_SETSIZE && CPU_ISSET(last+1, &set)) ++last;
+      if(!list.empty()) list += ",";
+      list += std::to_string(cpu);
+      if(last > cpu) list += "-"+std::to_string(last);
+      cpu = last;
+    }
+    return list;
+  }
+
+}
+
+/*********************************************************************************************************************/
+
+bool ThreadSchedulingPolicy::isMoreUrgentThan(const ThreadSchedulingPolicy &other) const {
+  if(!isEnabled()) return false;
+  if(!other.isEnabled()) return true;
+  int realtimePriority = schedulingClass != SchedulingClass::other ? priority : 0;
+  int otherRealtimePriority = other.schedulingClass != SchedulingClass::other ? other.priority : 0;
+  if(realtimePriority != otherRealtimePriority) return realtimePriority > otherRealtimePriority;
+  return (hasNice ? nice : 0) < (other.hasNice ? other.nice : 0);
+}
+
+/*********************************************************************************************************************/
+
+ThreadSchedulingPolicy ThreadSchedulingPolicy::fromTags(const std::unordered_set<std::string> &tags) {
+  ThreadSchedulingPolicy policy;
+  auto hasPrefix = [](const std::string &tag, const std::string &prefix) {
+    return tag.compare(0, prefix.size(), prefix) == 0;
+  };
+  auto setClass = [&policy](SchedulingClass schedulingClass, int priority, const std::string &tag) {
+    if(policy.schedulingClass != SchedulingClass::other &&
+       (policy.schedulingClass != schedulingClass || policy.priority != priority)) {
+      throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+          "The tag '"+tag+"' conflicts with another scheduling tag of the same module.");
+    }
+    policy.schedulingClass = schedulingClass;
+    policy.priority = priority;
+  };
+  for(auto &tag : tags) {
+    if(hasPrefix(tag, "schedCpus")) {
+      policy.cpus = parseCpuList(tag.substr(9), tag);
+    }
+    else if(hasPrefix(tag, "schedFifo")) {
+      setClass(SchedulingClass::fifo, parseInteger(tag.substr(9), 1, 99, tag), tag);
+    }
+    else if(hasPrefix(tag, "schedRR")) {
+      setClass(SchedulingClass::roundRobin, parseInteger(tag.substr(7), 1, 99, tag), tag);
+    }
+    else if(hasPrefix(tag, "schedNumaNode")) {
+      policy.numaNode = parseInteger(tag.substr(13), 0, CPU_SETSIZE-1, tag);
+    }
+    else if(hasPrefix(tag, "schedNice")) {
+      policy.nice = parseInteger(tag.substr(9), -20, 19, tag);
+      policy.hasNice = true;
+    }
+  }
+  return policy;
+}
+
+/*********************************************************************************************************************/
+
+void ThreadSchedulingPolicy::apply(const std::string &threadName) const {
+  if(!isEnabled()) return;
+  std::string errors;
+
+  auto effectiveCpus = cpus;
+  if(effectiveCpus.empty() && numaNode >= 0) {
+    effectiveCpus = Numa::getCpusOfNode(numaNode);
+    if(effectiveCpus.empty()) errors += " NUMA node "+std::to_string(numaNode)+" does not exist.";
+  }
+  if(!effectiveCpus.empty()) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for(auto cpu : effectiveCpus) CPU_SET(cpu, &set);
+    int result = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if(result != 0) errors += std::string(" CPU affinity: ")+std::strerror(result)+".";
+  }
+
+  if(schedulingClass != SchedulingClass::other) {
+    sched_param parameter;
+    parameter.sched_priority = priority;
+    int result = pthread_setschedparam(pthread_self(),
+        schedulingClass == SchedulingClass::fifo ? SCHED_FIFO : SCHED_RR, &parameter);
+    if(result != 0) errors += std::string(" Real-time scheduling: ")+std::strerror(result)+".";
+  }
+
+  // on Linux, the nice value is a property of each thread, identified by its thread id
+  if(hasNice && setpriority(PRIO_PROCESS, syscall(SYS_gettid), nice) != 0) {
+    errors += std::string(" Nice value: ")+std::strerror(errno)+".";
+  }
+
+  if(!errors.empty()) {
+    std::cerr << "*** Warning: Cannot apply the scheduling policy of thread '" << threadName << "'." << errors
+              << std::endl;
+  }
+  std::cout << "Thread '" << threadName << "' runs on " << describeCurrentThread() << std::endl;
+}
+
+/*********************************************************************************************************************/
+
+std::string ThreadSchedulingPolicy::describeCurrentThread() {
+  std::string description;
+
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if(pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0) description += "CPUs "+formatCpuSet(set);
+  if(Numa::getNumberOfNodes() > 1) description += " (NUMA node "+std::to_string(Numa::getCurrentNode())+")";
+
+  int schedulingPolicy;
+  sched_param parameter;
+  if(pthread_getschedparam(pthread_self(), &schedulingPolicy, &parameter) == 0) {
+    if(schedulingPolicy == SCHED_FIFO) {
+      description += ", SCHED_FIFO priority "+std::to_string(parameter.sched_priority);
+    }
+    else if(schedulingPolicy == SCHED_RR) {
+      description += ", SCHED_RR priority "+std::to_string(parameter.sched_priority);
+    }
+    else {
+      description += ", SCHED_OTHER";
+    }
+  }
+
+  errno = 0;
+  int nice = getpriority(PRIO_PROCESS, syscall(SYS_gettid));
+  if(errno == 0) description += ", nice "+std::to_string(nice);
+
+  return description;
+}
@@ -6,6 +6,7 @@
  */
 
 #include <sstream>
+#include <algorithm>
 
 #include "VariableNetwork.h"
 #include "Application.h"
@@ -15,6 +16,133 @@ namespace ChimeraTK {
 
   /*********************************************************************************************************************/
 
+  PublicationPolicy VariableNetwork::getPublicationPolicy() const {
+    if(hasPublicationPolicy) return publicationPolicy;
+
+    // obtain the policy from the tags of all nodes
+    PublicationPolicy policy;
+    auto parseTag = [](const std::string &tag, const std::string &prefix, double &value) {
+      if(tag.compare(0, prefix.size(), prefix) != 0) return;
+      try {
+        size_t length;
+        double parsedValue = std::stod(tag.substr(prefix.size()), &length);
+        if(length == tag.size()-prefix.size()) {
+          value = parsedValue;
+          return;
+        }
+      }
+      catch(std::logic_error &e) {}
+      throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+          "Cannot parse the value of the tag '"+tag+"'.");
+    };
+    for(auto &node : nodeList) {
+      for(auto &tag : node.getTags()) {
+        parseTag(tag, "publishMaxRate", policy.maxRate);
+        parseTag(tag, "publishDeadband", policy.deadband);
+      }
+    }
+    return policy;
+  }
+
+  /*********************************************************************************************************************/
+
+  std::string VariableNetwork::getName() const {
+    // make sure the components are separated by exactly one slash
+    auto join = [](const std::string &prefix, const std::string &name) {
+      if(!name.empty() && name[0] == '/') return prefix+name;
+      return prefix+"/"+name;
+    };
+    const auto &feeder = getFeedingNode();
+    if(feeder.getType() == NodeType::Application) return feeder.getQualifiedName();
+    if(feeder.getType() == NodeType::ControlSystem) return join("/ControlSystem", feeder.getPublicName());
+    if(feeder.getType() == NodeType::Device) {
+      return join(join("/Device", feeder.getDeviceAlias()), feeder.getRegisterName());
+    }
+    return "";
+  }
+
+  /*********************************************************************************************************************/
+
+  QueuePolicy VariableNetwork::getQueuePolicy() const {
+    if(hasQueuePolicy) return queuePolicy;
+
+    // obtain the policy from the tags of all nodes
+    QueuePolicy policy;
+    bool hasOverflow = false;
+    auto setOverflow = [&policy, &hasOverflow](const std::string &tag, QueuePolicy::Overflow overflow) {
+      if(hasOverflow && policy.overflow != overflow) {
+        throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+            "Conflicting queue overflow policies given by the tag '"+tag+"'.");
+      }
+      policy.overflow = overflow;
+      hasOverflow = true;
+    };
+    for(auto &node : nodeList) {
+      for(auto &tag : node.getTags()) {
+        if(tag == "queueDropOldest") {
+          setOverflow(tag, QueuePolicy::Overflow::dropOldest);
+        }
+        else if(tag == "queueDropNewest") {
+          setOverflow(tag, QueuePolicy::Overflow::dropNewest);
+        }
+        else if(tag == "queueBlock") {
+          setOverflow(tag, QueuePolicy::Overflow::block);
+        }
+        else if(tag.compare(0, 10, "queueDepth") == 0) {
+          std::string value = tag.substr(10);
+          size_t length = 0;
+          long depth = 0;
+          try {
+            depth = std::stol(value, &length);
+          }
+          catch(std::logic_error &e) {}
+          if(depth <= 0 || length != value.size()) {
+            throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+                "Cannot parse the value of the tag '"+tag+"'.");
+          }
+          // the deepest queue requested by any node wins
+          policy.depth = std::max(policy.depth, size_t(depth));
+        }
+      }
+    }
+    return policy;
+  }
+
+  /*********************************************************************************************************************/
+
+  ThreadSchedulingPolicy VariableNetwork::getSchedulingPolicy() const {
+    ThreadSchedulingPolicy policy;
+    for(auto &node : nodeList) {
+      auto nodePolicy = ThreadSchedulingPolicy::fromTags(node.getTags());
+      if(nodePolicy.isMoreUrgentThan(policy)) policy = nodePolicy;
+    }
+    return policy;
+  }
+
+  /*********************************************************************************************************************/
+
+  WaitPolicy VariableNetwork::getWaitPolicy() const {
+    WaitPolicy policy;
+    for(auto &node : nodeList) {
+      auto nodePolicy = WaitPolicy::fromTags(node.getTags());
+      if(nodePolicy.spinsLongerThan(policy)) policy = nodePolicy;
+    }
+    return policy;
+  }
+
+  /*********************************************************************************************************************/
+
+  int VariableNetwork::getConsumerNumaNode() const {
+    for(auto &node : nodeList) {
+      if(node.getDirection() != VariableDirection::consuming) continue;
+      int numaNode = ThreadSchedulingPolicy::fromTags(node.getTags()).numaNode;
+      if(numaNode >= 0) return numaNode;
+    }
+    return -1;
+  }
+
+  /*********************************************************************************************************************/
+
   bool VariableNetwork::hasFeedingNode() const {
     auto n = std::count_if( nodeList.begin(), nodeList.end(),
         [](const VariableNetworkNode n) {
@@ -35,7 +35,7 @@ namespace ChimeraTK {
                                   VariableDirection direction, std::string unit, size_t nElements, UpdateMode mode,
                                   const std::string &description, const std::type_info* valueType,
                                   const std::unordered_set<std::string> &tags)
-  : pdata(boost::make_shared<VariableNetworkNode_data>())
+  : pdata(makeNodeData())
   {
     pdata->owningModule = owner;
     pdata->type = NodeType::Application;
@@ -48,14 +48,14 @@ namespace ChimeraTK {
     pdata->unit = unit;
     pdata->nElements = nElements;
     pdata->description = description;
-    pdata->tags = tags;
+    for(auto &tag : tags) pdata->tagSet.add(TagTable::getInstance().intern(tag));
   }
 
   /*********************************************************************************************************************/
 
   VariableNetworkNode::VariableNetworkNode(const std::string &devAlias, const std::string &regName, UpdateMode mode,
       VariableDirection dir, const std::type_info &valTyp, size_t nElements)
-  : pdata(boost::make_shared<VariableNetworkNode_data>())
+  : pdata(makeNodeData())
   {
     pdata->type = NodeType::Device;
     pdata->mode = mode;
@@ -70,7 +70,7 @@ namespace ChimeraTK {
 
   VariableNetworkNode::VariableNetworkNode(std::string pubName, VariableDirection dir, const std::type_info &valTyp,
       size_t nElements)
-  : pdata(boost::make_shared<VariableNetworkNode_data>())
+  : pdata(makeNodeData())
   {
     pdata->type = NodeType::ControlSystem;
     pdata->mode = UpdateMode::push;
@@ -83,7 +83,7 @@ namespace ChimeraTK {
   /*********************************************************************************************************************/
 
   VariableNetworkNode::VariableNetworkNode(VariableNetworkNode& nodeToTrigger, int)
-  : pdata(boost::make_shared<VariableNetworkNode_data>())
+  : pdata(makeNodeData())
   {
     pdata->type = NodeType::TriggerReceiver;
     pdata->direction = VariableDirection::consuming;
@@ -100,7 +100,7 @@ namespace ChimeraTK {
   /*********************************************************************************************************************/
 
   VariableNetworkNode::VariableNetworkNode()
-  : pdata(boost::make_shared<VariableNetworkNode_data>())
+  : pdata(makeNodeData())
   {}
 
   /*********************************************************************************************************************/
@@ -214,7 +214,7 @@ namespace ChimeraTK {
     }
 
     // create copy of the node
-    pdata->nodeWithTrigger[trigger].pdata = boost::make_shared<VariableNetworkNode_data>(*pdata);
+    pdata->nodeWithTrigger[trigger].pdata = makeNodeData(*pdata);
 
     // add ourselves as a trigger receiver to the other network
     if(!trigger.hasOwner()) {
@@ -294,7 +294,7 @@ namespace ChimeraTK {
       return pdata->publicName;
     }
     else if(pdata->type == NodeType::Device) {
-      return pdata->deviceAlias+":"+pdata->registerName;
+      return pdata->deviceAlias.str()+":"+pdata->registerName.str();
     }
     else {
       return pdata->name;
@@ -391,19 +391,29 @@ namespace ChimeraTK {
   void VariableNetworkNode::setMetaData(const std::string &name, const std::string &unit,
                                         const std::string &description, const std::unordered_set<std::string> &tags) {
     setMetaData(name, unit, description);
-    pdata->tags = tags;
+    pdata->tagSet.clear();
+    for(auto &tag : tags) pdata->tagSet.add(TagTable::getInstance().intern(tag));
   }
 
   /*********************************************************************************************************************/
 
   void VariableNetworkNode::addTag(const std::string &tag) {
-    pdata->tags.insert(tag);
+    pdata->tagSet.add(TagTable::getInstance().intern(tag));
   }
 
   /*********************************************************************************************************************/
 
-  const std::unordered_set<std::string>& VariableNetworkNode::getTags() const {
-    return pdata->tags;
+  std::unordered_set<std::string> VariableNetworkNode::getTags() const {
+    std::unordered_set<std::string> tags;
+    auto &table = TagTable::getInstance();
+    for(auto id : pdata->tagSet.getIds()) tags.insert(table.getName(id));
+    return tags;
+  }
+
+  /*********************************************************************************************************************/
+
+  const TagSet& VariableNetworkNode::getTagSet() const {
+    return pdata->tagSet;
   }
 
   /*********************************************************************************************************************/
@@ -0,0 +1,107 @@
+/*
+ * VariableRecorder.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "VariableRecorder.h"
+#include "ApplicationException.h"
+
+using namespace ChimeraTK;
+
+constexpr const char *VariableRecorder::magic;
+
+/*********************************************************************************************************************/
+
+VariableRecorder::VariableRecorder(const std::string &fileName, size_t versionMapSize)
+: file(fileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc),
+  versionMapSize(versionMapSize),
+  lastFlush(std::chrono::steady_clock::now())
+{
+  if(!file) {
+    throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+        "Cannot open file '"+fileName+"' for recording variables.");
+  }
+  if(versionMapSize == 0) {
+    throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+        "The versionMapSize of the VariableRecorder must not be zero.");
+  }
+  file.write(magic, std::strlen(magic));
+}
+
+/*********************************************************************************************************************/
+
+VariableRecorder::~VariableRecorder() {
+  std::lock_guard<std::mutex> lock(mutex);
+  file.flush();
+}
+
+/*********************************************************************************************************************/
+
+uint32_t VariableRecorder::addVariable(VariableKind kind, const std::string &typeName, const std::string &name,
+                                       const std::string &deviceAlias, size_t nElements) {
+  std::lock_guard<std::mutex> lock(mutex);
+  uint32_t id = nextVariableId++;
+  file.put('V');
+  writeRaw(id);
+  writeRaw(static_cast<uint8_t>(kind));
+  writeString(typeName);
+  writeRaw(static_cast<uint32_t>(nElements));
+  writeString(name);
+  writeString(deviceAlias);
+  return id;
+}
+
+/*********************************************************************************************************************/
+
+void VariableRecorder::commit(uint32_t variableId, const ChimeraTK::VersionNumber &version,
+                              const std::string &payload) {
+  // take the time stamp before acquiring the lock, so it is not affected by contention
+  int64_t timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::system_clock::now().time_since_epoch()).count();
+
+  std::lock_guard<std::mutex> lock(mutex);
+  file.put('D');
+  writeRaw(variableId);
+  writeRaw(getVersionOrdinal(version));
+  writeRaw(timestamp);
+  writeRaw(static_cast<uint32_t>(payload.size()));
+  file.write(payload.data(), payload.size());
+
+  auto now = std::chrono::steady_clock::now();
+  if(now - lastFlush > std::chrono::seconds(1)) {
+    file.flush();
+    lastFlush = now;
+  }
+}
+
+/*********************************************************************************************************************/
+
+uint64_t VariableRecorder::getVersionOrdinal(const ChimeraTK::VersionNumber &version) {
+  auto it = versionMap.find(version);
+  if(it != versionMap.end()) return it->second;
+
+  // VersionNumbers are strictly increasing, so the smallest entry is the oldest one. If the evicted VersionNumber is
+  // seen again later, it will get a new ordinal (see class description).
+  if(versionMap.size() >= versionMapSize) versionMap.erase(versionMap.begin());
+  versionMap[version] = nextVersionOrdinal;
+  return nextVersionOrdinal++;
+}
+
+/*********************************************************************************************************************/
+
+std::string VariableRecorder::userTypeName(const std::type_info &type) {
+  if(type == typeid(int8_t)) return "int8";
+  if(type == typeid(uint8_t)) return "uint8";
+  if(type == typeid(int16_t)) return "int16";
+  if(type == typeid(uint16_t)) return "uint16";
+  if(type == typeid(int32_t)) return "int32";
+  if(type == typeid(uint32_t)) return "uint32";
+  if(type == typeid(int64_t)) return "int64";
+  if(type == typeid(uint64_t)) return "uint64";
+  if(type == typeid(float)) return "float";
+  if(type == typeid(double)) return "double";
+  if(type == typeid(std::string)) return "string";
+  throw ApplicationExceptionWithID<ApplicationExceptionID::notYetImplemented>(                // LCOV_EXCL_LINE (assert-like)
+      std::string("Unsupported user type for recording: ")+type.name());                    // LCOV_EXCL_LINE (assert-like)
+}
@@ -0,0 +1,328 @@
+/*
+ * VariableReplayer.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include <fstream>
+#include <iterator>
+
+#include <boost/fusion/container/map.hpp>
+#include <boost/make_shared.hpp>
+
+#include <mtca4u/Device.h>
+
+#include "VariableReplayer.h"
+#include "TestFacility.h"
+
+using namespace ChimeraTK;
+
+/*********************************************************************************************************************/
+
+/** Type-independent interface to the variables in the application corresponding to the recorded variables */
+class VariableReplayer::Variable {
+  public:
+    Variable(VariableRecorder::VariableKind kind, const std::string &name, size_t nElements)
+    : _kind(kind), _name(name), _nElements(nElements) {}
+
+    virtual ~Variable() {}
+
+    /** Write the given recorded value to the application (only for inputs) */
+    virtual void feed(const char *payload, size_t size) = 0;
+
+    /** Read the latest value of an output and serialise it into the payload. Returns false if there was no new
+     *  value. */
+    virtual bool readOutput(std::string &payload) = 0;
+
+    /** Convert the payload into a human readable string */
+    virtual std::string toString(const char *payload, size_t size) const = 0;
+
+    VariableRecorder::VariableKind _kind;
+    std::string _name;
+    size_t _nElements;
+};
+
+/*********************************************************************************************************************/
+
+namespace {
+
+  template<typename UserType>
+  class TypedVariable : public VariableReplayer::Variable {
+    public:
+      TypedVariable(TestFacility &testFacility, VariableRecorder::VariableKind kind, const std::string &name,
+                    const std::string &deviceAlias, size_t nElements)
+      : VariableReplayer::Variable(kind, name, nElements), buffer(nElements)
+      {
+        if(kind == VariableRecorder::VariableKind::deviceInput ||
+           kind == VariableRecorder::VariableKind::devicePushInput) {
+          device.open(deviceAlias);
+          accessor.replace(device.getOneDRegisterAccessor<UserType>(name, nElements));
+        }
+        else {
+          accessor.replace(testFacility.getArray<UserType>(name));
+        }
+        if(accessor.getNElements() != nElements) {
+          throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+              "Variable '"+name+"' has a different number of elements than in the recording.");
+        }
+      }
+
+      void feed(const char *payload, size_t size) override {
+        if(!VariableRecorder::deserialiseBuffer(payload, size, buffer)) {
+          throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+              "Malformed data for variable '"+_name+"' in the recording.");
+        }
+        for(size_t i=0; i<_nElements; ++i) accessor[i] = buffer[i];
+        accessor.write();
+      }
+
+      bool readOutput(std::string &payload) override {
+        if(!accessor.readLatest()) return false;
+        for(size_t i=0; i<_nElements; ++i) buffer[i] = accessor[i];
+        VariableRecorder::serialiseBuffer(payload, buffer);
+        return true;
+      }
+
+      std::string toString(const char *payload, size_t size) const override {
+        return VariableRecorder::payloadToString<UserType>(payload, size, _nElements);
+      }
+
+    protected:
+      mtca4u::Device device;
+      mtca4u::OneDRegisterAccessor<UserType> accessor;
+      std::vector<UserType> buffer;
+  };
+
+  /*******************************************************************************************************************/
+
+  /** Functor class to create the TypedVariable for the user type given by name, suitable for
+   *  boost::fusion::for_each(). */
+  struct CreateTypedVariable {
+    CreateTypedVariable(TestFacility &testFacility, const std::string &typeName, VariableRecorder::VariableKind kind,
+                        const std::string &name, const std::string &deviceAlias, size_t nElements)
+    : _testFacility(testFacility), _typeName(typeName), _kind(kind), _name(name), _deviceAlias(deviceAlias),
+      _nElements(nElements) {}
+
+    template<typename PAIR>
+    void operator()(PAIR&) const {
+      typedef typename PAIR::first_type UserType;
+      if(VariableRecorder::userTypeName(typeid(UserType)) != _typeName) return;
+      variable = boost::make_shared<TypedVariable<UserType>>(_testFacility, _kind, _name, _deviceAlias, _nElements);
+    }
+
+    TestFacility &_testFacility;
+    const std::string &_typeName;
+    VariableRecorder::VariableKind _kind;
+    const std::string &_name;
+    const std::string &_deviceAlias;
+    size_t _nElements;
+    mutable boost::shared_ptr<VariableReplayer::Variable> variable;
+  };
+
+  /*******************************************************************************************************************/
+
+  /** Helper to read from the file content with bounds checking */
+  struct Cursor {
+    Cursor(const std::string &content, const std::string &fileName)
+    : pos(content.data()), end(content.data()+content.size()), _fileName(fileName) {}
+
+    void require(size_t size) {
+      if(static_cast<size_t>(end-pos) < size) {
+        throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+            "Recording '"+_fileName+"' is truncated or corrupt.");
+      }
+    }
+
+    template<typename T>
+    T read() {
+      T value;
+      require(sizeof(T));
+      std::memcpy(&value, pos, sizeof(T));
+      pos += sizeof(T);
+      return value;
+    }
+
+    std::string readString() {
+      auto length = read<uint32_t>();
+      require(length);
+      std::string value(pos, length);
+      pos += length;
+      return value;
+    }
+
+    const char *pos;
+    const char *end;
+    const std::string &_fileName;
+  };
+
+}
+
+/*********************************************************************************************************************/
+
+VariableReplayer::VariableReplayer(TestFacility &testFacility, const std::string &fileName)
+: _testFacility(testFacility)
+{
+  parse(fileName);
+}
+
+/*********************************************************************************************************************/
+
+VariableReplayer::~VariableReplayer() {}
+
+/*********************************************************************************************************************/
+
+void VariableReplayer::parse(const std::string &fileName) {
+  std::ifstream file(fileName, std::ios_base::in | std::ios_base::binary);
+  if(!file) {
+    throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+        "Cannot open recording '"+fileName+"'.");
+  }
+  fileContent.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+  Cursor cursor(fileContent, fileName);
+  size_t magicLength = std::strlen(VariableRecorder::magic);
+  cursor.require(magicLength);
+  if(std::string(cursor.pos, magicLength) != VariableRecorder::magic) {
+    throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+        "File '"+fileName+"' is not a variable recording.");
+  }
+  cursor.pos += magicLength;
+
+  while(cursor.pos != cursor.end) {
+    auto tag = cursor.read<char>();
+    if(tag == 'V') {
+      auto id = cursor.read<uint32_t>();
+      auto kind = static_cast<VariableRecorder::VariableKind>(cursor.read<uint8_t>());
+      auto typeName = cursor.readString();
+      auto nElements = cursor.read<uint32_t>();
+      auto name = cursor.readString();
+      auto deviceAlias = cursor.readString();
+      auto callable = CreateTypedVariable(_testFacility, typeName, kind, name, deviceAlias, nElements);
+      boost::fusion::for_each(mtca4u::userTypeMap(), callable);
+      if(!callable.variable) {
+        throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+            "Recording '"+fileName+"' contains unknown user type '"+typeName+"'.");
+      }
+      variables[id] = callable.variable;
+    }
+    else if(tag == 'D') {
+      Record record;
+      auto id = cursor.read<uint32_t>();
+      if(variables.count(id) == 0) {
+        throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+            "Recording '"+fileName+"' contains data for an undeclared variable.");
+      }
+      record.variable = variables[id].get();
+      record.versionOrdinal = cursor.read<uint64_t>();
+      record.timestamp = cursor.read<int64_t>();
+      record.payloadSize = cursor.read<uint32_t>();
+      cursor.require(record.payloadSize);
+      record.payload = cursor.pos;
+      cursor.pos += record.payloadSize;
+      records.push_back(record);
+    }
+    else {
+      throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+          "Recording '"+fileName+"' is truncated or corrupt.");
+    }
+  }
+}
+
+/*********************************************************************************************************************/
+
+bool VariableReplayer::isTrigger(const Variable &variable) {
+  return variable._kind == VariableRecorder::VariableKind::controlSystemInput ||
+         variable._kind == VariableRecorder::VariableKind::devicePushInput;
+}
+
+/*********************************************************************************************************************/
+
+size_t VariableReplayer::replay() {
+  auto &app = Application::getInstance();
+  differences.clear();
+
+  // determine where the steps start: at each new VersionNumber of an input triggering the application, i.e. a control
+  // system input or a push-type device input. Polled device inputs are read in reaction to such a trigger and get a
+  // new VersionNumber then, so they belong to the step of the preceding trigger.
+  std::vector<size_t> stepStarts;
+  bool haveInput = false;
+  uint64_t lastOrdinal = 0;
+  for(size_t i=0; i<records.size(); ++i) {
+    if(!isTrigger(*records[i].variable)) continue;
+    if(!haveInput || records[i].versionOrdinal != lastOrdinal) stepStarts.push_back(i);
+    haveInput = true;
+    lastOrdinal = records[i].versionOrdinal;
+  }
+
+  // everything recorded before the first trigger belongs to the first step (e.g. the initial values of the outputs).
+  // A recording without any trigger is replayed as a single step.
+  if(stepStarts.empty()) stepStarts.push_back(0);
+  stepStarts.front() = 0;
+  stepStarts.push_back(records.size());
+
+  // discard any values the outputs might have received before the replay
+  std::string actual;
+  for(auto &pair : variables) {
+    if(pair.second->_kind == VariableRecorder::VariableKind::controlSystemOutput) pair.second->readOutput(actual);
+  }
+
+  std::map<Variable*, const Record*> expected;
+  for(size_t step=0; step<stepStarts.size()-1; ++step) {
+    size_t begin = stepStarts[step];
+    size_t end = stepStarts[step+1];
+
+    // write the polled device inputs first, since they are read by the application in reaction to the trigger
+    for(size_t i=begin; i<end; ++i) {
+      if(records[i].variable->_kind != VariableRecorder::VariableKind::deviceInput) continue;
+      records[i].variable->feed(records[i].payload, records[i].payloadSize);
+    }
+
+    // write the triggering inputs and let the application process them
+    for(size_t i=begin; i<end; ++i) {
+      if(!isTrigger(*records[i].variable)) continue;
+      records[i].variable->feed(records[i].payload, records[i].payloadSize);
+    }
+    if(app.testableMode_counter > 0) _testFacility.stepApplication();
+
+    // compare the outputs with the last recorded value in this step
+    expected.clear();
+    for(size_t i=begin; i<end; ++i) {
+      if(records[i].variable->_kind != VariableRecorder::VariableKind::controlSystemOutput) continue;
+      expected[records[i].variable] = &records[i];
+    }
+    for(auto &pair : variables) {
+      auto variable = pair.second.get();
+      if(variable->_kind != VariableRecorder::VariableKind::controlSystemOutput) continue;
+      bool updated = variable->readOutput(actual);
+      auto it = expected.find(variable);
+      if(it == expected.end()) {
+        if(updated) {
+          differences.push_back({step+1, variable->_name, "(no update)",
+                                 variable->toString(actual.data(), actual.size())});
+        }
+        continue;
+      }
+      auto &record = *(it->second);
+      if(!updated) {
+        differences.push_back({step+1, variable->_name, variable->toString(record.payload, record.payloadSize),
+                               "(no update)"});
+      }
+      else if(actual.size() != record.payloadSize || std::memcmp(actual.data(), record.payload, actual.size()) != 0) {
+        differences.push_back({step+1, variable->_name, variable->toString(record.payload, record.payloadSize),
+                               variable->toString(actual.data(), actual.size())});
+      }
+    }
+  }
+
+  return stepStarts.size()-1;
+}
+
+/*********************************************************************************************************************/
+
+void VariableReplayer::printDifferences(std::ostream &stream) const {
+  stream << "==== Differences between recording and replay: " << differences.size() << " ====" << std::endl;
+  for(auto &difference : differences) {
+    stream << "Step " << difference.step << ": " << difference.variable << " expected [" << difference.expected
+           << "] got [" << difference.actual << "]" << std::endl;
+  }
+}
@@ -19,10 +19,18 @@ namespace ChimeraTK {
     /// @todo find a better way than storing plain pointers!
     for(auto &mod : other.submodules) addSubModule(mod);
     accessorList = other.accessorList;
+    accessorIndex = other.accessorIndex;
     _eliminateHierarchy = other._eliminateHierarchy;
     _moduleType = other.getModuleType();
   }
 
+/*********************************************************************************************************************/
+
+  VirtualModule::VirtualModule(VirtualModule &&other)
+  : Module(nullptr, other.getName(), other.getDescription()) {
+    operator=(std::move(other));
+  }
+
 /*********************************************************************************************************************/
 
   VirtualModule::~VirtualModule() {
@@ -31,31 +39,56 @@ namespace ChimeraTK {
 /*********************************************************************************************************************/
 
   VirtualModule& VirtualModule::operator=(const VirtualModule &other) {
+    if(this == &other) return *this;
     // move-assign a plain new module
     Module::operator=(VirtualModule(other.getName(), other.getDescription(), other.getModuleType()));
+    submodules.clear();
+    submoduleIndex.clear();
     // since moduleList stores plain pointers, we need to regenerate this list
     /// @todo find a better way than storing plain pointers!
     for(auto &mod : other.submodules) addSubModule(mod);
     accessorList = other.accessorList;
+    accessorIndex = other.accessorIndex;
+    _eliminateHierarchy = other._eliminateHierarchy;
+    return *this;
+  }
+
+/*********************************************************************************************************************/
+
+  VirtualModule& VirtualModule::operator=(VirtualModule &&other) {
+    if(this == &other) return *this;
+    _name = other.getName();
+    _description = other.getDescription();
+    _moduleType = other.getModuleType();
     _eliminateHierarchy = other._eliminateHierarchy;
+    // the elements of a std::list keep their addresses when the list is moved, so the pointers in moduleList and
+    // submoduleIndex stay valid
+    submodules = std::move(other.submodules);
+    moduleList = std::move(other.moduleList);
+    submoduleIndex = std::move(other.submoduleIndex);
+    accessorList = std::move(other.accessorList);
+    accessorIndex = std::move(other.accessorIndex);
+    other.submodules.clear();
+    other.moduleList.clear();
+    other.submoduleIndex.clear();
+    other.accessorList.clear();
+    other.accessorIndex.clear();
     return *this;
   }
 
 /*********************************************************************************************************************/
 
   VariableNetworkNode VirtualModule::operator()(const std::string& variableName) const {
-    for(auto variable : getAccessorList()) {
-      if(variable.getName() == variableName) return VariableNetworkNode(variable);
-    }
+    auto it = accessorIndex.find(variableName);
+    if(it != accessorIndex.end()) return it->second;
     throw std::logic_error("Variable '"+variableName+"' is not part of the variable group '"+_name+"'.");
   }
 
 /*********************************************************************************************************************/
 
   Module& VirtualModule::operator[](const std::string& moduleName) const {
-    for(auto submodule : getSubmoduleList()) {
-      if(submodule->getName() == moduleName) return *submodule;
-    }
+    auto submodule = findVirtualSubmodule(moduleName);
+    if(submodule != nullptr) return *submodule;
     throw std::logic_error("Sub-module '"+moduleName+"' is not part of the variable group '"+_name+"'.");
   }
 
@@ -65,17 +98,18 @@ namespace ChimeraTK {
 
     // connect all direct variables of this module to their counter-parts in the right-hand-side module
     for(auto variable : getAccessorList()) {
+      auto targetVariable = target(variable.getName());
       if(variable.getDirection() == VariableDirection::feeding) {
-        variable >> target(variable.getName());
+        variable >> targetVariable;
       }
       else {
         // use trigger?
-        if(trigger != VariableNetworkNode() && target(variable.getName()).getMode() == UpdateMode::poll
+        if(trigger != VariableNetworkNode() && targetVariable.getMode() == UpdateMode::poll
                                             && variable.getMode() == UpdateMode::push ) {
-          target(variable.getName()) [ trigger ] >> variable;
+          targetVariable [ trigger ] >> variable;
         }
         else {
-          target(variable.getName()) >> variable;
+          targetVariable >> variable;
         }
       }
     }
@@ -90,8 +124,38 @@ namespace ChimeraTK {
 /*********************************************************************************************************************/
 
   void VirtualModule::addSubModule(VirtualModule module) {
-    submodules.push_back(module);
+    submodules.push_back(std::move(module));
     registerModule(&(submodules.back()));
+    submoduleIndex.emplace(submodules.back().getName(), &(submodules.back()));
+  }
+
+/*********************************************************************************************************************/
+
+  VirtualModule* VirtualModule::findVirtualSubmodule(const std::string &moduleName) const {
+    auto it = submoduleIndex.find(moduleName);
+    if(it == submoduleIndex.end()) return nullptr;
+    return it->second;
+  }
+
+/*********************************************************************************************************************/
+
+  void VirtualModule::registerAccessor(VariableNetworkNode accessor) {
+    Module::registerAccessor(accessor);
+    accessorIndex.emplace(accessor.getName(), accessor);
+  }
+
+/*********************************************************************************************************************/
+
+  void VirtualModule::unregisterAccessor(VariableNetworkNode accessor) {
+    Module::unregisterAccessor(accessor);
+    rebuildAccessorIndex();
+  }
+
+/*********************************************************************************************************************/
+
+  void VirtualModule::rebuildAccessorIndex() {
+    accessorIndex.clear();
+    for(auto &node : accessorList) accessorIndex.emplace(node.getName(), node);
   }
 
 /*********************************************************************************************************************/
@@ -0,0 +1,55 @@
+/*
+ * WaitPolicy.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#include "WaitPolicy.h"
+#include "ApplicationException.h"
+
+using namespace ChimeraTK;
+
+/*********************************************************************************************************************/
+
+bool WaitPolicy::spinsLongerThan(const WaitPolicy &other) const {
+  if(mode == other.mode) return mode == Mode::spinThenBlock && spinTime > other.spinTime;
+  if(mode == Mode::busyPoll) return true;
+  return mode == Mode::spinThenBlock && other.mode == Mode::block;
+}
+
+/*********************************************************************************************************************/
+
+WaitPolicy WaitPolicy::fromTags(const std::unordered_set<std::string> &tags) {
+  WaitPolicy policy;
+  for(auto &tag : tags) {
+    WaitPolicy tagPolicy;
+    if(tag == "waitBusyPoll") {
+      tagPolicy.mode = Mode::busyPoll;
+    }
+    else if(tag.compare(0, 8, "waitSpin") == 0) {
+      std::string value = tag.substr(8);
+      size_t length = 0;
+      long spinTime = -1;
+      try {
+        spinTime = std::stol(value, &length);
+      }
+      catch(std::logic_error &e) {}
+      if(spinTime < 0 || length != value.size()) {
+        throw ApplicationExceptionWithID<ApplicationExceptionID::illegalParameter>(
+            "Cannot parse the value of the tag '"+tag+"'.");
+      }
+      tagPolicy.mode = Mode::spinThenBlock;
+      tagPolicy.spinTime = std::chrono::microseconds(spinTime);
+    }
+    // if several tags are given (e.g. from the module and the accessor), the longest spinning one wins
+    if(tagPolicy.spinsLongerThan(policy)) policy = tagPolicy;
+  }
+  return policy;
+}
+
+/*********************************************************************************************************************/
+
+WaitPolicy& WaitPolicy::currentThread() {
+  thread_local static WaitPolicy policy;
+  return policy;
+}
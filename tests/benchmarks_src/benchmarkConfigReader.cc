@@ -0,0 +1,128 @@
+/*
+ * benchmarkConfigReader.cc
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  Benchmark of the ConfigReader with a large config file. A config file of the given size is generated, consisting
+ *  of large arrays of all numeric types plus many scalars. The time to parse the file and the peak memory (maximum
+ *  resident set size) of the process are printed, both for the XML file and for the compiled file (see
+ *  ConfigReader::compile()). Since the peak memory cannot be reset, the XML file is parsed first.
+ *
+ *  Usage: benchmarkConfigReader [fileSizeInMB]
+ */
+
+#include <sys/resource.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+#include "ApplicationCore.h"
+#include "ConfigReader.h"
+
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+struct BenchmarkApplication : ctk::Application {
+  BenchmarkApplication() : Application("benchmarkApplication") {}
+  ~BenchmarkApplication() { shutdown(); }
+
+  void defineConnections() {}
+};
+
+/*********************************************************************************************************************/
+
+/** Peak resident set size of the process in MB */
+double peakMemory() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss/1024.;       // ru_maxrss is in kB on Linux
+}
+
+/*********************************************************************************************************************/
+
+/** Write a config file with at least the given number of bytes. Returns the number of values written. */
+size_t generateConfigFile(const std::string &fileName, size_t targetSize) {
+  std::ofstream file(fileName);
+  file << "<configuration>\n";
+  size_t nValues = 0;
+  const char *types[] = {"int32", "double", "uint16", "float", "int64"};
+  for(size_t iArray=0; file.tellp() < std::streamoff(targetSize); ++iArray) {
+    // some scalars between the arrays
+    for(size_t i=0; i<100; ++i) {
+      file << "  <variable name=\"scalar" << iArray << "_" << i << "\" type=\"int32\" value=\"" << i*iArray
+           << "\"/>\n";
+      ++nValues;
+    }
+    // one array with 100000 values
+    const char *type = types[iArray % 5];
+    file << "  <variable name=\"array" << iArray << "\" type=\"" << type << "\">\n";
+    for(size_t i=0; i<100000; ++i) {
+      file << "    <value i=\"" << i << "\" v=\"";
+      if(type[0] == 'd' || type[0] == 'f') {
+        file << i*0.125;
+      }
+      else {
+        file << i % 60000;
+      }
+      file << "\"/>\n";
+    }
+    nValues += 100000;
+    file << "  </variable>\n";
+  }
+  file << "</configuration>\n";
+  return nValues;
+}
+
+/*********************************************************************************************************************/
+
+int main(int argc, char **argv) {
+  size_t fileSize = (argc > 1 ? std::atol(argv[1]) : 100) * 1024*1024;
+  std::string fileName = "benchmarkConfigReader.xml";
+
+  std::cout << "Generating config file..." << std::endl;
+  std::remove((fileName+".bin").c_str());
+  size_t nValues = generateConfigFile(fileName, fileSize);
+  double memoryBefore = peakMemory();
+
+  // parse the XML file
+  {
+    BenchmarkApplication app;
+    auto start = std::chrono::steady_clock::now();
+    ctk::ConfigReader config(&app, "config", fileName);
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end-start).count();
+    std::cout << "Values in the file:         " << nValues << std::endl;
+    std::cout << "Parsing the XML file:       " << seconds << " s (" << fileSize/1024./1024./seconds << " MB/s, "
+              << seconds/nValues*1e9 << " ns per value)" << std::endl;
+    std::cout << "Peak memory:                " << peakMemory() << " MB (" << memoryBefore << " MB before parsing)"
+              << std::endl;
+  }
+
+  // compile the file and load the compiled file
+  {
+    auto start = std::chrono::steady_clock::now();
+    ctk::ConfigReader::compile(fileName);
+    auto compiled = std::chrono::steady_clock::now();
+
+    BenchmarkApplication app;
+    auto loadStart = std::chrono::steady_clock::now();
+    ctk::ConfigReader config(&app, "config", fileName);
+    auto end = std::chrono::steady_clock::now();
+    if(!config.isLoadedFromCompiledFile()) {
+      std::cout << "The compiled file has not been used!" << std::endl;
+      return 1;
+    }
+    std::cout << "Compiling the file:         " << std::chrono::duration<double>(compiled-start).count() << " s"
+              << std::endl;
+    std::cout << "Loading the compiled file:  " << std::chrono::duration<double>(end-loadStart).count() << " s"
+              << std::endl;
+  }
+
+  std::remove(fileName.c_str());
+  std::remove((fileName+".bin").c_str());
+  return 0;
+}
@@ -0,0 +1,100 @@
+/*
+ * benchmarkConnectTo.cc
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  Benchmark of Module::virtualise() and Module::connectTo() for synthetic module trees of different sizes. The trees
+ *  consist of nested VariableGroups with a fixed number of variables per group and a fixed number of sub-groups per
+ *  group. The time per variable should not depend on the size of the tree.
+ *
+ *  Usage: benchmarkConnectTo [maximumDepth] [groupsPerLevel] [variablesPerGroup]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "ApplicationCore.h"
+
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+/* a group with some variables and sub-groups down to the given depth */
+
+struct Node : ctk::VariableGroup {
+  Node(ctk::EntityOwner *owner, const std::string &name, size_t depth, size_t groupsPerLevel, size_t variablesPerGroup)
+  : ctk::VariableGroup(owner, name, "")
+  {
+    // reserve the vectors, since moving the accessors and groups would be slow
+    variables.reserve(variablesPerGroup);
+    for(size_t i=0; i<variablesPerGroup; ++i) {
+      variables.emplace_back(this, "var"+std::to_string(i), "", "");
+    }
+    if(depth == 0) return;
+    children.reserve(groupsPerLevel);
+    for(size_t i=0; i<groupsPerLevel; ++i) {
+      children.emplace_back(this, "group"+std::to_string(i), depth-1, groupsPerLevel, variablesPerGroup);
+    }
+  }
+
+  std::vector<ctk::ScalarOutput<int32_t>> variables;
+  std::vector<Node> children;
+};
+
+/*********************************************************************************************************************/
+
+struct TreeModule : ctk::ApplicationModule {
+  TreeModule(ctk::EntityOwner *owner, size_t depth, size_t groupsPerLevel, size_t variablesPerGroup)
+  : ctk::ApplicationModule(owner, "tree", ""), root(this, "root", depth, groupsPerLevel, variablesPerGroup)
+  {}
+
+  Node root;
+
+  void mainLoop() {}
+};
+
+/*********************************************************************************************************************/
+
+struct BenchmarkApplication : ctk::Application {
+  BenchmarkApplication(size_t depth, size_t groupsPerLevel, size_t variablesPerGroup)
+  : Application("benchmarkApplication"), tree(this, depth, groupsPerLevel, variablesPerGroup)
+  {}
+  ~BenchmarkApplication() { shutdown(); }
+
+  void defineConnections() {}
+
+  TreeModule tree;
+  ctk::ControlSystemModule cs;
+};
+
+/*********************************************************************************************************************/
+
+int main(int argc, char **argv) {
+  size_t maximumDepth = argc > 1 ? std::atol(argv[1]) : 5;
+  size_t groupsPerLevel = argc > 2 ? std::atol(argv[2]) : 6;
+  size_t variablesPerGroup = argc > 3 ? std::atol(argv[3]) : 5;
+
+  std::cout << std::setw(8) << "depth" << std::setw(12) << "variables" << std::setw(16) << "virtualise [us]"
+            << std::setw(16) << "connectTo [us]" << std::setw(16) << "ns/variable" << std::endl;
+
+  for(size_t depth=1; depth<=maximumDepth; ++depth) {
+    BenchmarkApplication app(depth, groupsPerLevel, variablesPerGroup);
+    size_t nVariables = app.tree.getAccessorListRecursive().size();
+
+    auto start = std::chrono::steady_clock::now();
+    app.tree.virtualise();
+    auto virtualised = std::chrono::steady_clock::now();
+    app.tree.connectTo(app.cs);
+    auto end = std::chrono::steady_clock::now();
+
+    double virtualiseTime = std::chrono::duration<double, std::micro>(virtualised-start).count();
+    double connectTime = std::chrono::duration<double, std::micro>(end-virtualised).count();
+    std::cout << std::setw(8) << depth << std::setw(12) << nVariables << std::setw(16) << std::fixed
+              << std::setprecision(0) << virtualiseTime << std::setw(16) << connectTime << std::setw(16)
+              << std::setprecision(1) << (virtualiseTime+connectTime)*1000./nVariables << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,86 @@
+/*
+ * benchmarkDirtyRangeWrites.cc
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  Benchmark of the DirtyRangeDecoratorRegisterAccessor with the dummy backend. A table of 16k elements is written
+ *  repeatedly with a varying number of changed elements, once with a plain register accessor transferring the full
+ *  table and once with the decorator transferring only the changed blocks. The number of bytes transferred to the
+ *  device and the time per write are printed for both.
+ *
+ *  Usage: benchmarkDirtyRangeWrites [nWrites] [blockSize]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+
+#include <mtca4u/BackendFactory.h>
+
+#include "DirtyRangeDecoratorRegisterAccessor.h"
+
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+int main(int argc, char **argv) {
+  size_t nWrites = argc > 1 ? std::atol(argv[1]) : 1000;
+  size_t blockSize = ctk::DirtyRangeWrites::defaultBlockSize;
+  if(argc > 2) blockSize = std::atol(argv[2]);
+
+  mtca4u::BackendFactory::getInstance().setDMapFilePath("test.dmap");
+  auto backend = mtca4u::BackendFactory::getInstance().createBackend("Dummy0");
+  backend->open();
+  auto full = backend->getRegisterAccessor<int32_t>("/MyModule/table", 0, 0, {});
+  size_t nElements = full->getNumberOfSamples();
+
+  std::vector<boost::shared_ptr<mtca4u::NDRegisterAccessor<int32_t>>> blocks;
+  for(size_t offset = 0; offset < nElements; offset += blockSize) {
+    size_t length = offset+blockSize <= nElements ? blockSize : nElements-offset;
+    blocks.push_back(backend->getRegisterAccessor<int32_t>("/MyModule/table", length, offset, {}));
+  }
+  auto dirtyRange = boost::make_shared<ctk::DirtyRangeDecoratorRegisterAccessor<int32_t>>(
+      backend->getRegisterAccessor<int32_t>("/MyModule/table", 0, 0, {}), blocks);
+
+  std::cout << "table of " << nElements << " elements, blocks of " << blockSize << " elements, " << nWrites
+            << " writes" << std::endl;
+  std::cout << std::setw(10) << "changed" << std::setw(16) << "full [bytes]" << std::setw(16) << "full [us]"
+            << std::setw(16) << "dirty [bytes]" << std::setw(16) << "dirty [us]" << std::endl;
+
+  for(size_t nChanged : {size_t(1), size_t(16), size_t(256), nElements/4, nElements}) {
+    // spread the changed elements evenly over the table
+    size_t stride = nElements/nChanged;
+
+    // plain accessor, transferring the full table on each write
+    auto t0 = std::chrono::steady_clock::now();
+    for(size_t n=0; n<nWrites; ++n) {
+      for(size_t i=0; i<nChanged; ++i) full->accessData(i*stride) = n;
+      full->write();
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    size_t fullBytes = nWrites*nElements*sizeof(int32_t);
+
+    // decorator, transferring only the changed blocks (the first write of the decorator transfers all blocks)
+    dirtyRange->write();
+    uint64_t elementsBefore = dirtyRange->getNumberOfTransferredElements();
+    auto t2 = std::chrono::steady_clock::now();
+    for(size_t n=0; n<nWrites; ++n) {
+      for(size_t i=0; i<nChanged; ++i) dirtyRange->accessData(i*stride) = n+1;
+      dirtyRange->write();
+    }
+    auto t3 = std::chrono::steady_clock::now();
+    size_t dirtyBytes = (dirtyRange->getNumberOfTransferredElements()-elementsBefore)*sizeof(int32_t);
+
+    std::cout << std::setw(10) << nChanged << std::setw(16) << fullBytes
+              << std::setw(16) << std::chrono::duration_cast<std::chrono::microseconds>(t1-t0).count()/nWrites
+              << std::setw(16) << dirtyBytes
+              << std::setw(16) << std::chrono::duration_cast<std::chrono::microseconds>(t3-t2).count()/nWrites
+              << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,118 @@
+/*
+ * benchmarkElementwiseKernels.cc
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  Benchmark of the ElementwiseKernels for all pairs of input and output types and all instruction sets supported by
+ *  the CPU, compared to the plain loop previously used by the Multiplier modules. The 64 bit integer types have no
+ *  vectorised kernels, so their columns show the plain loop for all instruction sets.
+ *
+ *  Usage: benchmarkElementwiseKernels [numberOfElements] [numberOfRepetitions]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ElementwiseKernels.h"
+
+namespace kernels = ChimeraTK::ElementwiseKernels;
+
+/*********************************************************************************************************************/
+
+template<typename T> std::string typeName();
+template<> std::string typeName<int8_t>() { return "int8"; }
+template<> std::string typeName<uint8_t>() { return "uint8"; }
+template<> std::string typeName<int16_t>() { return "int16"; }
+template<> std::string typeName<uint16_t>() { return "uint16"; }
+template<> std::string typeName<int32_t>() { return "int32"; }
+template<> std::string typeName<uint32_t>() { return "uint32"; }
+template<> std::string typeName<int64_t>() { return "int64"; }
+template<> std::string typeName<uint64_t>() { return "uint64"; }
+template<> std::string typeName<float>() { return "float"; }
+template<> std::string typeName<double>() { return "double"; }
+
+/*********************************************************************************************************************/
+
+/* return the time per element in nanoseconds */
+template<typename FUNCTION>
+double measure(FUNCTION function, size_t nElements, size_t nRepetitions) {
+  function();   // warm up
+  auto start = std::chrono::steady_clock::now();
+  for(size_t i=0; i<nRepetitions; ++i) {
+    function();
+    // prevent the compiler from merging or removing the repetitions of the inlined plain loop
+    asm volatile("" : : : "memory");
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end-start).count() / (nRepetitions*nElements);
+}
+
+/*********************************************************************************************************************/
+
+template<typename InputType, typename OutputType>
+void benchmark(size_t nElements, size_t nRepetitions) {
+  std::vector<InputType> input(nElements);
+  for(size_t i=0; i<nElements; ++i) input[i] = (i % 50) + 0.5;
+  std::vector<OutputType> output(nElements);
+
+  std::cout << std::setw(8) << typeName<InputType>() << std::setw(8) << typeName<OutputType>();
+
+  double plain = measure([&] { kernels::detail::multiplyScalar(input.data(), output.data(), nElements, 1.5); },
+                         nElements, nRepetitions);
+  std::cout << std::setw(12) << std::fixed << std::setprecision(3) << plain;
+
+  for(auto set : {kernels::InstructionSet::sse41, kernels::InstructionSet::avx2}) {
+    if(static_cast<int>(set) > static_cast<int>(kernels::getSupportedInstructionSet())) {
+      std::cout << std::setw(12) << "n/a";
+      continue;
+    }
+    kernels::setInstructionSet(set);
+    double time = measure([&] { kernels::multiply(input.data(), output.data(), nElements, 1.5); },
+                          nElements, nRepetitions);
+    std::cout << std::setw(12) << time;
+  }
+  std::cout << std::endl;
+}
+
+template<typename InputType>
+void benchmarkInput(size_t nElements, size_t nRepetitions) {
+  benchmark<InputType, int8_t>(nElements, nRepetitions);
+  benchmark<InputType, uint8_t>(nElements, nRepetitions);
+  benchmark<InputType, int16_t>(nElements, nRepetitions);
+  benchmark<InputType, uint16_t>(nElements, nRepetitions);
+  benchmark<InputType, int32_t>(nElements, nRepetitions);
+  benchmark<InputType, uint32_t>(nElements, nRepetitions);
+  benchmark<InputType, int64_t>(nElements, nRepetitions);
+  benchmark<InputType, uint64_t>(nElements, nRepetitions);
+  benchmark<InputType, float>(nElements, nRepetitions);
+  benchmark<InputType, double>(nElements, nRepetitions);
+}
+
+/*********************************************************************************************************************/
+
+int main(int argc, char **argv) {
+  size_t nElements = argc > 1 ? std::atol(argv[1]) : 65536;
+  size_t nRepetitions = argc > 2 ? std::atol(argv[2]) : 1000;
+
+  std::cout << "Time per element in ns for " << nElements << " elements, " << nRepetitions << " repetitions"
+            << std::endl;
+  std::cout << std::setw(8) << "input" << std::setw(8) << "output" << std::setw(12) << "plain" << std::setw(12)
+            << "sse4.1" << std::setw(12) << "avx2" << std::endl;
+
+  benchmarkInput<int8_t>(nElements, nRepetitions);
+  benchmarkInput<uint8_t>(nElements, nRepetitions);
+  benchmarkInput<int16_t>(nElements, nRepetitions);
+  benchmarkInput<uint16_t>(nElements, nRepetitions);
+  benchmarkInput<int32_t>(nElements, nRepetitions);
+  benchmarkInput<uint32_t>(nElements, nRepetitions);
+  benchmarkInput<int64_t>(nElements, nRepetitions);
+  benchmarkInput<uint64_t>(nElements, nRepetitions);
+  benchmarkInput<float>(nElements, nRepetitions);
+  benchmarkInput<double>(nElements, nRepetitions);
+
+  return 0;
+}
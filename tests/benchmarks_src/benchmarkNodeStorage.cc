@@ -0,0 +1,103 @@
+/*
+ * benchmarkNodeStorage.cc
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  Benchmark of the memory footprint and the creation time of VariableNetworkNodes. An application with many
+ *  identical modules is created, as it is typical for large applications (e.g. one module per channel). The heap
+ *  memory used per node and the time to create and to traverse all nodes are printed. Run this benchmark on
+ *  different versions of the library to compare the storage layouts.
+ *
+ *  Usage: benchmarkNodeStorage [numberOfModules]
+ */
+
+#include <malloc.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "ApplicationCore.h"
+
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+/* heap memory in use, mallinfo2() is only available since glibc 2.33 */
+
+#if defined(__GLIBC_PREREQ)
+#if __GLIBC_PREREQ(2,33)
+#define HAVE_MALLINFO2
+#endif
+#endif
+
+static size_t heapInUse() {
+#ifdef HAVE_MALLINFO2
+  return mallinfo2().uordblks;
+#else
+  return size_t(unsigned(mallinfo().uordblks));
+#endif
+}
+
+/*********************************************************************************************************************/
+
+struct ChannelModule : ctk::ApplicationModule {
+  using ctk::ApplicationModule::ApplicationModule;
+
+  ctk::ScalarPushInput<double> setpoint{this, "setpoint", "MV/m", "Setpoint of the amplitude of the channel"};
+  ctk::ScalarPollInput<double> calibration{this, "calibration", "MV/m/V", "Calibration factor of the probe signal"};
+  ctk::ScalarOutput<double> readback{this, "readback", "MV/m", "Measured amplitude of the channel"};
+  ctk::ArrayOutput<float> trace{this, "trace", "MV/m", 2048, "Amplitude trace of the channel"};
+  ctk::ScalarOutput<int32_t> status{this, "status", "", "Status word of the channel controller"};
+
+  void mainLoop() {}
+};
+
+/*********************************************************************************************************************/
+
+struct BenchmarkApplication : ctk::Application {
+  BenchmarkApplication() : Application("benchmarkApplication") {}
+  ~BenchmarkApplication() { shutdown(); }
+
+  void defineConnections() {}
+
+  std::vector<std::unique_ptr<ChannelModule>> channels;
+};
+
+/*********************************************************************************************************************/
+
+int main(int argc, char **argv) {
+  size_t nModules = argc > 1 ? std::atol(argv[1]) : 20000;
+
+  BenchmarkApplication app;
+
+  auto memoryBefore = heapInUse();
+  auto start = std::chrono::steady_clock::now();
+  for(size_t i=0; i<nModules; ++i) {
+    app.channels.emplace_back(new ChannelModule(&app, "channel"+std::to_string(i), "A channel"));
+  }
+  auto created = std::chrono::steady_clock::now();
+  auto memoryAfter = heapInUse();
+
+  // traverse all nodes and access the meta data, as the connection code does
+  auto nodes = app.getAccessorListRecursive();
+  auto traverseStart = std::chrono::steady_clock::now();
+  size_t totalLength = 0;
+  for(auto &node : nodes) {
+    totalLength += node.getName().size() + node.getUnit().size() + node.getDescription().size();
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  size_t nNodes = nodes.size();
+  std::cout << "Nodes created:        " << nNodes << std::endl;
+  std::cout << "Heap memory per node: " << double(memoryAfter-memoryBefore)/nNodes << " bytes (including the "
+            << "modules and accessors)" << std::endl;
+  std::cout << "Creation time:        "
+            << std::chrono::duration<double, std::nano>(created-start).count()/nNodes << " ns per node" << std::endl;
+  std::cout << "Traversal time:       "
+            << std::chrono::duration<double, std::nano>(end-traverseStart).count()/nNodes << " ns per node ("
+            << totalLength << " characters)" << std::endl;
+
+  return 0;
+}
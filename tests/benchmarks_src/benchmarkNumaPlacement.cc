@@ -0,0 +1,164 @@
+/*
+ * benchmarkNumaPlacement.cc
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  Benchmark of the cross-socket traffic when passing large arrays between two ApplicationModules. The producer fills
+ *  an array and sends it to the consumer, which sums it up and acknowledges it, so each update is transferred
+ *  exactly once. This is measured for the modules placed on the same NUMA node (as done by
+ *  Application::enableNumaPlacement()), for the modules placed on different nodes, and without any placement.
+ *
+ *  The cross-socket traffic is estimated from the NUMA node of the buffer pages: each byte written or read by a
+ *  thread running on another node than the page is counted. The nodes of some pages are sampled once per update.
+ *  On systems with a single NUMA node, the case with the modules on different nodes is skipped.
+ *
+ *  Usage: benchmarkNumaPlacement [numberOfElements] [numberOfUpdates]
+ */
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <iomanip>
+#include <iostream>
+
+#include "ApplicationCore.h"
+#include "Numa.h"
+
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+
+/** Estimated number of bytes of the given buffer which are located on another node than the one of the calling
+ *  thread. The node is determined for up to 64 pages evenly distributed over the buffer. */
+template<typename UserType>
+double remoteBytes(const UserType *buffer, size_t nElements) {
+  static const size_t pageSize = sysconf(_SC_PAGESIZE);
+  int node = ctk::Numa::getCurrentNode();
+  size_t size = nElements*sizeof(UserType);
+  size_t nPages = (size+pageSize-1)/pageSize;
+  size_t stride = std::max(nPages/64, size_t(1));
+  size_t nSamples = 0, nRemote = 0;
+  for(size_t page = 0; page < nPages; page += stride) {
+    int pageNode = ctk::Numa::getNodeOfAddress(reinterpret_cast<const char*>(buffer)+page*pageSize);
+    if(pageNode >= 0 && pageNode != node) ++nRemote;
+    ++nSamples;
+  }
+  return nSamples > 0 ? double(nRemote)/nSamples*size : 0.;
+}
+
+/*********************************************************************************************************************/
+
+struct Producer : ctk::ApplicationModule {
+  Producer(EntityOwner *owner, const std::string &name, const std::unordered_set<std::string> &tags,
+           size_t nElements, size_t nUpdates)
+  : ApplicationModule(owner, name, "", false, tags),
+    output(this, "array", "", nElements, ""), nUpdates(nUpdates) {}
+
+  ctk::ArrayOutput<double> output;
+  ctk::ScalarPushInput<int32_t> acknowledge{this, "acknowledge", "", ""};
+  size_t nUpdates;
+  double remote{0};
+
+  void mainLoop() {
+    for(size_t i=0; i<nUpdates; ++i) {
+      for(size_t k=0; k<output.getNElements(); ++k) output[k] = i+k;
+      remote += remoteBytes(&output[0], output.getNElements());
+      output.write();
+      acknowledge.read();
+    }
+  }
+};
+
+/*********************************************************************************************************************/
+
+struct Consumer : ctk::ApplicationModule {
+  Consumer(EntityOwner *owner, const std::string &name, const std::unordered_set<std::string> &tags,
+           size_t nElements, size_t nUpdates)
+  : ApplicationModule(owner, name, "", false, tags),
+    input(this, "array", "", nElements, ""), nUpdates(nUpdates) {}
+
+  ctk::ArrayPushInput<double> input;
+  ctk::ScalarOutput<int32_t> acknowledge{this, "acknowledge", "", ""};
+  size_t nUpdates;
+  double remote{0};
+  double sum{0};
+  std::promise<void> done;
+
+  void mainLoop() {
+    for(size_t i=0; i<nUpdates; ++i) {
+      input.read();
+      remote += remoteBytes(&input[0], input.getNElements());
+      for(auto &value : input) sum += value;
+      acknowledge.write();
+    }
+    done.set_value();
+  }
+};
+
+/*********************************************************************************************************************/
+
+struct BenchmarkApplication : ctk::Application {
+  BenchmarkApplication(const std::unordered_set<std::string> &producerTags,
+                       const std::unordered_set<std::string> &consumerTags, size_t nElements, size_t nUpdates)
+  : Application("benchmarkApplication"),
+    producer(this, "producer", producerTags, nElements, nUpdates),
+    consumer(this, "consumer", consumerTags, nElements, nUpdates) {}
+  ~BenchmarkApplication() { shutdown(); }
+
+  void defineConnections() {
+    producer.output >> consumer.input;
+    consumer.acknowledge >> producer.acknowledge;
+  }
+
+  Producer producer;
+  Consumer consumer;
+};
+
+/*********************************************************************************************************************/
+
+void benchmark(const std::string &name, const std::unordered_set<std::string> &producerTags,
+               const std::unordered_set<std::string> &consumerTags, size_t nElements, size_t nUpdates) {
+  BenchmarkApplication app(producerTags, consumerTags, nElements, nUpdates);
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  auto done = app.consumer.done.get_future();
+  auto start = std::chrono::steady_clock::now();
+  app.run();
+  done.wait();
+  auto end = std::chrono::steady_clock::now();
+
+  double seconds = std::chrono::duration<double>(end-start).count();
+  double totalBytes = 2.*nUpdates*nElements*sizeof(double);       // written once and read once
+  std::cout << std::left << std::setw(30) << name << std::right
+            << std::setw(12) << std::fixed << std::setprecision(1) << totalBytes/seconds/1024/1024 << " MB/s"
+            << std::setw(12) << (app.producer.remote+app.consumer.remote)/1024./1024. << " MB cross-socket"
+            << std::setw(8) << std::setprecision(0) << 100.*(app.producer.remote+app.consumer.remote)/totalBytes
+            << " %" << std::endl;
+}
+
+/*********************************************************************************************************************/
+
+int main(int argc, char **argv) {
+  size_t nElements = argc > 1 ? std::atol(argv[1]) : 4*1024*1024;
+  size_t nUpdates = argc > 2 ? std::atol(argv[2]) : 100;
+  int nNodes = ctk::Numa::getNumberOfNodes();
+
+  std::cout << "NUMA nodes: " << nNodes << ", array size: " << nElements*sizeof(double)/1024./1024. << " MB, "
+            << nUpdates << " updates" << std::endl;
+
+  benchmark("no placement", {}, {}, nElements, nUpdates);
+  benchmark("same node", {"schedNumaNode0"}, {"schedNumaNode0"}, nElements, nUpdates);
+  if(nNodes > 1) {
+    std::string other = "schedNumaNode"+std::to_string(nNodes-1);
+    benchmark("different nodes", {"schedNumaNode0"}, {other}, nElements, nUpdates);
+  }
+  else {
+    std::cout << "Only one NUMA node, skipping the placement on different nodes." << std::endl;
+  }
+
+  return 0;
+}
@@ -19,6 +19,7 @@
 #include "ScalarAccessor.h"
 #include "ArrayAccessor.h"
 #include "ApplicationModule.h"
+#include "StaticConnection.h"
 
 using namespace boost::unit_test_framework;
 namespace ctk = ChimeraTK;
@@ -27,6 +28,7 @@ namespace ctk = ChimeraTK;
 typedef boost::mpl::list<int8_t,uint8_t,
                          int16_t,uint16_t,
                          int32_t,uint32_t,
+                         int64_t,uint64_t,
                          float,double>        test_types;
 
 /*********************************************************************************************************************/
@@ -342,3 +344,47 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( testPseudoArray, T, test_types ) {
   BOOST_CHECK( app.testModule.consumingPush == 33 );
 
 }
+
+/*********************************************************************************************************************/
+/* test case for connections declared at compile time */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( testStaticConnection, T, test_types ) {
+  std::cout << "*** testStaticConnection<" << typeid(T).name() << ">" << std::endl;
+
+  // check the properties determined at compile time
+  static_assert(ctk::StaticConnection<ctk::ScalarOutput<T>, ctk::ScalarPushInput<T>,
+                                      ctk::ScalarPollInput<T>>::nConsumers == 2, "Wrong number of consumers");
+  static_assert(ctk::StaticConnection<ctk::ArrayOutput<T>, ctk::ArrayPushInput<T>>::nConsumers == 1,
+                "Wrong number of consumers");
+
+  TestApplication<T> app;
+
+  auto &network = ctk::connectStatic(app.testModule.feedingPush, app.testModule.consumingPush);
+  BOOST_CHECK(network.getTypedMakeConnection() != nullptr);
+  BOOST_CHECK(network.getValueType() == typeid(T));
+  ctk::connectStatic(app.testModule.feedingArray, app.testModule.consumingPushArray,
+                     app.testModule.consumingPollArray);
+
+  // connecting an already connected accessor is not allowed
+  BOOST_CHECK_THROW(ctk::connectStatic(app.testModule.feedingPush, app.testModule.consumingPush2),
+                    ctk::ApplicationExceptionWithID<ctk::ApplicationExceptionID::illegalVariableNetwork>);
+
+  app.initialise();
+
+  // direct connection
+  app.testModule.feedingPush = 42;
+  app.testModule.feedingPush.write();
+  app.testModule.consumingPush.read();
+  BOOST_CHECK(app.testModule.consumingPush == 42);
+
+  // connection through FanOut
+  for(size_t i=0; i<10; ++i) app.testModule.feedingArray[i] = i+1;
+  app.testModule.feedingArray.write();
+  app.testModule.consumingPushArray.read();
+  app.testModule.consumingPollArray.read();
+  for(size_t i=0; i<10; ++i) {
+    BOOST_CHECK(app.testModule.consumingPushArray[i] == T(i+1));
+    BOOST_CHECK(app.testModule.consumingPollArray[i] == T(i+1));
+  }
+
+}
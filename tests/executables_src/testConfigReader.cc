@@ -7,6 +7,10 @@
 
 #define BOOST_TEST_MODULE testConfigReader
 
+#include <cstdio>
+#include <fstream>
+#include <memory>
+
 #include <boost/test/included/unit_test.hpp>
 using namespace boost::unit_test_framework;
 
@@ -132,3 +136,265 @@ BOOST_AUTO_TEST_CASE( testConfigReader ) {
 
 }
 
+
+/*********************************************************************************************************************/
+/* application using a compiled config file */
+
+struct CompiledConfigApplication : public ctk::Application {
+    CompiledConfigApplication() : Application("testSuite") {}
+    ~CompiledConfigApplication() { shutdown(); }
+
+    void defineConnections() {}             // the setup is done in the tests
+
+    ctk::ConfigReader config{this, "config", "compiledConfig.xml"};
+};
+
+/*********************************************************************************************************************/
+
+/** Check the values of validConfig.xml, independent of how they have been loaded */
+void checkConfigValues(ctk::ConfigReader &config) {
+  BOOST_CHECK_EQUAL(config.get<int8_t>("var8"), -123);
+  BOOST_CHECK_EQUAL(config.get<uint8_t>("var8u"), 34);
+  BOOST_CHECK_EQUAL(config.get<int16_t>("var16"), -567);
+  BOOST_CHECK_EQUAL(config.get<uint16_t>("var16u"), 678);
+  BOOST_CHECK_EQUAL(config.get<int32_t>("var32"), -345678);
+  BOOST_CHECK_EQUAL(config.get<uint32_t>("var32u"), 234567);
+  BOOST_CHECK_EQUAL(config.get<int64_t>("var64"), -2345678901234567890);
+  BOOST_CHECK_EQUAL(config.get<uint64_t>("var64u"), 12345678901234567890U);
+  BOOST_CHECK_CLOSE(config.get<float>("varFloat"), 3.1415, 0.000001);
+  BOOST_CHECK_CLOSE(config.get<double>("varDouble"), -2.8, 0.000001);
+  BOOST_CHECK_EQUAL(config.get<std::string>("varString"), "My dear mister singing club!");
+
+  std::vector<int> arrayValue = config.get<std::vector<int>>("intArray");
+  BOOST_CHECK_EQUAL(arrayValue.size(), 10);
+  for(size_t i=0; i<10; ++i) BOOST_CHECK_EQUAL(arrayValue[i], 10-i);
+
+  std::vector<std::string> arrayValueString = config.get<std::vector<std::string>>("stringArray");
+  BOOST_CHECK_EQUAL(arrayValueString.size(), 8);
+  for(size_t i=0; i<8; ++i) BOOST_CHECK_EQUAL(arrayValueString[i], "Hallo"+std::to_string(i+1));
+}
+
+/*********************************************************************************************************************/
+/* test loading the compiled config file and its invalidation when the XML file changes */
+
+BOOST_AUTO_TEST_CASE( testCompiledConfig ) {
+  std::cout << "*********************************************************************************************************************" << std::endl;
+  std::cout << "==> testCompiledConfig" << std::endl;
+
+  // work on a copy of the config file, since it will be modified
+  {
+    std::ifstream source("validConfig.xml", std::ios_base::binary);
+    std::ofstream target("compiledConfig.xml", std::ios_base::binary | std::ios_base::trunc);
+    target << source.rdbuf();
+  }
+  std::remove("compiledConfig.xml.bin");
+
+  // without compiled file the XML file is parsed
+  {
+    CompiledConfigApplication app;
+    BOOST_CHECK(!app.config.isLoadedFromCompiledFile());
+    checkConfigValues(app.config);
+  }
+
+  // with an up-to-date compiled file the XML file is not parsed
+  ctk::ConfigReader::compile("compiledConfig.xml");
+  {
+    CompiledConfigApplication app;
+    BOOST_CHECK(app.config.isLoadedFromCompiledFile());
+    checkConfigValues(app.config);
+  }
+
+  // after changing the XML file the compiled file is ignored
+  {
+    std::ofstream target("compiledConfig.xml", std::ios_base::app);
+    target << "<!-- Changed after compiling -->" << std::endl;
+  }
+  {
+    CompiledConfigApplication app;
+    BOOST_CHECK(!app.config.isLoadedFromCompiledFile());
+    checkConfigValues(app.config);
+  }
+
+  // a compiled file of another format version is ignored
+  ctk::ConfigReader::compile("compiledConfig.xml");
+  {
+    std::fstream target("compiledConfig.xml.bin", std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+    uint32_t otherVersion = ctk::ConfigReader::compiledFormatVersion+1;
+    target.seekp(8);
+    target.write(reinterpret_cast<const char*>(&otherVersion), sizeof(otherVersion));
+  }
+  {
+    CompiledConfigApplication app;
+    BOOST_CHECK(!app.config.isLoadedFromCompiledFile());
+    checkConfigValues(app.config);
+  }
+
+  // a truncated compiled file is ignored as well
+  ctk::ConfigReader::compile("compiledConfig.xml");
+  {
+    std::ofstream target("compiledConfig.xml.bin", std::ios_base::binary | std::ios_base::trunc);
+    target << ctk::ConfigReader::compiledMagic;
+  }
+  {
+    CompiledConfigApplication app;
+    BOOST_CHECK(!app.config.isLoadedFromCompiledFile());
+    checkConfigValues(app.config);
+  }
+
+}
+
+/*********************************************************************************************************************/
+/* test that invalid config files are rejected */
+
+struct InvalidConfigApplication : public ctk::Application {
+    InvalidConfigApplication() : Application("testSuite") {}
+    ~InvalidConfigApplication() { shutdown(); }
+
+    void defineConnections() {}
+
+    std::unique_ptr<ctk::ConfigReader> config;
+};
+
+void checkInvalidConfig(const std::string &content, bool strictConversion=false) {
+  {
+    std::ofstream file("invalidConfig.xml", std::ios_base::trunc);
+    file << "<configuration>" << content << "</configuration>" << std::endl;
+  }
+  InvalidConfigApplication app;
+  BOOST_CHECK_THROW(app.config.reset(new ctk::ConfigReader(&app, "config", "invalidConfig.xml", {}, strictConversion)),
+                    std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE( testInvalidConfig ) {
+  std::cout << "*********************************************************************************************************************" << std::endl;
+  std::cout << "==> testInvalidConfig" << std::endl;
+
+  // values which cannot be converted into the type or are out of range, only rejected with strict conversion
+  checkInvalidConfig("<variable name=\"var\" type=\"int32\" value=\"12a\"/>", true);
+  checkInvalidConfig("<variable name=\"var\" type=\"int32\" value=\"3.5\"/>", true);
+  checkInvalidConfig("<variable name=\"var\" type=\"uint8\" value=\"256\"/>", true);
+  checkInvalidConfig("<variable name=\"var\" type=\"uint32\" value=\"-1\"/>", true);
+  checkInvalidConfig("<variable name=\"var\" type=\"int64\" value=\"9223372036854775808\"/>", true);
+  checkInvalidConfig("<variable name=\"var\" type=\"double\" value=\"1.5.2\"/>", true);
+  checkInvalidConfig("<variable name=\"var\" type=\"float\"><value i=\"0\" v=\"\"/></variable>", true);
+
+  // structural errors
+  checkInvalidConfig("<variable name=\"var\" type=\"unknownType\" value=\"1\"/>");
+  checkInvalidConfig("<variable name=\"var\" type=\"int32\"/>");
+  checkInvalidConfig("<variable type=\"int32\" value=\"1\"/>");
+  checkInvalidConfig("<variable name=\"var\" type=\"int32\"><value i=\"0\" v=\"1\"/><value i=\"2\" v=\"1\"/></variable>");
+  checkInvalidConfig("<variable name=\"var\" type=\"int32\"><value i=\"x\" v=\"1\"/></variable>");
+  checkInvalidConfig("<variable name=\"var\" type=\"int32\" value=\"1\">");
+
+  // the limits of the types are accepted, array values may be given in any order
+  {
+    std::ofstream file("validLimits.xml", std::ios_base::trunc);
+    file << "<configuration>"
+         << "<variable name=\"min8\" type=\"int8\" value=\"-128\"/>"
+         << "<variable name=\"max64u\" type=\"uint64\" value=\" 18446744073709551615 \"/>"
+         << "<variable name=\"array\" type=\"int16\"><value i=\"2\" v=\"3\"/><value i=\"0\" v=\"1\"/>"
+         << "<value i=\"1\" v=\"2\"/></variable>"
+         << "</configuration>" << std::endl;
+  }
+  InvalidConfigApplication app;
+  app.config.reset(new ctk::ConfigReader(&app, "config", "validLimits.xml"));
+  BOOST_CHECK_EQUAL(app.config->get<int8_t>("min8"), -128);
+  BOOST_CHECK_EQUAL(app.config->get<uint64_t>("max64u"), 18446744073709551615ULL);
+  BOOST_CHECK(app.config->get<std::vector<int16_t>>("array") == std::vector<int16_t>({1, 2, 3}));
+
+  // without strict conversion, values are converted as far as possible
+  {
+    std::ofstream file("lenientValues.xml", std::ios_base::trunc);
+    file << "<configuration>"
+         << "<variable name=\"fraction\" type=\"int32\" value=\"3.5\"/>"
+         << "<variable name=\"suffix\" type=\"int32\" value=\"12a\"/>"
+         << "<variable name=\"tooLarge\" type=\"int16\" value=\"40000\"/>"
+         << "<variable name=\"array\" type=\"double\"><value i=\"0\" v=\"1.5.2\"/></variable>"
+         << "</configuration>" << std::endl;
+  }
+  InvalidConfigApplication lenientApp;
+  lenientApp.config.reset(new ctk::ConfigReader(&lenientApp, "config", "lenientValues.xml"));
+  BOOST_CHECK_EQUAL(lenientApp.config->get<int32_t>("fraction"), 3);
+  BOOST_CHECK_EQUAL(lenientApp.config->get<int32_t>("suffix"), 12);
+  BOOST_CHECK_EQUAL(lenientApp.config->get<int16_t>("tooLarge"), 32767);
+  BOOST_CHECK(lenientApp.config->get<std::vector<double>>("array") == std::vector<double>({1.5}));
+
+}
+
+/*********************************************************************************************************************/
+/* test live reload of a changed config file */
+
+struct LiveReloadModule : ctk::ApplicationModule { using ctk::ApplicationModule::ApplicationModule;
+  ctk::ScalarPushInput<int32_t> gain{this, "gain", "", "Desc"};
+  ctk::ScalarPushInput<int32_t> offset{this, "offset", "", "Desc"};
+  ctk::ArrayPushInput<double> table{this, "table", "", 3, "Desc"};
+
+  void mainLoop() {}
+};
+
+struct LiveReloadApplication : public ctk::Application {
+    LiveReloadApplication() : Application("testSuite") { config.enableLiveReload(); }
+    ~LiveReloadApplication() { shutdown(); }
+
+    void defineConnections() {
+      config.connectTo(module);
+    }
+
+    ctk::ConfigReader config{this, "config", "liveConfig.xml"};
+    LiveReloadModule module{this, "module", "The test module"};
+};
+
+void writeLiveConfig(int32_t gain, int32_t offset, const std::string &table, bool replace) {
+  // editors often write a new file and rename it, which must be detected as well
+  std::string fileName = replace ? "liveConfig.xml.new" : "liveConfig.xml";
+  {
+    std::ofstream file(fileName, std::ios_base::trunc);
+    file << "<configuration>"
+         << "<variable name=\"gain\" type=\"int32\" value=\"" << gain << "\"/>"
+         << "<variable name=\"offset\" type=\"int32\" value=\"" << offset << "\"/>"
+         << "<variable name=\"table\" type=\"double\">" << table << "</variable>"
+         << "</configuration>" << std::endl;
+  }
+  if(replace) std::rename(fileName.c_str(), "liveConfig.xml");
+}
+
+BOOST_AUTO_TEST_CASE( testLiveReload ) {
+  std::cout << "*********************************************************************************************************************" << std::endl;
+  std::cout << "==> testLiveReload" << std::endl;
+
+  std::string table = "<value i=\"0\" v=\"1\"/><value i=\"1\" v=\"2\"/><value i=\"2\" v=\"3\"/>";
+  writeLiveConfig(10, 20, table, false);
+
+  LiveReloadApplication app;
+  app.initialise();
+  app.run();
+  BOOST_CHECK_EQUAL(int32_t(app.module.gain), 10);
+  BOOST_CHECK_EQUAL(int32_t(app.module.offset), 20);
+  usleep(200000);     // give the ConfigReader thread time to start watching
+
+  // change one scalar and one array element: only these are sent, with the same version number
+  std::string changedTable = "<value i=\"0\" v=\"1\"/><value i=\"1\" v=\"2.5\"/><value i=\"2\" v=\"3\"/>";
+  writeLiveConfig(11, 20, changedTable, true);
+  app.module.gain.read();
+  app.module.table.read();
+  BOOST_CHECK_EQUAL(int32_t(app.module.gain), 11);
+  BOOST_CHECK_EQUAL(app.module.table[1], 2.5);
+  BOOST_CHECK(app.module.gain.getVersionNumber() == app.module.table.getVersionNumber());
+  BOOST_CHECK(!app.module.offset.readNonBlocking());
+
+  // invalid changes are ignored: a broken file and a changed array length
+  writeLiveConfig(12, 20, "<value i=\"0\" v=\"1\"/>", false);
+  writeLiveConfig(12, 20, "<value i=\"0\" v=\"x\"/>", false);
+  usleep(500000);
+  BOOST_CHECK(!app.module.gain.readNonBlocking());
+  BOOST_CHECK(!app.module.table.readNonBlocking());
+
+  // a valid change after the invalid ones is sent again
+  writeLiveConfig(12, 21, changedTable, false);
+  app.module.gain.read();
+  app.module.offset.read();
+  BOOST_CHECK_EQUAL(int32_t(app.module.gain), 12);
+  BOOST_CHECK_EQUAL(int32_t(app.module.offset), 21);
+  BOOST_CHECK(!app.module.table.readNonBlocking());
+
+}
@@ -0,0 +1,177 @@
+/*
+ * testDataConsistencyGroup.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#define BOOST_TEST_MODULE testDataConsistencyGroup
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/ControlSystemPVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/DevicePVManager.h>
+
+#include "Application.h"
+#include "ScalarAccessor.h"
+#include "ApplicationModule.h"
+#include "ControlSystemModule.h"
+#include "DataConsistencyGroup.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+/* the modules for the test. The accessors are used directly by the test, so the main loops do nothing. */
+
+struct TestModule : public ctk::ApplicationModule {
+    using ctk::ApplicationModule::ApplicationModule;
+
+    ctk::ScalarPushInput<int32_t> a{this, "a", "", "No comment."};
+    ctk::ScalarPushInput<int32_t> b{this, "b", "", "No comment."};
+
+    ctk::DataConsistencyGroup group{a, b};
+    ctk::DataConsistencyGroup deliveringGroup{{a, b}, ctk::DataConsistencyGroup::IncompletePolicy::deliver};
+
+    void mainLoop() {}
+};
+
+struct OtherModule : public ctk::ApplicationModule {
+    using ctk::ApplicationModule::ApplicationModule;
+
+    ctk::ScalarPushInput<int32_t> b{this, "b", "", "No comment."};
+
+    void mainLoop() {}
+};
+
+/*********************************************************************************************************************/
+/* dummy application. The input "b" has two consumers, so it is distributed by a ThreadedFanOut. */
+
+struct TestApplication : public ctk::Application {
+    TestApplication() : Application("testSuite") {}
+    ~TestApplication() { shutdown(); }
+
+    void defineConnections() {
+      cs("a") >> module.a;
+      cs("b") >> module.b >> other.b;
+    }
+
+    TestModule module{this, "module", "The test module"};
+    OtherModule other{this, "other", "The other module"};
+    ctk::ControlSystemModule cs;
+};
+
+/*********************************************************************************************************************/
+/* send a value with the given VersionNumber from the control system */
+
+void send(boost::shared_ptr<ctk::ProcessArray<int32_t>> pv, int32_t value, ctk::VersionNumber version) {
+  pv->accessData(0) = value;
+  pv->write(version);
+}
+
+/*********************************************************************************************************************/
+/* test matching the VersionNumbers and discarding incomplete sets */
+
+BOOST_AUTO_TEST_CASE( testMatching ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testMatching" << std::endl;
+
+  TestApplication app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  app.run();
+  auto a = pvManagers.first->getProcessArray<int32_t>("/a");
+  auto b = pvManagers.first->getProcessArray<int32_t>("/b");
+  auto &group = app.module.group;
+
+  // a complete set
+  ctk::VersionNumber v1;
+  send(a, 1, v1);
+  app.module.a.read();
+  BOOST_CHECK(!group.update(app.module.a.getId()));
+  BOOST_CHECK(!group.isConsistent());
+  send(b, 2, v1);
+  app.module.b.read();
+  BOOST_CHECK(group.update(app.module.b.getId()));
+  BOOST_CHECK(group.isConsistent());
+  BOOST_CHECK(group.getVersionNumber() == v1);
+
+  // the ThreadedFanOut has propagated the VersionNumber
+  BOOST_CHECK(app.module.b.getVersionNumber() == v1);
+  app.other.b.read();
+  BOOST_CHECK(app.other.b.getVersionNumber() == v1);
+
+  // the set of v2 is incomplete when a receives v3
+  ctk::VersionNumber v2, v3;
+  send(a, 3, v2);
+  app.module.a.read();
+  BOOST_CHECK(!group.update(app.module.a.getId()));
+  send(a, 4, v3);
+  app.module.a.read();
+  BOOST_CHECK(!group.update(app.module.a.getId()));
+  BOOST_CHECK_EQUAL(group.getNumberOfDiscardedSets(), 1);
+
+  // b lagging behind is ignored until it catches up
+  send(b, 5, v2);
+  app.module.b.read();
+  BOOST_CHECK(!group.update(app.module.b.getId()));
+  send(b, 6, v3);
+  app.module.b.read();
+  BOOST_CHECK(group.update(app.module.b.getId()));
+  BOOST_CHECK(group.getVersionNumber() == v3);
+  BOOST_CHECK_EQUAL(group.getNumberOfDiscardedSets(), 1);
+
+  // ids not belonging to the group are ignored
+  BOOST_CHECK(!group.update(app.other.b.getId()));
+
+}
+
+/*********************************************************************************************************************/
+/* test waiting for a complete set */
+
+BOOST_AUTO_TEST_CASE( testReadConsistent ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testReadConsistent" << std::endl;
+
+  TestApplication app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  app.run();
+  auto a = pvManagers.first->getProcessArray<int32_t>("/a");
+  auto b = pvManagers.first->getProcessArray<int32_t>("/b");
+
+  ctk::VersionNumber v1;
+  send(a, 10, v1);
+  send(b, 20, v1);
+  BOOST_CHECK(app.module.group.readConsistent());
+  BOOST_CHECK_EQUAL(int32_t(app.module.a), 10);
+  BOOST_CHECK_EQUAL(int32_t(app.module.b), 20);
+  BOOST_CHECK(app.module.group.getVersionNumber() == v1);
+
+}
+
+/*********************************************************************************************************************/
+/* test delivering incomplete sets */
+
+BOOST_AUTO_TEST_CASE( testDeliverIncomplete ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testDeliverIncomplete" << std::endl;
+
+  TestApplication app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  app.run();
+  auto a = pvManagers.first->getProcessArray<int32_t>("/a");
+
+  // only a receives values, so the set of v1 is discarded when v2 arrives
+  ctk::VersionNumber v1, v2;
+  send(a, 1, v1);
+  send(a, 2, v2);
+  BOOST_CHECK(!app.module.deliveringGroup.readConsistent());
+  BOOST_CHECK_EQUAL(int32_t(app.module.a), 2);
+  BOOST_CHECK_EQUAL(app.module.deliveringGroup.getNumberOfDiscardedSets(), 1);
+
+}
@@ -0,0 +1,118 @@
+/*
+ * testDeadlineMonitor.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#define BOOST_TEST_MODULE testDeadlineMonitor
+
+#include <numeric>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "Application.h"
+#include "ScalarAccessor.h"
+#include "ApplicationModule.h"
+#include "ControlSystemModule.h"
+#include "DeadlineMonitor.h"
+#include "TestFacility.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+/* the ApplicationModule for the test, exceeding its deadline for the input value 1 */
+
+struct TestModule : public ctk::ApplicationModule {
+    using ctk::ApplicationModule::ApplicationModule;
+
+    ctk::ScalarPushInput<int32_t> input{this, "input", "", "No comment."};
+
+    // deadline of 2 ms, publish after each cycle
+    ctk::DeadlineMonitor deadline{this, "deadline", std::chrono::microseconds(2000), 20, std::chrono::milliseconds(0)};
+
+    void mainLoop() {
+      while(true) {
+        input.read();
+        if(input == 1) usleep(5000);
+      }
+    }
+};
+
+/*********************************************************************************************************************/
+/* dummy application */
+
+struct TestApplication : public ctk::Application {
+    TestApplication() : Application("testSuite") {}
+    ~TestApplication() { shutdown(); }
+
+    void defineConnections() {
+      module.connectTo(cs["module"]);
+    }
+
+    TestModule module{this, "module", "The test module"};
+    ctk::ControlSystemModule cs;
+};
+
+/*********************************************************************************************************************/
+/* test the statistics of the cycle times */
+
+BOOST_AUTO_TEST_CASE( testOverruns ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testOverruns" << std::endl;
+
+  TestApplication app;
+  ctk::TestFacility test;
+  test.runApplication();
+
+  // a fast cycle, after the first cycle which ends when the main loop starts waiting for the input
+  test.writeScalar<int32_t>("module/input", 0);
+  test.stepApplication();
+  BOOST_CHECK_EQUAL(test.readScalar<uint32_t>("module/deadline/cycles"), 2);
+  BOOST_CHECK_EQUAL(test.readScalar<uint32_t>("module/deadline/overruns"), 0);
+  BOOST_CHECK_LT(test.readScalar<uint32_t>("module/deadline/worstCycleTime"), 2000);
+
+  // a cycle exceeding the deadline
+  test.writeScalar<int32_t>("module/input", 1);
+  test.stepApplication();
+  BOOST_CHECK_EQUAL(test.readScalar<uint32_t>("module/deadline/cycles"), 3);
+  BOOST_CHECK_EQUAL(test.readScalar<uint32_t>("module/deadline/overruns"), 1);
+  BOOST_CHECK_GE(test.readScalar<uint32_t>("module/deadline/worstCycleTime"), 5000);
+
+  // the histogram contains all cycles, the slow one in the last bin (covering 3.8 ms and more)
+  auto histogram = test.readArray<uint32_t>("module/deadline/cycleTimeHistogram");
+  BOOST_CHECK_EQUAL(histogram.size(), 20);
+  BOOST_CHECK_EQUAL(std::accumulate(histogram.begin(), histogram.end(), 0), 3);
+  BOOST_CHECK_EQUAL(histogram.back(), 1);
+
+}
+
+/*********************************************************************************************************************/
+/* test illegal parameters */
+
+struct IllegalModule : public ctk::ApplicationModule {
+    using ctk::ApplicationModule::ApplicationModule;
+
+    ctk::DeadlineMonitor deadline{this, "deadline", std::chrono::microseconds(0)};
+
+    void mainLoop() {}
+};
+
+struct IllegalApplication : public ctk::Application {
+    IllegalApplication() : Application("testSuite") {}
+    ~IllegalApplication() { shutdown(); }
+
+    void defineConnections() {}
+
+    std::unique_ptr<IllegalModule> module;
+};
+
+BOOST_AUTO_TEST_CASE( testIllegalDeadline ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testIllegalDeadline" << std::endl;
+
+  IllegalApplication app;
+  BOOST_CHECK_THROW(app.module.reset(new IllegalModule(&app, "module", "")),
+                    ctk::ApplicationExceptionWithID<ctk::ApplicationExceptionID::illegalParameter>);
+
+}
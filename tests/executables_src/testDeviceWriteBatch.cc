@@ -0,0 +1,133 @@
+/*
+ * testDeviceWriteBatch.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#define BOOST_TEST_MODULE testDeviceWriteBatch
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <mtca4u/BackendFactory.h>
+#include <mtca4u/Device.h>
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/ControlSystemPVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/DevicePVManager.h>
+
+#include "Application.h"
+#include "ScalarAccessor.h"
+#include "ApplicationModule.h"
+#include "ControlSystemModule.h"
+#include "DeviceModule.h"
+#include "DeviceWriteBatch.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+#define CHECK_TIMEOUT(condition, maxMilliseconds)                                                                   \
+    {                                                                                                               \
+      std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();                                  \
+      while(!(condition)) {                                                                                         \
+        bool timeout_reached = (std::chrono::steady_clock::now()-t0) > std::chrono::milliseconds(maxMilliseconds);  \
+        BOOST_CHECK( !timeout_reached );                                                                            \
+        if(timeout_reached) break;                                                                                  \
+        usleep(1000);                                                                                               \
+      }                                                                                                             \
+    }
+
+/*********************************************************************************************************************/
+/* the module for the test, writing the input value to the device if running is set */
+
+struct TestModule : public ctk::ApplicationModule {
+    TestModule(EntityOwner *owner, const std::string &name, bool running)
+    : ApplicationModule(owner, name, "The test module", false, {ctk::DeviceWriteBatch::tag}), running(running) {}
+
+    ctk::ScalarPushInput<int32_t> input{this, "input", "", "No comment."};
+    ctk::ScalarOutput<int32_t> output{this, "output", "", "No comment."};
+
+    bool running;
+
+    void mainLoop() {
+      if(!running) return;
+      while(true) {
+        input.read();
+        output = int32_t(input);
+        output.write();
+      }
+    }
+};
+
+/*********************************************************************************************************************/
+/* dummy application */
+
+struct TestApplication : public ctk::Application {
+    TestApplication(bool running) : Application("testSuite"), module(this, "module", running) {
+      mtca4u::BackendFactory::getInstance().setDMapFilePath("test.dmap");
+    }
+    ~TestApplication() { shutdown(); }
+
+    void defineConnections() {
+      cs("input") >> module.input;
+      module.output >> dev("/MyModule/actuator");
+    }
+
+    TestModule module;
+    ctk::ControlSystemModule cs;
+    ctk::DeviceModule dev{"Dummy0"};
+};
+
+/*********************************************************************************************************************/
+/* test deferring the writes until the batch is flushed */
+
+BOOST_AUTO_TEST_CASE( testDeferredWrite ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testDeferredWrite" << std::endl;
+
+  TestApplication app(false);
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  app.run();
+
+  mtca4u::Device dev;
+  dev.open("Dummy0");
+  dev.write<int32_t>("/MyModule/actuator", 0);
+
+  // the write is deferred
+  app.module.output = 42;
+  app.module.output.write();
+  BOOST_CHECK_EQUAL(dev.read<int32_t>("/MyModule/actuator"), 0);
+
+  // and executed by writeAll()
+  app.module.writeAll();
+  BOOST_CHECK_EQUAL(dev.read<int32_t>("/MyModule/actuator"), 42);
+
+  // a flush without changes does not write
+  dev.write<int32_t>("/MyModule/actuator", 0);
+  ctk::DeviceWriteBatch::flushCurrentThread();
+  BOOST_CHECK_EQUAL(dev.read<int32_t>("/MyModule/actuator"), 0);
+
+}
+
+/*********************************************************************************************************************/
+/* test flushing the batch at the end of a cycle of the module thread */
+
+BOOST_AUTO_TEST_CASE( testFlushAtEndOfCycle ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testFlushAtEndOfCycle" << std::endl;
+
+  TestApplication app(true);
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  app.run();
+
+  mtca4u::Device dev;
+  dev.open("Dummy0");
+
+  auto input = pvManagers.first->getProcessArray<int32_t>("/input");
+  input->accessData(0) = 17;
+  input->write();
+  CHECK_TIMEOUT( dev.read<int32_t>("/MyModule/actuator") == 17, 3000);
+
+}
@@ -0,0 +1,103 @@
+/*
+ * testDirtyRangeWrites.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#define BOOST_TEST_MODULE testDirtyRangeWrites
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <mtca4u/BackendFactory.h>
+#include <mtca4u/Device.h>
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/ControlSystemPVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/DevicePVManager.h>
+
+#include "Application.h"
+#include "ArrayAccessor.h"
+#include "ApplicationModule.h"
+#include "DeviceModule.h"
+#include "DirtyRangeDecoratorRegisterAccessor.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+static constexpr size_t tableSize = 16384;
+
+/*********************************************************************************************************************/
+/* the module for the test, writing the table from the test thread */
+
+struct TestModule : public ctk::ApplicationModule {
+    using ctk::ApplicationModule::ApplicationModule;
+
+    ctk::ArrayOutput<int32_t> table{this, "table", "", tableSize, "No comment.",
+                                    {ctk::DirtyRangeWrites::tag}};
+
+    void mainLoop() {}
+};
+
+/*********************************************************************************************************************/
+/* dummy application */
+
+struct TestApplication : public ctk::Application {
+    TestApplication() : Application("testSuite") {
+      mtca4u::BackendFactory::getInstance().setDMapFilePath("test.dmap");
+    }
+    ~TestApplication() { shutdown(); }
+
+    void defineConnections() {
+      module.table >> dev("/MyModule/table");
+    }
+
+    TestModule module{this, "module", "The test module"};
+    ctk::DeviceModule dev{"Dummy0"};
+};
+
+/*********************************************************************************************************************/
+/* test writing only the changed blocks */
+
+BOOST_AUTO_TEST_CASE( testChangedBlocks ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testChangedBlocks" << std::endl;
+
+  TestApplication app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  app.run();
+
+  mtca4u::Device dev;
+  dev.open("Dummy0");
+  auto table = dev.getOneDRegisterAccessor<int32_t>("/MyModule/table");
+
+  // the first write transfers the full table
+  for(size_t i=0; i<tableSize; ++i) app.module.table[i] = i;
+  app.module.table.write();
+  table.read();
+  for(size_t i=0; i<tableSize; ++i) BOOST_CHECK_EQUAL(table[i], int32_t(i));
+
+  // modify the device content in two blocks behind the back of the application
+  const size_t blockSize = ctk::DirtyRangeWrites::defaultBlockSize;
+  table[blockSize+1] = -1;
+  table[tableSize-1] = -2;
+  table.write();
+
+  // change an element in the first and in the second block: only these blocks are written
+  app.module.table[0] = 100;
+  app.module.table[blockSize+2] = 101;
+  app.module.table.write();
+  table.read();
+  BOOST_CHECK_EQUAL(table[0], 100);
+  BOOST_CHECK_EQUAL(table[blockSize+1], int32_t(blockSize+1));   // restored by writing the second block
+  BOOST_CHECK_EQUAL(table[blockSize+2], 101);
+  BOOST_CHECK_EQUAL(table[tableSize-1], -2);                     // last block unchanged, hence not written
+
+  // writing the unchanged table transfers nothing
+  table[0] = -3;
+  table.write();
+  app.module.table.write();
+  table.read();
+  BOOST_CHECK_EQUAL(table[0], -3);
+
+}
@@ -0,0 +1,171 @@
+/*
+ * testElementwiseFusion.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#define BOOST_TEST_MODULE testElementwiseFusion
+
+#include <boost/test/included/unit_test.hpp>
+
+#include "Application.h"
+#include "ControlSystemModule.h"
+#include "TestFacility.h"
+#include "Multiplier.h"
+#include "LimitValue.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+/* dummy application */
+
+struct TestApplication : public ctk::Application {
+    TestApplication() : Application("testApplication") {}
+    ~TestApplication() { shutdown(); }
+
+    void defineConnections() {
+      // array chain with a type conversion in between
+      cs("in") >> constMultiplier.input;
+      constMultiplier.output >> multiplier.input;
+      cs("factor") >> multiplier.factor;
+      multiplier.output >> cs("out");
+
+      // scalar chain ending in a LimitValue
+      cs("scalarIn") >> scalarMultiplier.input;
+      scalarMultiplier.output >> limit.input;
+      cs("min") >> limit.min;
+      cs("max") >> limit.max;
+      limit.output >> cs("limited");
+      limit.isLimited >> cs("isLimited");
+
+      // long arrays are processed in several blocks
+      cs("longIn") >> longMultiplier1.input;
+      longMultiplier1.output >> longMultiplier2.input;
+      longMultiplier2.output >> cs("longOut");
+
+      // the output of the first module is also published, so the modules cannot be fused
+      cs("unfusedIn") >> unfused1.input;
+      unfused1.output >> cs("unfusedIntermediate") >> unfused2.input;
+      unfused2.output >> cs("unfusedOut");
+    }
+
+    ctk::ConstMultiplier<int32_t, double, 4> constMultiplier{this, "constMultiplier", "", 2.5};
+    ctk::Multiplier<double, int32_t, 4> multiplier{this, "multiplier", ""};
+
+    ctk::ConstMultiplier<int32_t> scalarMultiplier{this, "scalarMultiplier", "", 3};
+    ctk::LimitValue<int32_t> limit{this, "limit", ""};
+
+    ctk::ConstMultiplier<int16_t, float, 2500> longMultiplier1{this, "longMultiplier1", "", 1.5};
+    ctk::ConstMultiplier<float, int32_t, 2500> longMultiplier2{this, "longMultiplier2", "", 3.1};
+
+    ctk::ConstMultiplier<int32_t> unfused1{this, "unfused1", "", 2};
+    ctk::ConstMultiplier<int32_t> unfused2{this, "unfused2", "", 3};
+
+    ctk::ControlSystemModule cs;
+};
+
+/*********************************************************************************************************************/
+/* application with stages of different lengths connected to each other, which is illegal */
+
+struct LengthMismatchApplication : public ctk::Application {
+    LengthMismatchApplication() : Application("testApplication") {}
+    ~LengthMismatchApplication() { shutdown(); }
+
+    void defineConnections() {
+      cs("in") >> constMultiplier.input;
+      constMultiplier.output >> multiplier.input;
+      cs("factor") >> multiplier.factor;
+      multiplier.output >> cs("out");
+    }
+
+    ctk::ConstMultiplier<int32_t, int32_t, 4> constMultiplier{this, "constMultiplier", "", 2};
+    ctk::Multiplier<int32_t, int32_t, 1> multiplier{this, "multiplier", ""};
+
+    ctk::ControlSystemModule cs;
+};
+
+/*********************************************************************************************************************/
+/* test that chains are fused and compute the same results as the individual modules */
+
+BOOST_AUTO_TEST_CASE( testFusedChains ) {
+  std::cout << "*********************************************************************************************************************" << std::endl;
+  std::cout << "==> testFusedChains" << std::endl;
+
+  TestApplication app;
+  ctk::TestFacility test;
+  test.runApplication();
+
+  BOOST_CHECK(app.constMultiplier.hasBeenEliminated());
+  BOOST_CHECK(app.multiplier.hasBeenEliminated());
+  BOOST_CHECK(app.scalarMultiplier.hasBeenEliminated());
+  BOOST_CHECK(app.limit.hasBeenEliminated());
+  BOOST_CHECK(!app.unfused1.hasBeenEliminated());
+  BOOST_CHECK(!app.unfused2.hasBeenEliminated());
+
+  // array chain: intermediate values are doubles, the result is rounded
+  test.writeArray<int32_t>("in", {1, 2, 3, -4});
+  test.writeScalar<double>("factor", 0.5);
+  test.stepApplication();
+  BOOST_CHECK(test.readArray<int32_t>("out") == std::vector<int32_t>({1, 3, 4, -5}));
+
+  test.writeScalar<double>("factor", 2.);
+  test.stepApplication();
+  BOOST_CHECK(test.readArray<int32_t>("out") == std::vector<int32_t>({5, 10, 15, -20}));
+
+  // scalar chain with limit
+  test.writeScalar<int32_t>("min", -10);
+  test.writeScalar<int32_t>("max", 10);
+  test.writeScalar<int32_t>("scalarIn", 2);
+  test.stepApplication();
+  BOOST_CHECK_EQUAL(test.readScalar<int32_t>("limited"), 6);
+  BOOST_CHECK_EQUAL(test.readScalar<int>("isLimited"), 0);
+
+  test.writeScalar<int32_t>("scalarIn", 5);
+  test.stepApplication();
+  BOOST_CHECK_EQUAL(test.readScalar<int32_t>("limited"), 10);
+  BOOST_CHECK_EQUAL(test.readScalar<int>("isLimited"), 1);
+
+  test.writeScalar<int32_t>("max", 20);
+  test.stepApplication();
+  BOOST_CHECK_EQUAL(test.readScalar<int32_t>("limited"), 15);
+  BOOST_CHECK_EQUAL(test.readScalar<int>("isLimited"), 0);
+
+  // long array chain
+  BOOST_CHECK(app.longMultiplier1.hasBeenEliminated());
+  std::vector<int16_t> longIn(2500);
+  std::vector<int32_t> longExpected(2500);
+  for(size_t i=0; i<longIn.size(); ++i) {
+    longIn[i] = int16_t(i) - 1250;
+    float intermediate = longIn[i] * 1.5;
+    longExpected[i] = std::round(intermediate * 3.1);
+  }
+  test.writeArray<int16_t>("longIn", longIn);
+  test.stepApplication();
+  BOOST_CHECK(test.readArray<int32_t>("longOut") == longExpected);
+
+  // unfused modules still work as before
+  test.writeScalar<int32_t>("unfusedIn", 7);
+  test.stepApplication();
+  BOOST_CHECK_EQUAL(test.readScalar<int32_t>("unfusedIntermediate"), 14);
+  BOOST_CHECK_EQUAL(test.readScalar<int32_t>("unfusedOut"), 42);
+}
+
+/*********************************************************************************************************************/
+/* test that stages with different lengths are not fused but the network is rejected */
+
+BOOST_AUTO_TEST_CASE( testLengthMismatch ) {
+  std::cout << "*********************************************************************************************************************" << std::endl;
+  std::cout << "==> testLengthMismatch" << std::endl;
+
+  LengthMismatchApplication app;
+  try {
+    app.initialise();
+    BOOST_ERROR("Exception expected.");
+  }
+  catch(ctk::ApplicationExceptionWithID<ctk::ApplicationExceptionID::illegalVariableNetwork> &e) {
+    BOOST_CHECK_NO_THROW( e.what(); );
+  }
+  BOOST_CHECK(!app.constMultiplier.hasBeenEliminated());
+  BOOST_CHECK(!app.multiplier.hasBeenEliminated());
+}
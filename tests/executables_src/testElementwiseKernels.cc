@@ -0,0 +1,106 @@
+/*
+ * testElementwiseKernels.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#define BOOST_TEST_MODULE testElementwiseKernels
+
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/test_case_template.hpp>
+#include <boost/mpl/list.hpp>
+
+#include "ElementwiseKernels.h"
+
+using namespace boost::unit_test_framework;
+namespace kernels = ChimeraTK::ElementwiseKernels;
+
+// list of user types the kernels are tested with (as input type, all output types are tested for each). The 64 bit
+// types have no vectorised kernels, this checks that they are correctly dispatched to the plain loop.
+typedef boost::mpl::list<int8_t,uint8_t,
+                         int16_t,uint16_t,
+                         int32_t,uint32_t,
+                         int64_t,uint64_t,
+                         float,double>        test_types;
+
+/*********************************************************************************************************************/
+
+/* compare the kernels with the plain loop for the given types, for all available instruction sets */
+template<typename InputType, typename OutputType>
+void compareWithPlainLoop() {
+  // values inside the range of both types (also after scaling), including fractions of exactly 0.5
+  bool bothSigned = std::is_signed<InputType>::value && std::is_signed<OutputType>::value;
+  std::vector<InputType> input;
+  for(size_t i=0; i<37; ++i) {
+    double value = (i % 25) * 2 + (std::is_floating_point<InputType>::value ? 0.5 : 1.);
+    if(bothSigned && i % 3 == 0) value = -value;
+    input.push_back(value);
+  }
+
+  for(auto set : {kernels::InstructionSet::scalar, kernels::InstructionSet::sse41, kernels::InstructionSet::avx2}) {
+    kernels::setInstructionSet(set);
+    for(double parameter : {0.5, 1.5, 2.5}) {
+      // all lengths up to the full array, to cover the tail handling
+      for(size_t n=0; n<=input.size(); ++n) {
+        std::vector<OutputType> result(n), expected(n);
+        kernels::multiply(input.data(), result.data(), n, parameter);
+        kernels::detail::multiplyScalar(input.data(), expected.data(), n, parameter);
+        BOOST_CHECK(result == expected);
+
+        kernels::divide(input.data(), result.data(), n, parameter);
+        kernels::detail::divideScalar(input.data(), expected.data(), n, parameter);
+        BOOST_CHECK(result == expected);
+      }
+    }
+  }
+  kernels::setInstructionSet(kernels::getSupportedInstructionSet());
+}
+
+/*********************************************************************************************************************/
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( testKernels, T, test_types ) {
+  std::cout << "*********************************************************************************************************************" << std::endl;
+  std::cout << "==> testKernels<" << typeid(T).name() << ">" << std::endl;
+
+  compareWithPlainLoop<T, int8_t>();
+  compareWithPlainLoop<T, uint8_t>();
+  compareWithPlainLoop<T, int16_t>();
+  compareWithPlainLoop<T, uint16_t>();
+  compareWithPlainLoop<T, int32_t>();
+  compareWithPlainLoop<T, uint32_t>();
+  compareWithPlainLoop<T, int64_t>();
+  compareWithPlainLoop<T, uint64_t>();
+  compareWithPlainLoop<T, float>();
+  compareWithPlainLoop<T, double>();
+}
+
+/*********************************************************************************************************************/
+/* check the rounding of the kernels in corner cases */
+
+BOOST_AUTO_TEST_CASE( testRounding ) {
+  std::cout << "*********************************************************************************************************************" << std::endl;
+  std::cout << "==> testRounding" << std::endl;
+
+  std::vector<double> input{0.5, -0.5, 1.5, -1.5, 2.5, -2.5, 0.49999999999999994, -0.49999999999999994,
+                            1e9+0.5, -1e9-0.5, 2147483647.4, -2147483648.4};
+  std::vector<int32_t> expected;
+  for(auto value : input) expected.push_back(std::round(value));
+
+  for(auto set : {kernels::InstructionSet::scalar, kernels::InstructionSet::sse41, kernels::InstructionSet::avx2}) {
+    kernels::setInstructionSet(set);
+    std::vector<int32_t> result(input.size());
+    kernels::multiply(input.data(), result.data(), input.size(), 1.);
+    BOOST_CHECK(result == expected);
+  }
+  kernels::setInstructionSet(kernels::getSupportedInstructionSet());
+
+  // full range of uint32
+  std::vector<uint32_t> unsignedInput{0, 1, 2147483647, 2147483648, 3000000000, 4294967295, 17, 42};
+  for(auto set : {kernels::InstructionSet::scalar, kernels::InstructionSet::sse41, kernels::InstructionSet::avx2}) {
+    kernels::setInstructionSet(set);
+    std::vector<uint32_t> result(unsignedInput.size());
+    kernels::multiply(unsignedInput.data(), result.data(), unsignedInput.size(), 1.);
+    BOOST_CHECK(result == unsignedInput);
+  }
+  kernels::setInstructionSet(kernels::getSupportedInstructionSet());
+}
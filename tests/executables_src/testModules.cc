@@ -598,6 +598,38 @@ BOOST_AUTO_TEST_CASE( testApplicationModuleSubscriptOp ) {
 
 }
 
+/*********************************************************************************************************************/
+/* test that the name lookup in VirtualModules still works after copying and moving them */
+
+BOOST_AUTO_TEST_CASE( testVirtualModuleLookup ) {
+  std::cout << "*********************************************************************************************************************" << std::endl;
+  std::cout << "==> testVirtualModuleLookup" << std::endl;
+
+  OneModuleApp app;
+
+  ctk::VirtualModule copied = app.testModule.findTag(".*");
+  ctk::VirtualModule moved{"moved", "", ctk::Module::ModuleType::Invalid};
+  moved = app.testModule.findTag(".*");
+  ctk::VirtualModule assigned{"assigned", "", ctk::Module::ModuleType::Invalid};
+  assigned = copied;
+  ctk::VirtualModule constructed(std::move(moved));
+
+  for(ctk::VirtualModule *module : {&copied, &assigned, &constructed}) {
+    BOOST_CHECK( (*module)("nameOfSomeInput") == app.testModule.someInput );
+    BOOST_CHECK( (*module)["someGroup"]("inGroup") == app.testModule.someGroup.inGroup );
+    BOOST_CHECK( (*module)["anotherName"]("foo") == app.testModule.anotherGroup.foo );
+    BOOST_CHECK( module->getSubmoduleList().size() == 2 );
+    BOOST_CHECK( module->findVirtualSubmodule("someGroup") == &((*module)["someGroup"]) );
+    BOOST_CHECK( module->findVirtualSubmodule("notExisting") == nullptr );
+  }
+
+  // the moved-from module is empty
+  BOOST_CHECK( moved.getAccessorList().size() == 0 );
+  BOOST_CHECK( moved.getSubmoduleList().size() == 0 );
+  BOOST_CHECK( moved.findVirtualSubmodule("someGroup") == nullptr );
+
+}
+
 /*********************************************************************************************************************/
 /* test finding variables by tag */
 
@@ -717,6 +749,64 @@ BOOST_AUTO_TEST_CASE( testFindTags ) {
   }
 }
 
+/*********************************************************************************************************************/
+/* test combining tags with the operators of the tag query */
+
+BOOST_AUTO_TEST_CASE( testTagQuery ) {
+  std::cout << "*********************************************************************************************************************" << std::endl;
+  std::cout << "==> testTagQuery" << std::endl;
+
+  OneModuleApp app;
+
+  // same result as findTag("D").excludeTag("A")
+  {
+    ctk::VirtualModule tagDnotA = app.testModule.findTag("D & !A");
+    BOOST_CHECK( tagDnotA.getAccessorList().size() == 0 );
+    BOOST_CHECK( tagDnotA.getSubmoduleList().size() == 1 );
+    BOOST_CHECK( tagDnotA["anotherName"].getAccessorList().size() == 1 );
+    BOOST_CHECK( tagDnotA["anotherName"]("foo") == app.testModule.anotherGroup.foo );
+  }
+
+  // or and grouping
+  {
+    ctk::VirtualModule tagBorD = app.testModule.findTag("(B | D)");
+    BOOST_CHECK( tagBorD.getAccessorList().size() == 1 );
+    BOOST_CHECK( tagBorD("nameOfSomeInput") == app.testModule.someInput );
+    BOOST_CHECK( tagBorD.getSubmoduleList().size() == 2 );
+    BOOST_CHECK( tagBorD["someGroup"].getAccessorList().size() == 1 );
+    BOOST_CHECK( tagBorD["someGroup"]("alsoInGroup") == app.testModule.someGroup.alsoInGroup );
+    BOOST_CHECK( tagBorD["anotherName"]("foo") == app.testModule.anotherGroup.foo );
+  }
+
+  // regular expressions inside the query
+  {
+    ctk::VirtualModule tagC = app.testModule.findTag("[BC] & !B");
+    BOOST_CHECK( tagC.getAccessorList().size() == 1 );
+    BOOST_CHECK( tagC("someOutput") == app.testModule.someOutput );
+    BOOST_CHECK( tagC.getSubmoduleList().size() == 1 );
+    BOOST_CHECK( tagC["someGroup"]("inGroup") == app.testModule.someGroup.inGroup );
+  }
+
+  // negated query
+  {
+    ctk::VirtualModule none = app.testModule.excludeTag("A | D");
+    BOOST_CHECK( none.getAccessorList().size() == 0 );
+    BOOST_CHECK( none.getSubmoduleList().size() == 0 );
+  }
+
+  // syntax errors
+  for(auto query : {"", "A &", "(A | B", "A B", "A)"}) {
+    try {
+      app.testModule.findTag(query);
+      BOOST_ERROR("Exception expected.");
+    }
+    catch(ctk::ApplicationExceptionWithID<ctk::ApplicationExceptionID::illegalParameter> &e) {
+      BOOST_CHECK_NO_THROW( e.what(); );
+    }
+  }
+
+}
+
 /*********************************************************************************************************************/
 /* test flatten() */
 
@@ -0,0 +1,164 @@
+/*
+ * testNetworkStatistics.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#define BOOST_TEST_MODULE testNetworkStatistics
+
+#include <sstream>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/ControlSystemPVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/DevicePVManager.h>
+
+#include "Application.h"
+#include "ScalarAccessor.h"
+#include "ApplicationModule.h"
+#include "ControlSystemModule.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+#define CHECK_TIMEOUT(condition, maxMilliseconds)                                                                   \
+    {                                                                                                               \
+      std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();                                  \
+      while(!(condition)) {                                                                                         \
+        bool timeout_reached = (std::chrono::steady_clock::now()-t0) > std::chrono::milliseconds(maxMilliseconds);  \
+        BOOST_CHECK( !timeout_reached );                                                                            \
+        if(timeout_reached) break;                                                                                  \
+        usleep(1000);                                                                                               \
+      }                                                                                                             \
+    }
+
+/*********************************************************************************************************************/
+/* the modules for the test. The accessors are used directly by the test, so the main loops do nothing. */
+
+struct ProducerModule : public ctk::ApplicationModule {
+    ProducerModule(EntityOwner *owner, const std::string &name, const std::unordered_set<std::string> &tags)
+    : ApplicationModule(owner, name, "The producing module"),
+      output(this, "value", "", "No comment.", tags) {}
+
+    ctk::ScalarOutput<int32_t> output;
+
+    void mainLoop() {}
+};
+
+struct ConsumerModule : public ctk::ApplicationModule {
+    using ctk::ApplicationModule::ApplicationModule;
+
+    ctk::ScalarPushInput<int32_t> input{this, "value", "", "No comment."};
+
+    void mainLoop() {}
+};
+
+/*********************************************************************************************************************/
+/* dummy application, optionally publishing the value also to the control system (which requires a FanOut) */
+
+struct TestApplication : public ctk::Application {
+    TestApplication(const std::unordered_set<std::string> &tags, bool publish=false)
+    : Application("testSuite"), producer(this, "producer", tags), publish(publish) {}
+    ~TestApplication() { shutdown(); }
+
+    void defineConnections() {
+      producer.output >> consumer.input;
+      if(publish) producer.output >> cs("value");
+    }
+
+    ProducerModule producer;
+    ConsumerModule consumer{this, "consumer", "The consuming module"};
+    ctk::ControlSystemModule cs;
+    bool publish;
+};
+
+/*********************************************************************************************************************/
+/* write the values 0 to nValues-1 */
+
+void writeValues(TestApplication &app, int32_t nValues) {
+  for(int32_t i=0; i<nValues; ++i) {
+    app.producer.output = i;
+    app.producer.output.write();
+  }
+}
+
+/*********************************************************************************************************************/
+/* test counting the updates, lost values and the queue fill level of a direct connection */
+
+BOOST_AUTO_TEST_CASE( testDirectConnection ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testDirectConnection" << std::endl;
+
+  TestApplication app({"queueDepth3", "queueDropNewest"});
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  app.run();
+  auto statistics = ctk::VariableNetworkNode(app.consumer.input).getOwner().getStatistics();
+
+  // 3 values fit into the queue, the others are lost
+  writeValues(app, 10);
+  auto snapshot = statistics->aggregate();
+  BOOST_CHECK_EQUAL(snapshot.updates, 10);
+  BOOST_CHECK_EQUAL(snapshot.dataLost, 7);
+  BOOST_CHECK_EQUAL(snapshot.queueFill, 3);
+  BOOST_CHECK_GT(snapshot.updateRate, 0.);
+
+  // the queue is emptied by the consumer
+  while(app.consumer.input.readNonBlocking()) {}
+  snapshot = statistics->aggregate();
+  BOOST_CHECK_EQUAL(snapshot.updates, 10);
+  BOOST_CHECK_EQUAL(snapshot.queueFill, 0);
+
+  // the statistics are also dumped
+  std::stringstream stream;
+  app.dumpStatistics(stream);
+  BOOST_CHECK(stream.str().find("/testSuite/producer/value: 10 updates") != std::string::npos);
+
+}
+
+/*********************************************************************************************************************/
+/* test counting each update of a network with a FanOut only once */
+
+BOOST_AUTO_TEST_CASE( testFanOut ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testFanOut" << std::endl;
+
+  TestApplication app({}, true);
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  app.run();
+
+  writeValues(app, 5);
+  auto snapshot = ctk::VariableNetworkNode(app.consumer.input).getOwner().getStatistics()->aggregate();
+  BOOST_CHECK_EQUAL(snapshot.updates, 5);
+  BOOST_CHECK_EQUAL(snapshot.queueFill, 0);
+
+}
+
+/*********************************************************************************************************************/
+/* test publishing the statistics to the control system */
+
+BOOST_AUTO_TEST_CASE( testStatisticsModule ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testStatisticsModule" << std::endl;
+
+  TestApplication app({"queueDepth3", "queueDropNewest"});
+  app.enableStatistics(std::chrono::milliseconds(10));
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  app.run();
+
+  writeValues(app, 4);
+  auto updates = pvManagers.first->getProcessArray<uint64_t>("/Statistics/testSuite/producer/value/updates");
+  auto dataLost = pvManagers.first->getProcessArray<uint64_t>("/Statistics/testSuite/producer/value/dataLost");
+  auto queueFill = pvManagers.first->getProcessArray<uint64_t>("/Statistics/testSuite/producer/value/queueFill");
+  BOOST_REQUIRE(updates && dataLost && queueFill);
+  CHECK_TIMEOUT( (updates->readLatest(), updates->accessData(0) == 4), 3000);
+  CHECK_TIMEOUT( (dataLost->readLatest(), dataLost->accessData(0) == 1), 3000);
+  CHECK_TIMEOUT( (queueFill->readLatest(), queueFill->accessData(0) == 3), 3000);
+
+}
@@ -0,0 +1,167 @@
+/*
+ * testPersistence.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#define BOOST_TEST_MODULE testPersistence
+
+#include <cstdio>
+#include <fstream>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/ControlSystemPVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/DevicePVManager.h>
+
+#include "Application.h"
+#include "ScalarAccessor.h"
+#include "ArrayAccessor.h"
+#include "ApplicationModule.h"
+#include "ControlSystemModule.h"
+#include "PersistenceManager.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+/* the ApplicationModule for the test */
+
+struct TestModule : public ctk::ApplicationModule {
+    using ctk::ApplicationModule::ApplicationModule;
+
+    ctk::ScalarPushInput<int32_t> setpoint{this, "setpoint", "", "No comment."};
+    ctk::ArrayPushInput<double> table{this, "table", "", 3, "No comment."};
+    ctk::ScalarOutput<int32_t> readback{this, "readback", "", "No comment."};
+
+    std::string internalState;
+
+    void mainLoop() {}
+};
+
+/*********************************************************************************************************************/
+/* dummy application */
+
+struct TestApplication : public ctk::Application {
+    TestApplication() : Application("testSuite") {}
+    ~TestApplication() { shutdown(); }
+
+    void defineConnections() {
+      cs("setpoint") >> testModule.setpoint;
+      cs("table") >> testModule.table;
+      testModule.readback >> cs("readback");
+    }
+
+    TestModule testModule{this, "TestModule", "The test module"};
+    ctk::ControlSystemModule cs;
+};
+
+/*********************************************************************************************************************/
+/* test restoring the control system inputs and module states after a restart */
+
+BOOST_AUTO_TEST_CASE( testSnapshotRestore ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testSnapshotRestore" << std::endl;
+
+  std::remove("testPersistence.snapshot");
+
+  // first run: no snapshot exists, set some values
+  {
+    TestApplication app;
+    auto pvManagers = ctk::createPVManager();
+    app.setPVManager(pvManagers.second);
+    app.enablePersistence("testPersistence.snapshot");
+    app.registerPersistentState("TestModule/internalState", [&app] { return app.testModule.internalState; },
+                                [&app](const std::string &value) { app.testModule.internalState = value; });
+    app.initialise();
+    app.run();
+
+    BOOST_CHECK_EQUAL(int32_t(app.testModule.setpoint), 0);
+
+    auto setpoint = pvManagers.first->getProcessArray<int32_t>("/setpoint");
+    setpoint->accessData(0) = 42;
+    setpoint->write();
+    app.testModule.setpoint.read();
+    BOOST_CHECK_EQUAL(int32_t(app.testModule.setpoint), 42);
+
+    auto table = pvManagers.first->getProcessArray<double>("/table");
+    table->accessChannel(0) = {1.5, 2.5, 3.5};
+    table->write();
+    app.testModule.table.read();
+
+    app.testModule.readback = 17;
+    app.testModule.readback.write();
+    app.testModule.internalState = "some state";
+  } // the final snapshot is written on shutdown
+
+  // second run: the values are restored before the modules start
+  {
+    TestApplication app;
+    auto pvManagers = ctk::createPVManager();
+    app.setPVManager(pvManagers.second);
+    app.enablePersistence("testPersistence.snapshot");
+    app.registerPersistentState("TestModule/internalState", [&app] { return app.testModule.internalState; },
+                                [&app](const std::string &value) { app.testModule.internalState = value; });
+    app.initialise();
+    app.run();
+
+    BOOST_CHECK_EQUAL(int32_t(app.testModule.setpoint), 42);
+    BOOST_CHECK_EQUAL(app.testModule.table[0], 1.5);
+    BOOST_CHECK_EQUAL(app.testModule.table[1], 2.5);
+    BOOST_CHECK_EQUAL(app.testModule.table[2], 3.5);
+    BOOST_CHECK_EQUAL(app.testModule.internalState, "some state");
+
+    // new values from the control system are received normally afterwards
+    auto setpoint = pvManagers.first->getProcessArray<int32_t>("/setpoint");
+    setpoint->accessData(0) = 43;
+    setpoint->write();
+    app.testModule.setpoint.read();
+    BOOST_CHECK_EQUAL(int32_t(app.testModule.setpoint), 43);
+  }
+
+  // third run: the last value has been persisted again
+  {
+    TestApplication app;
+    auto pvManagers = ctk::createPVManager();
+    app.setPVManager(pvManagers.second);
+    app.enablePersistence("testPersistence.snapshot");
+    app.initialise();
+    app.run();
+
+    BOOST_CHECK_EQUAL(int32_t(app.testModule.setpoint), 43);
+    BOOST_CHECK_EQUAL(app.testModule.table[2], 3.5);
+  }
+
+}
+
+/*********************************************************************************************************************/
+/* test that a malformed snapshot does not prevent the start */
+
+BOOST_AUTO_TEST_CASE( testMalformedSnapshot ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testMalformedSnapshot" << std::endl;
+
+  {
+    std::ofstream file("testPersistence.snapshot", std::ios_base::binary | std::ios_base::trunc);
+    file << ctk::PersistenceManager::magic << "garbage";
+  }
+
+  TestApplication app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.enablePersistence("testPersistence.snapshot");
+  app.initialise();
+  app.run();
+  BOOST_CHECK_EQUAL(int32_t(app.testModule.setpoint), 0);
+
+  // an illegal interval is rejected
+  try {
+    ctk::PersistenceManager manager("testPersistence.snapshot", std::chrono::milliseconds(0));
+    BOOST_ERROR("Exception expected.");
+  }
+  catch(ctk::ApplicationExceptionWithID<ctk::ApplicationExceptionID::illegalParameter> &e) {
+    BOOST_CHECK_NO_THROW( e.what(); );
+  }
+
+}
@@ -0,0 +1,148 @@
+/*
+ * testPipe.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#define BOOST_TEST_MODULE testPipe
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <mtca4u/BackendFactory.h>
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "ControlSystemModule.h"
+#include "DeviceModule.h"
+#include "ScalarAccessor.h"
+#include "TestFacility.h"
+#include "Pipe.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+/* module doubling its input, used as a consumer of a pipe */
+
+struct DoublerModule : public ctk::ApplicationModule {
+    using ctk::ApplicationModule::ApplicationModule;
+
+    ctk::ScalarPushInput<int32_t> input{this, "input", "", "Input"};
+    ctk::ScalarOutput<int32_t> output{this, "output", "", "Input times two"};
+
+    void mainLoop() {
+      while(true) {
+        input.read();
+        output = 2*input;
+        output.write();
+      }
+    }
+};
+
+/*********************************************************************************************************************/
+/* dummy application */
+
+struct TestApplication : public ctk::Application {
+    TestApplication() : Application("testApplication") {}
+    ~TestApplication() { shutdown(); }
+
+    void defineConnections() {
+      // a single pipe feeding a control system variable and an application module
+      cs("in") >> pipe.input;
+      pipe.output >> cs("out") >> doubler.input;
+      doubler.output >> cs("doubled");
+
+      // a chain of pipes
+      cs("chainIn") >> chain1.input;
+      chain1.output >> chain2.input;
+      chain2.output >> cs("chainOut");
+
+      // a pipe whose output is not connected cannot be eliminated
+      cs("unusedIn") >> unusedPipe.input;
+    }
+
+    ctk::ScalarPipe<int32_t> pipe{this, "pipeIn", "pipeOut", "V", "Some pipe"};
+    ctk::ScalarPipe<int32_t> chain1{this, "chain1In", "chain1Out", "V", "Some pipe chain"};
+    ctk::ScalarPipe<int32_t> chain2{this, "chain2In", "chain2Out", "V", "Some pipe chain"};
+    ctk::ScalarPipe<int32_t> unusedPipe{this, "unusedIn", "unusedOut", "V", "Some unused pipe"};
+    DoublerModule doubler{this, "doubler", "Some module"};
+    ctk::ControlSystemModule cs;
+};
+
+/*********************************************************************************************************************/
+/* module with a poll-type input, used to create an illegal network behind a pipe */
+
+struct PollConsumerModule : public ctk::ApplicationModule {
+    using ctk::ApplicationModule::ApplicationModule;
+
+    ctk::ScalarPollInput<int32_t> input{this, "input", "", "Input"};
+
+    void mainLoop() {}
+};
+
+/*********************************************************************************************************************/
+/* application with a poll-type device variable feeding the (push-type) input of a pipe */
+
+struct IllegalTestApplication : public ctk::Application {
+    IllegalTestApplication() : Application("testApplication") {}
+    ~IllegalTestApplication() { shutdown(); }
+
+    void defineConnections() {
+      dev("/MyModule/Variable") >> pipe.input;
+      pipe.output >> consumer.input;
+    }
+
+    ctk::ScalarPipe<int32_t> pipe{this, "pipeIn", "pipeOut", "", "Some pipe"};
+    PollConsumerModule consumer{this, "consumer", "Some module"};
+    ctk::DeviceModule dev{"Dummy0"};
+};
+
+/*********************************************************************************************************************/
+/* test that the pipes are eliminated and values are still passed through */
+
+BOOST_AUTO_TEST_CASE( testPipeElimination ) {
+  std::cout << "*********************************************************************************************************************" << std::endl;
+  std::cout << "==> testPipeElimination" << std::endl;
+
+  TestApplication app;
+  ctk::TestFacility test;
+  test.runApplication();
+
+  BOOST_CHECK(app.pipe.hasBeenEliminated());
+  BOOST_CHECK(app.chain1.hasBeenEliminated());
+  BOOST_CHECK(app.chain2.hasBeenEliminated());
+  BOOST_CHECK(!app.unusedPipe.hasBeenEliminated());
+  BOOST_CHECK(!app.doubler.hasBeenEliminated());
+
+  for(int32_t i=1; i<=3; ++i) {
+    test.writeScalar<int32_t>("in", 10*i);
+    test.stepApplication();
+    BOOST_CHECK_EQUAL(test.readScalar<int32_t>("out"), 10*i);
+    BOOST_CHECK_EQUAL(test.readScalar<int32_t>("doubled"), 20*i);
+
+    test.writeScalar<int32_t>("chainIn", 7*i);
+    test.stepApplication();
+    BOOST_CHECK_EQUAL(test.readScalar<int32_t>("chainOut"), 7*i);
+  }
+}
+
+/*********************************************************************************************************************/
+/* test that an illegal network is not made legal by eliminating the pipe (the spliced network would have a poll-type
+ * feeder with exactly one poll-type consumer) */
+
+BOOST_AUTO_TEST_CASE( testIllegalNetworkNotEliminated ) {
+  std::cout << "*********************************************************************************************************************" << std::endl;
+  std::cout << "==> testIllegalNetworkNotEliminated" << std::endl;
+
+  mtca4u::BackendFactory::getInstance().setDMapFilePath("dummy.dmap");
+  IllegalTestApplication app;
+
+  try {
+    app.initialise();
+    BOOST_ERROR("Exception expected.");
+  }
+  catch(ctk::ApplicationExceptionWithID<ctk::ApplicationExceptionID::illegalVariableNetwork> &e) {
+    BOOST_CHECK_NO_THROW( e.what(); );
+  }
+  BOOST_CHECK(!app.pipe.hasBeenEliminated());
+}
@@ -0,0 +1,200 @@
+/*
+ * testPollCache.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#define BOOST_TEST_MODULE testPollCache
+
+#include <sstream>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <mtca4u/BackendFactory.h>
+#include <mtca4u/Device.h>
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/ControlSystemPVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/DevicePVManager.h>
+
+#include "Application.h"
+#include "ScalarAccessor.h"
+#include "ApplicationModule.h"
+#include "DeviceModule.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+#define CHECK_TIMEOUT(condition, maxMilliseconds)                                                                   \
+    {                                                                                                               \
+      std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();                                  \
+      while(!(condition)) {                                                                                         \
+        bool timeout_reached = (std::chrono::steady_clock::now()-t0) > std::chrono::milliseconds(maxMilliseconds);  \
+        BOOST_CHECK( !timeout_reached );                                                                            \
+        if(timeout_reached) break;                                                                                  \
+        usleep(1000);                                                                                               \
+      }                                                                                                             \
+    }
+
+/*********************************************************************************************************************/
+/* the module for the test, polling a device register from the test thread */
+
+struct TestModule : public ctk::ApplicationModule {
+    using ctk::ApplicationModule::ApplicationModule;
+
+    ctk::ScalarPollInput<int32_t> input{this, "input", "", "No comment."};
+
+    void mainLoop() {}
+};
+
+/*********************************************************************************************************************/
+/* dummy application with two modules polling the same register */
+
+struct TestApplication : public ctk::Application {
+    TestApplication() : Application("testSuite") {
+      mtca4u::BackendFactory::getInstance().setDMapFilePath("test.dmap");
+    }
+    ~TestApplication() { shutdown(); }
+
+    void defineConnections() {
+      dev("/MyModule/readBack") >> moduleA.input;
+      dev("/MyModule/readBack") >> moduleB.input;
+    }
+
+    TestModule moduleA{this, "moduleA", "The first test module"};
+    TestModule moduleB{this, "moduleB", "The second test module"};
+    ctk::DeviceModule dev{"Dummy0"};
+};
+
+/*********************************************************************************************************************/
+/* test sharing the polled value within the maximum age */
+
+BOOST_AUTO_TEST_CASE( testCacheHits ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testCacheHits" << std::endl;
+
+  TestApplication app;
+  app.enablePollCache("Dummy0", std::chrono::seconds(60));
+  app.enableStatistics(std::chrono::milliseconds(10));
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  app.run();
+
+  mtca4u::Device dev;
+  dev.open("Dummy0");
+  dev.write<int32_t>("/MyModule/actuator", 42);
+
+  // the first poll reads from the device
+  app.moduleA.input.read();
+  BOOST_CHECK_EQUAL(int32_t(app.moduleA.input), 42);
+
+  // the second poll is served from the cache, even by the other module
+  dev.write<int32_t>("/MyModule/actuator", 43);
+  app.moduleB.input.read();
+  BOOST_CHECK_EQUAL(int32_t(app.moduleB.input), 42);
+  app.moduleA.input.readLatest();
+  BOOST_CHECK_EQUAL(int32_t(app.moduleA.input), 42);
+
+  // the counters are published as statistics
+  auto hits = pvManagers.first->getProcessArray<uint64_t>("/Statistics/Device/Dummy0/MyModule/readBack/cacheHits");
+  auto misses = pvManagers.first->getProcessArray<uint64_t>(
+      "/Statistics/Device/Dummy0/MyModule/readBack/cacheMisses");
+  BOOST_REQUIRE(hits != nullptr);
+  BOOST_REQUIRE(misses != nullptr);
+  CHECK_TIMEOUT( (hits->readLatest(), hits->accessData(0) == 2), 3000);
+  misses->readLatest();
+  BOOST_CHECK_EQUAL(misses->accessData(0), 1);
+
+  std::stringstream statistics;
+  app.dumpStatistics(statistics);
+  BOOST_CHECK(statistics.str().find("2 cache hits, 1 cache misses") != std::string::npos);
+
+}
+
+/*********************************************************************************************************************/
+/* test reading from the device again after the maximum age, with a register-specific setting */
+
+BOOST_AUTO_TEST_CASE( testMaxAge ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testMaxAge" << std::endl;
+
+  TestApplication app;
+  app.enablePollCache("Dummy0", std::chrono::seconds(60));
+  app.enablePollCache("Dummy0", std::chrono::milliseconds(0), "/MyModule/readBack");
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  app.run();
+
+  mtca4u::Device dev;
+  dev.open("Dummy0");
+
+  // the register-specific maximum age of 0 takes precedence, so each poll reads from the device
+  dev.write<int32_t>("/MyModule/actuator", 10);
+  app.moduleA.input.read();
+  BOOST_CHECK_EQUAL(int32_t(app.moduleA.input), 10);
+  usleep(1000);
+  dev.write<int32_t>("/MyModule/actuator", 11);
+  app.moduleB.input.read();
+  BOOST_CHECK_EQUAL(int32_t(app.moduleB.input), 11);
+
+  std::stringstream statistics;
+  app.dumpStatistics(statistics);
+  BOOST_CHECK(statistics.str().find("0 cache hits, 2 cache misses") != std::string::npos);
+
+}
+
+/*********************************************************************************************************************/
+/* dummy application polling a register and distributing it to a push-type consumer as well */
+
+struct PushModule : public ctk::ApplicationModule {
+    using ctk::ApplicationModule::ApplicationModule;
+
+    ctk::ScalarPushInput<int32_t> input{this, "input", "", "No comment."};
+
+    void mainLoop() {}
+};
+
+struct MixedApplication : public ctk::Application {
+    MixedApplication() : Application("testSuite") {
+      mtca4u::BackendFactory::getInstance().setDMapFilePath("test.dmap");
+    }
+    ~MixedApplication() { shutdown(); }
+
+    void defineConnections() {
+      dev("/MyModule/readBack") >> pollModule.input;
+      dev("/MyModule/readBack") >> pushModule.input;
+    }
+
+    TestModule pollModule{this, "pollModule", "The polling test module"};
+    PushModule pushModule{this, "pushModule", "The pushing test module"};
+    ctk::DeviceModule dev{"Dummy0"};
+};
+
+/*********************************************************************************************************************/
+/* test that networks without the cache are still merged, so the polling consumer triggers the push-type consumer */
+
+BOOST_AUTO_TEST_CASE( testMixedConsumers ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testMixedConsumers" << std::endl;
+
+  MixedApplication app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  app.run();
+
+  mtca4u::Device dev;
+  dev.open("Dummy0");
+
+  dev.write<int32_t>("/MyModule/actuator", 20);
+  app.pollModule.input.read();
+  BOOST_CHECK_EQUAL(int32_t(app.pollModule.input), 20);
+  CHECK_TIMEOUT( app.pushModule.input.readNonBlocking(), 3000);
+  BOOST_CHECK_EQUAL(int32_t(app.pushModule.input), 20);
+
+  std::stringstream statistics;
+  app.dumpStatistics(statistics);
+  BOOST_CHECK(statistics.str().find("cache hits") == std::string::npos);
+
+}
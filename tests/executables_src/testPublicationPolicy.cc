@@ -0,0 +1,150 @@
+/*
+ * testPublicationPolicy.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#define BOOST_TEST_MODULE testPublicationPolicy
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <mtca4u/BackendFactory.h>
+#include <mtca4u/Device.h>
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/ControlSystemPVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/DevicePVManager.h>
+
+#include "Application.h"
+#include "ScalarAccessor.h"
+#include "ApplicationModule.h"
+#include "ControlSystemModule.h"
+#include "DeviceModule.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+#define CHECK_TIMEOUT(condition, maxMilliseconds)                                                                   \
+    {                                                                                                               \
+      std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();                                  \
+      while(!(condition)) {                                                                                         \
+        bool timeout_reached = (std::chrono::steady_clock::now()-t0) > std::chrono::milliseconds(maxMilliseconds);  \
+        BOOST_CHECK( !timeout_reached );                                                                            \
+        if(timeout_reached) break;                                                                                  \
+        usleep(1000);                                                                                               \
+      }                                                                                                             \
+    }
+
+/*********************************************************************************************************************/
+/* dummy application */
+
+struct TestApplication : public ctk::Application {
+    TestApplication() : Application("testSuite") {
+      mtca4u::BackendFactory::getInstance().setDMapFilePath("test.dmap");
+    }
+    ~TestApplication() { shutdown(); }
+
+    void defineConnections() {}             // the setup is done in the tests
+
+    ctk::ControlSystemModule cs;
+    ctk::DeviceModule dev{"Dummy0"};
+};
+
+/*********************************************************************************************************************/
+/* test coalescing fast updates to a maximum rate */
+
+BOOST_AUTO_TEST_CASE( testMaxRate ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testMaxRate" << std::endl;
+
+  TestApplication app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+
+  auto node = app.cs("feeder", typeid(int32_t), 1) >> app.dev("/MyModule/actuator");
+  ctk::PublicationPolicy policy;
+  policy.maxRate = 2.;
+  node.getOwner().setPublicationPolicy(policy);
+  auto &network = node.getOwner();
+  app.initialise();
+  app.run();
+
+  mtca4u::Device dev;
+  dev.open("Dummy0");
+
+  // the first value is sent immediately
+  auto feeder = pvManagers.first->getProcessArray<int32_t>("/feeder");
+  feeder->accessData(0) = 1;
+  feeder->write();
+  CHECK_TIMEOUT( dev.read<int32_t>("/MyModule/actuator") == 1, 3000);
+
+  // further values within the minimum interval are coalesced to the latest one, which is sent after the interval
+  for(int32_t i=2; i<=10; ++i) {
+    feeder->accessData(0) = i;
+    feeder->write();
+  }
+  usleep(100000);
+  BOOST_CHECK(dev.read<int32_t>("/MyModule/actuator") != 10);
+  CHECK_TIMEOUT( dev.read<int32_t>("/MyModule/actuator") == 10, 3000);
+  // values may also be lost in the queue of the feeder, so not all of them are counted by the policy
+  CHECK_TIMEOUT( network.getNumberOfDroppedUpdates() >= 1, 3000);
+  BOOST_CHECK_EQUAL(dev.read<int32_t>("/MyModule/actuator"), 10);
+
+}
+
+/*********************************************************************************************************************/
+/* test sending only values outside the deadband, with the policy given by tags */
+
+BOOST_AUTO_TEST_CASE( testDeadband ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testDeadband" << std::endl;
+
+  TestApplication app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+
+  auto feederNode = app.cs("feeder", typeid(int32_t), 1);
+  feederNode.addTag("publishDeadband1");
+  feederNode >> app.dev("/MyModule/actuator");
+  auto &network = feederNode.getOwner();
+  BOOST_CHECK_EQUAL(network.getPublicationPolicy().deadband, 1.);
+  BOOST_CHECK_EQUAL(network.getPublicationPolicy().maxRate, 0.);
+  app.initialise();
+  app.run();
+
+  mtca4u::Device dev;
+  dev.open("Dummy0");
+
+  auto feeder = pvManagers.first->getProcessArray<int32_t>("/feeder");
+  feeder->accessData(0) = 10;
+  feeder->write();
+  CHECK_TIMEOUT( dev.read<int32_t>("/MyModule/actuator") == 10, 3000);
+
+  // a change by the deadband is not sent
+  feeder->accessData(0) = 11;
+  feeder->write();
+  CHECK_TIMEOUT( network.getNumberOfDroppedUpdates() == 1, 3000);
+  BOOST_CHECK_EQUAL(dev.read<int32_t>("/MyModule/actuator"), 10);
+
+  // a larger change is sent, compared against the last value sent
+  feeder->accessData(0) = 12;
+  feeder->write();
+  CHECK_TIMEOUT( dev.read<int32_t>("/MyModule/actuator") == 12, 3000);
+  BOOST_CHECK_EQUAL(network.getNumberOfDroppedUpdates(), 1);
+
+}
+
+/*********************************************************************************************************************/
+/* test illegal tags */
+
+BOOST_AUTO_TEST_CASE( testIllegalTags ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testIllegalTags" << std::endl;
+
+  TestApplication app;
+  auto feederNode = app.cs("feeder", typeid(int32_t), 1);
+  feederNode.addTag("publishMaxRateFast");
+  feederNode >> app.dev("/MyModule/actuator");
+  BOOST_CHECK_THROW(feederNode.getOwner().getPublicationPolicy(),
+                    ctk::ApplicationExceptionWithID<ctk::ApplicationExceptionID::illegalParameter>);
+
+}
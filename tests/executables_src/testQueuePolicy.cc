@@ -0,0 +1,180 @@
+/*
+ * testQueuePolicy.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#define BOOST_TEST_MODULE testQueuePolicy
+
+#include <atomic>
+#include <thread>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/ControlSystemPVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/DevicePVManager.h>
+
+#include "Application.h"
+#include "ScalarAccessor.h"
+#include "ApplicationModule.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+/* the modules for the test. The accessors are used directly by the test, so the main loops do nothing. */
+
+struct ProducerModule : public ctk::ApplicationModule {
+    ProducerModule(EntityOwner *owner, const std::string &name, const std::unordered_set<std::string> &tags)
+    : ApplicationModule(owner, name, "The producing module"),
+      output(this, "value", "", "No comment.", tags) {}
+
+    ctk::ScalarOutput<int32_t> output;
+
+    void mainLoop() {}
+};
+
+struct ConsumerModule : public ctk::ApplicationModule {
+    using ctk::ApplicationModule::ApplicationModule;
+
+    ctk::ScalarPushInput<int32_t> input{this, "value", "", "No comment."};
+
+    void mainLoop() {}
+};
+
+/*********************************************************************************************************************/
+/* dummy application */
+
+struct TestApplication : public ctk::Application {
+    TestApplication(const std::unordered_set<std::string> &tags)
+    : Application("testSuite"), producer(this, "producer", tags) {}
+    ~TestApplication() { shutdown(); }
+
+    void defineConnections() {
+      producer.output >> consumer.input;
+    }
+
+    ProducerModule producer;
+    ConsumerModule consumer{this, "consumer", "The consuming module"};
+};
+
+/*********************************************************************************************************************/
+/* write the values 0 to nValues-1 */
+
+void writeValues(TestApplication &app, int32_t nValues) {
+  for(int32_t i=0; i<nValues; ++i) {
+    app.producer.output = i;
+    app.producer.output.write();
+  }
+}
+
+/*********************************************************************************************************************/
+/* test parsing the tags */
+
+BOOST_AUTO_TEST_CASE( testTags ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testTags" << std::endl;
+
+  {
+    TestApplication app({"queueDepth3", "queueDropNewest"});
+    auto pvManagers = ctk::createPVManager();
+    app.setPVManager(pvManagers.second);
+    app.initialise();
+    auto policy = ctk::VariableNetworkNode(app.consumer.input).getOwner().getQueuePolicy();
+    BOOST_CHECK_EQUAL(policy.depth, 3);
+    BOOST_CHECK(policy.overflow == ctk::QueuePolicy::Overflow::dropNewest);
+    BOOST_CHECK(policy.isEnabled());
+  }
+
+  for(auto tags : std::vector<std::unordered_set<std::string>>{{"queueDepth0"}, {"queueDepthX"},
+                                                               {"queueDropNewest", "queueBlock"}}) {
+    TestApplication app(tags);
+    auto pvManagers = ctk::createPVManager();
+    app.setPVManager(pvManagers.second);
+    BOOST_CHECK_THROW(app.initialise(),
+                      ctk::ApplicationExceptionWithID<ctk::ApplicationExceptionID::illegalParameter>);
+  }
+
+}
+
+/*********************************************************************************************************************/
+/* test keeping only the latest value */
+
+BOOST_AUTO_TEST_CASE( testLatestValueOnly ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testLatestValueOnly" << std::endl;
+
+  TestApplication app({"queueDepth1", "queueDropOldest"});
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  app.run();
+
+  writeValues(app, 10);
+  BOOST_CHECK(app.consumer.input.readNonBlocking());
+  BOOST_CHECK_EQUAL(int32_t(app.consumer.input), 9);
+  BOOST_CHECK(!app.consumer.input.readNonBlocking());
+
+}
+
+/*********************************************************************************************************************/
+/* test discarding new values if the queue is full */
+
+BOOST_AUTO_TEST_CASE( testDropNewest ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testDropNewest" << std::endl;
+
+  TestApplication app({"queueDepth3", "queueDropNewest"});
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  app.run();
+
+  writeValues(app, 10);
+  for(int32_t i=0; i<3; ++i) {
+    BOOST_CHECK(app.consumer.input.readNonBlocking());
+    BOOST_CHECK_EQUAL(int32_t(app.consumer.input), i);
+  }
+  BOOST_CHECK(!app.consumer.input.readNonBlocking());
+
+  // the queue accepts new values again
+  writeValues(app, 1);
+  BOOST_CHECK(app.consumer.input.readNonBlocking());
+  BOOST_CHECK_EQUAL(int32_t(app.consumer.input), 0);
+
+}
+
+/*********************************************************************************************************************/
+/* test blocking the sender if the queue is full */
+
+BOOST_AUTO_TEST_CASE( testBlock ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testBlock" << std::endl;
+
+  TestApplication app({"queueDepth3", "queueBlock"});
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  app.run();
+
+  std::atomic<bool> done{false};
+  std::thread sender([&app, &done] {
+    writeValues(app, 10);
+    done = true;
+  });
+
+  // the sender blocks when the queue is full
+  usleep(100000);
+  BOOST_CHECK(!done);
+
+  // all values are received in order
+  for(int32_t i=0; i<10; ++i) {
+    app.consumer.input.read();
+    BOOST_CHECK_EQUAL(int32_t(app.consumer.input), i);
+  }
+  sender.join();
+  BOOST_CHECK(done);
+  BOOST_CHECK(!app.consumer.input.readNonBlocking());
+
+}
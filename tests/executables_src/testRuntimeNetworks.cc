@@ -0,0 +1,176 @@
+/*
+ * testRuntimeNetworks.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#define BOOST_TEST_MODULE testRuntimeNetworks
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <mtca4u/BackendFactory.h>
+#include <mtca4u/Device.h>
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/ControlSystemPVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/DevicePVManager.h>
+
+#include "Application.h"
+#include "ScalarAccessor.h"
+#include "ApplicationModule.h"
+#include "ControlSystemModule.h"
+#include "DeviceModule.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+#define CHECK_TIMEOUT(condition, maxMilliseconds)                                                                   \
+    {                                                                                                               \
+      std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();                                  \
+      while(!(condition)) {                                                                                         \
+        bool timeout_reached = (std::chrono::steady_clock::now()-t0) > std::chrono::milliseconds(maxMilliseconds);  \
+        BOOST_CHECK( !timeout_reached );                                                                            \
+        if(timeout_reached) break;                                                                                  \
+        usleep(1000);                                                                                               \
+      }                                                                                                             \
+    }
+
+/*********************************************************************************************************************/
+/* the ApplicationModule for the test */
+
+struct TestModule : public ctk::ApplicationModule {
+    using ctk::ApplicationModule::ApplicationModule;
+
+    ctk::ScalarPushInput<int32_t> consumer{this, "consumer", "", "No comment."};
+
+    void mainLoop() {}
+};
+
+/*********************************************************************************************************************/
+/* dummy application */
+
+struct TestApplication : public ctk::Application {
+    TestApplication() : Application("testSuite") {
+      mtca4u::BackendFactory::getInstance().setDMapFilePath("test.dmap");
+    }
+    ~TestApplication() { shutdown(); }
+
+    using Application::deviceMap;           // expose the device map to check reusing the devices
+    using Application::networkList;         // expose network list to check removing networks
+    using Application::internalModuleList;  // expose the FanOuts to check removing them
+    void defineConnections() {}             // the setup is done in the tests
+
+    TestModule testModule{this, "TestModule", "The test module"};
+    ctk::ControlSystemModule cs;
+
+    ctk::DeviceModule dev{"Dummy0"};
+};
+
+/*********************************************************************************************************************/
+/* test adding and removing a control system to device connection on the running application */
+
+BOOST_AUTO_TEST_CASE( testAddRemoveNetwork ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testAddRemoveNetwork" << std::endl;
+
+  TestApplication app;
+
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+
+  app.cs("initialFeeder", typeid(int32_t), 1) >> app.dev("/MyModule/actuator");
+  app.initialise();
+  app.run();
+  BOOST_CHECK_EQUAL(app.deviceMap.size(), 1);
+  auto nNetworks = app.networkList.size();
+  auto nInternalModules = app.internalModuleList.size();
+
+  mtca4u::Device dev;
+  dev.open("Dummy0");
+
+  // add a second connection to the same device while running
+  auto &network = app.addNetwork(app.cs("runtimeFeeder", typeid(int32_t), 1), {app.dev("/MyModule/readBack")});
+  BOOST_CHECK(network.isCreated());
+  BOOST_CHECK_EQUAL(app.deviceMap.size(), 1);
+  BOOST_CHECK_EQUAL(app.networkList.size(), nNetworks+1);
+  BOOST_CHECK_EQUAL(app.internalModuleList.size(), nInternalModules+1);
+
+  auto runtimeFeeder = pvManagers.first->getProcessArray<int32_t>("/runtimeFeeder");
+  runtimeFeeder->accessData(0) = 42;
+  runtimeFeeder->write();
+  CHECK_TIMEOUT( dev.read<int32_t>("/MyModule/readBack") == 42, 3000);
+
+  // remove the connection again: further values must no longer arrive at the device
+  app.removeNetwork(network);
+  BOOST_CHECK_EQUAL(app.deviceMap.size(), 1);
+  BOOST_CHECK_EQUAL(app.networkList.size(), nNetworks);
+  BOOST_CHECK_EQUAL(app.internalModuleList.size(), nInternalModules);
+
+  runtimeFeeder->accessData(0) = 43;
+  runtimeFeeder->write();
+  usleep(100000);
+  BOOST_CHECK_EQUAL(dev.read<int32_t>("/MyModule/readBack"), 42);
+
+  // the connections made in initialise() are still working
+  auto initialFeeder = pvManagers.first->getProcessArray<int32_t>("/initialFeeder");
+  initialFeeder->accessData(0) = 120;
+  initialFeeder->write();
+  CHECK_TIMEOUT( dev.read<int32_t>("/MyModule/actuator") == 120, 3000);
+
+  // the device node is released and can be connected again
+  app.addNetwork(app.cs("secondRuntimeFeeder", typeid(int32_t), 1), {app.dev("/MyModule/readBack")});
+  auto secondRuntimeFeeder = pvManagers.first->getProcessArray<int32_t>("/secondRuntimeFeeder");
+  secondRuntimeFeeder->accessData(0) = 7;
+  secondRuntimeFeeder->write();
+  CHECK_TIMEOUT( dev.read<int32_t>("/MyModule/readBack") == 7, 3000);
+  BOOST_CHECK_EQUAL(app.deviceMap.size(), 1);
+
+}
+
+/*********************************************************************************************************************/
+/* test illegal runtime networks */
+
+BOOST_AUTO_TEST_CASE( testIllegalRuntimeNetworks ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testIllegalRuntimeNetworks" << std::endl;
+
+  TestApplication app;
+
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+
+  app.cs("consumer", typeid(int32_t), 1) >> app.testModule.consumer;
+  app.initialise();
+  app.run();
+  auto nNetworks = app.networkList.size();
+
+  // application nodes cannot be connected at runtime
+  try {
+    app.addNetwork(app.cs("feeder", typeid(int32_t), 1), {app.testModule.consumer});
+    BOOST_ERROR("Exception expected.");
+  }
+  catch(ctk::ApplicationExceptionWithID<ctk::ApplicationExceptionID::illegalParameter> &e) {
+    BOOST_CHECK_NO_THROW( e.what(); );
+  }
+
+  // networks without consumers are rejected
+  try {
+    app.addNetwork(app.cs("feeder", typeid(int32_t), 1), {});
+    BOOST_ERROR("Exception expected.");
+  }
+  catch(ctk::ApplicationExceptionWithID<ctk::ApplicationExceptionID::illegalParameter> &e) {
+    BOOST_CHECK_NO_THROW( e.what(); );
+  }
+
+  // networks made in initialise() cannot be removed
+  try {
+    app.removeNetwork(app.networkList.front());
+    BOOST_ERROR("Exception expected.");
+  }
+  catch(ctk::ApplicationExceptionWithID<ctk::ApplicationExceptionID::illegalParameter> &e) {
+    BOOST_CHECK_NO_THROW( e.what(); );
+  }
+
+  // failed attempts leave no networks behind
+  BOOST_CHECK_EQUAL(app.networkList.size(), nNetworks);
+
+}
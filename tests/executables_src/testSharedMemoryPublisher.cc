@@ -0,0 +1,162 @@
+/*
+ * testSharedMemoryPublisher.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#define BOOST_TEST_MODULE testSharedMemoryPublisher
+
+#include <algorithm>
+#include <thread>
+#include <atomic>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/ControlSystemPVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/DevicePVManager.h>
+
+#include "Application.h"
+#include "ScalarAccessor.h"
+#include "ArrayAccessor.h"
+#include "ApplicationModule.h"
+#include "ControlSystemModule.h"
+#include "SharedMemoryPublisher.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+/* the ApplicationModule for the test */
+
+struct TestModule : public ctk::ApplicationModule {
+    using ctk::ApplicationModule::ApplicationModule;
+
+    ctk::ScalarPushInput<int32_t> setpoint{this, "setpoint", "", "No comment."};
+    ctk::ArrayOutput<double> trace{this, "trace", "", 4, "No comment."};
+    ctk::ScalarOutput<std::string> status{this, "status", "", "No comment."};
+
+    void mainLoop() {}
+};
+
+/*********************************************************************************************************************/
+/* dummy application */
+
+struct TestApplication : public ctk::Application {
+    TestApplication() : Application("testSuite") {}
+    ~TestApplication() { shutdown(); }
+
+    void defineConnections() {
+      cs("setpoint") >> testModule.setpoint;
+      testModule.trace >> cs("trace");
+      testModule.status >> cs("status");
+    }
+
+    TestModule testModule{this, "TestModule", "The test module"};
+    ctk::ControlSystemModule cs;
+};
+
+/*********************************************************************************************************************/
+/* test publishing the control system variables of an application */
+
+BOOST_AUTO_TEST_CASE( testPublication ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testPublication" << std::endl;
+
+  TestApplication app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.enableSharedMemoryPublication("/testSharedMemoryPublisher", 1024*1024, 16, 8);
+  app.initialise();
+  app.run();
+
+  ctk::SharedMemoryReader reader("/testSharedMemoryPublisher");
+  auto variables = reader.getVariables();
+  BOOST_CHECK_EQUAL(variables.size(), 3);
+  BOOST_CHECK_EQUAL(variables[0].name, "/setpoint");
+  BOOST_CHECK_EQUAL(variables[0].typeName, "int32");
+  BOOST_CHECK_EQUAL(variables[2].name, "/trace");
+  BOOST_CHECK_EQUAL(variables[2].nElements, 4);
+
+  // no values have been sent yet
+  std::vector<int32_t> setpoint;
+  BOOST_CHECK(!reader.read("/setpoint", setpoint));
+  BOOST_CHECK(!reader.read("/notExisting", setpoint));
+
+  // inputs from the control system are published when received by the application
+  auto setpointPV = pvManagers.first->getProcessArray<int32_t>("/setpoint");
+  setpointPV->accessData(0) = 42;
+  setpointPV->write();
+  app.testModule.setpoint.read();
+  uint64_t updateCounter;
+  BOOST_CHECK(reader.read("/setpoint", setpoint, &updateCounter));
+  BOOST_CHECK_EQUAL(setpoint.size(), 1);
+  BOOST_CHECK_EQUAL(setpoint[0], 42);
+  BOOST_CHECK_EQUAL(updateCounter, 1);
+
+  // outputs of the application are published when written
+  std::vector<double> traceValues{1.5, 2.5, 3.5, 4.5};
+  app.testModule.trace = traceValues;
+  app.testModule.trace.write();
+  std::vector<double> trace;
+  BOOST_CHECK(reader.read("/trace", trace));
+  BOOST_CHECK(trace == traceValues);
+
+  // strings longer than the maximum length are dropped
+  app.testModule.status = "ok";
+  app.testModule.status.write();
+  app.testModule.status = "a much too long status";
+  app.testModule.status.write();
+  std::vector<std::string> status;
+  BOOST_CHECK(reader.read("/status", status));
+  BOOST_CHECK_EQUAL(status[0], "ok");
+  BOOST_CHECK_EQUAL(reader.getDroppedUpdates("/status"), 1);
+
+  // reading with the wrong type is rejected
+  std::vector<float> wrongType;
+  BOOST_CHECK_THROW(reader.read("/trace", wrongType),
+                    ctk::ApplicationExceptionWithID<ctk::ApplicationExceptionID::illegalParameter>);
+
+}
+
+/*********************************************************************************************************************/
+/* test that readers always obtain consistent values while the writer is updating them */
+
+BOOST_AUTO_TEST_CASE( testConsistency ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testConsistency" << std::endl;
+
+  ctk::SharedMemoryPublisher publisher("/testSharedMemoryConsistency", 1024*1024, 4, 16);
+  auto slot = publisher.addVariable<int64_t>("/array", 1000);
+
+  std::atomic<bool> stop{false};
+  std::thread writer([&] {
+    std::vector<int64_t> buffer(1000);
+    for(int64_t i=1; !stop; ++i) {
+      for(auto &value : buffer) value = i;
+      ctk::SharedMemoryPublisher::publish(slot, buffer);
+    }
+  });
+
+  ctk::SharedMemoryReader reader("/testSharedMemoryConsistency");
+  std::vector<int64_t> buffer;
+  uint64_t updateCounter, lastUpdateCounter = 0;
+  while(!reader.read("/array", buffer)) {}
+  for(size_t i=0; i<10000; ++i) {
+    BOOST_REQUIRE(reader.read("/array", buffer, &updateCounter));
+    BOOST_REQUIRE(std::all_of(buffer.begin(), buffer.end(), [&](int64_t value) { return value == buffer[0]; }));
+    BOOST_CHECK_GE(updateCounter, lastUpdateCounter);
+    lastUpdateCounter = updateCounter;
+  }
+  stop = true;
+  writer.join();
+
+  // the segment is full
+  BOOST_CHECK_THROW(publisher.addVariable<double>("/tooLarge", 1024*1024),
+                    ctk::ApplicationExceptionWithID<ctk::ApplicationExceptionID::illegalParameter>);
+
+  // segments not created by the publisher are rejected
+  BOOST_CHECK_THROW(ctk::SharedMemoryReader("/notExistingSegment"),
+                    ctk::ApplicationExceptionWithID<ctk::ApplicationExceptionID::illegalParameter>);
+
+}
@@ -0,0 +1,199 @@
+/*
+ * testThreadSchedulingPolicy.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#define BOOST_TEST_MODULE testThreadSchedulingPolicy
+
+#include <future>
+
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/ControlSystemPVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/DevicePVManager.h>
+
+#include "Application.h"
+#include "ScalarAccessor.h"
+#include "ApplicationModule.h"
+#include "ModuleGroup.h"
+#include "ControlSystemModule.h"
+#include "ThreadSchedulingPolicy.h"
+#include "Numa.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+/* the ApplicationModule for the test, reporting the placement of its thread */
+
+struct TestModule : public ctk::ApplicationModule {
+    using ctk::ApplicationModule::ApplicationModule;
+
+    ctk::ScalarPushInput<int32_t> input{this, "input", "", "No comment."};
+
+    std::promise<void> started;
+    bool runsOnCpu0Only{false};
+    int nice{0};
+
+    void mainLoop() {
+      cpu_set_t set;
+      CPU_ZERO(&set);
+      sched_getaffinity(0, sizeof(set), &set);
+      runsOnCpu0Only = CPU_COUNT(&set) == 1 && CPU_ISSET(0, &set);
+      nice = getpriority(PRIO_PROCESS, syscall(SYS_gettid));
+      started.set_value();
+    }
+};
+
+struct TestGroup : public ctk::ModuleGroup {
+    using ctk::ModuleGroup::ModuleGroup;
+
+    TestModule module{this, "module", "The test module"};
+};
+
+/*********************************************************************************************************************/
+/* dummy application */
+
+struct TestApplication : public ctk::Application {
+    TestApplication() : Application("testSuite") {}
+    ~TestApplication() { shutdown(); }
+
+    void defineConnections() {
+      cs("input") >> group.module.input;
+      cs("unscheduledInput") >> unscheduled.input;
+    }
+
+    TestGroup group{this, "group", "The test group", false, {"schedCpus0", "schedNice5"}};
+    TestModule unscheduled{this, "unscheduled", "The test module without policy"};
+    ctk::ControlSystemModule cs;
+};
+
+/*********************************************************************************************************************/
+/* application for the NUMA placement */
+
+struct ProducerModule : public ctk::ApplicationModule {
+    using ctk::ApplicationModule::ApplicationModule;
+
+    ctk::ScalarOutput<int32_t> output{this, "output", "", "No comment."};
+
+    void mainLoop() {}
+};
+
+struct NumaApplication : public ctk::Application {
+    NumaApplication() : Application("testSuite") {}
+    ~NumaApplication() { shutdown(); }
+
+    void defineConnections() {
+      producer.output >> consumer.input;
+      cs("input") >> pinned.input;
+    }
+
+    ProducerModule producer{this, "producer", "The producing module"};
+    TestModule consumer{this, "consumer", "The consuming module"};
+    TestModule pinned{this, "pinned", "The explicitly placed module", false, {"schedCpus0"}};
+    ctk::ControlSystemModule cs;
+};
+
+/*********************************************************************************************************************/
+/* test parsing the tags */
+
+BOOST_AUTO_TEST_CASE( testTags ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testTags" << std::endl;
+
+  auto policy = ctk::ThreadSchedulingPolicy::fromTags({"schedCpus0,2-3", "schedFifo80", "schedNice-3", "other",
+                                                       "schedNumaNode1"});
+  BOOST_CHECK(policy.cpus == std::vector<int>({0, 2, 3}));
+  BOOST_CHECK(policy.schedulingClass == ctk::ThreadSchedulingPolicy::SchedulingClass::fifo);
+  BOOST_CHECK_EQUAL(policy.priority, 80);
+  BOOST_CHECK(policy.hasNice);
+  BOOST_CHECK_EQUAL(policy.nice, -3);
+  BOOST_CHECK_EQUAL(policy.numaNode, 1);
+
+  auto nicePolicy = ctk::ThreadSchedulingPolicy::fromTags({"schedNice5"});
+  BOOST_CHECK(policy.isMoreUrgentThan(nicePolicy));
+  BOOST_CHECK(!nicePolicy.isMoreUrgentThan(policy));
+  BOOST_CHECK(nicePolicy.isMoreUrgentThan(ctk::ThreadSchedulingPolicy()));
+  BOOST_CHECK(!ctk::ThreadSchedulingPolicy::fromTags({"other"}).isEnabled());
+
+  for(std::string tag : {"schedCpus", "schedCpus3-1", "schedFifo0", "schedRR100", "schedNiceX", "schedNice20"}) {
+    BOOST_CHECK_THROW(ctk::ThreadSchedulingPolicy::fromTags({tag}),
+                      ctk::ApplicationExceptionWithID<ctk::ApplicationExceptionID::illegalParameter>);
+  }
+  BOOST_CHECK_THROW(ctk::ThreadSchedulingPolicy::fromTags({"schedFifo10", "schedRR10"}),
+                    ctk::ApplicationExceptionWithID<ctk::ApplicationExceptionID::illegalParameter>);
+
+}
+
+/*********************************************************************************************************************/
+/* test applying the policy given by the tags of a ModuleGroup to the module thread and the network */
+
+BOOST_AUTO_TEST_CASE( testModuleThread ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testModuleThread" << std::endl;
+
+  TestApplication app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+
+  // the FanOuts serving the module use the policy of the module, since its variables carry the tags
+  auto networkPolicy = ctk::VariableNetworkNode(app.group.module.input).getOwner().getSchedulingPolicy();
+  BOOST_CHECK(networkPolicy.cpus == std::vector<int>({0}));
+  BOOST_CHECK_EQUAL(networkPolicy.nice, 5);
+
+  auto started = app.group.module.started.get_future();
+  auto startedUnscheduled = app.unscheduled.started.get_future();
+  app.run();
+  started.wait();
+  startedUnscheduled.wait();
+  BOOST_CHECK(app.group.module.runsOnCpu0Only);
+  BOOST_CHECK_EQUAL(app.group.module.nice, 5);
+  BOOST_CHECK_EQUAL(app.unscheduled.nice, getpriority(PRIO_PROCESS, 0));
+
+}
+
+/*********************************************************************************************************************/
+/* test the automatic placement of the modules on the NUMA nodes */
+
+BOOST_AUTO_TEST_CASE( testNumaPlacement ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testNumaPlacement" << std::endl;
+
+  BOOST_CHECK_GE(ctk::Numa::getNumberOfNodes(), 1);
+  BOOST_CHECK(!ctk::Numa::getCpusOfNode(0).empty());
+  BOOST_CHECK(ctk::Numa::getCpusOfNode(ctk::Numa::getNumberOfNodes()).empty());
+
+  NumaApplication app;
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.enableNumaPlacement();
+  app.initialise();
+
+  // communicating modules are placed on the same node, explicitly placed modules are not changed
+  int node = app.producer.getSchedulingPolicy().numaNode;
+  BOOST_CHECK_GE(node, 0);
+  BOOST_CHECK_LT(node, ctk::Numa::getNumberOfNodes());
+  BOOST_CHECK_EQUAL(app.consumer.getSchedulingPolicy().numaNode, node);
+  BOOST_CHECK_EQUAL(app.pinned.getSchedulingPolicy().numaNode, -1);
+  BOOST_CHECK(app.pinned.getSchedulingPolicy().cpus == std::vector<int>({0}));
+
+  // the network follows the consumer
+  BOOST_CHECK_EQUAL(ctk::VariableNetworkNode(app.consumer.input).getOwner().getConsumerNumaNode(), node);
+
+  // memory allocated while the preferred node is set is placed on that node
+  std::vector<char> buffer;
+  {
+    ctk::Numa::PreferredNodeScope scope(node);
+    buffer.resize(1024*1024, 1);
+  }
+  BOOST_CHECK_EQUAL(ctk::Numa::getNodeOfAddress(buffer.data()+buffer.size()/2), node);
+
+}
@@ -0,0 +1,260 @@
+/*
+ * testVariableRecorder.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#define BOOST_TEST_MODULE testVariableRecorder
+
+#include <iterator>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <mtca4u/ExperimentalFeatures.h>
+
+#include "Application.h"
+#include "ApplicationModule.h"
+#include "ControlSystemModule.h"
+#include "ScalarAccessor.h"
+#include "ArrayAccessor.h"
+#include "TestFacility.h"
+#include "VariableReplayer.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+constexpr char recordingFile[] = "testVariableRecorder.rec";
+
+/*********************************************************************************************************************/
+/* the MultiplierModule multiplies its inputs by a configurable factor */
+
+struct MultiplierModule : public ctk::ApplicationModule {
+    MultiplierModule(EntityOwner *owner, const std::string &name, const std::string &description, int32_t factor)
+    : ctk::ApplicationModule(owner, name, description), _factor(factor) {}
+
+    ctk::ScalarPushInput<int32_t> input{this, "input", "", "Scalar input"};
+    ctk::ArrayPushInput<std::string> texts{this, "texts", "", 2, "Array input"};
+    ctk::ScalarOutput<int32_t> output{this, "output", "", "Scalar input multiplied by the factor"};
+    ctk::ArrayOutput<std::string> textsOut{this, "textsOut", "", 2, "Array input in reverse order"};
+
+    void mainLoop() {
+      while(true) {
+        auto id = readAny();
+        if(id == input.getId()) {
+          output = _factor*input;
+          output.write();
+        }
+        else {
+          textsOut[0] = texts[1];
+          textsOut[1] = texts[0];
+          textsOut.write();
+        }
+      }
+    }
+
+    int32_t _factor;
+};
+
+/*********************************************************************************************************************/
+/* dummy application */
+
+struct TestApplication : public ctk::Application {
+    TestApplication(int32_t factor, const std::string &recording="")
+    : Application("testApplication"), multiplier(this, "multiplier", "", factor)
+    {
+      ctk::ExperimentalFeatures::enable();
+      if(recording != "") enableVariableRecording(recording);
+    }
+    ~TestApplication() { shutdown(); }
+
+    void defineConnections() {
+      multiplier.connectTo(cs);
+    }
+
+    MultiplierModule multiplier;
+    ctk::ControlSystemModule cs;
+};
+
+/*********************************************************************************************************************/
+
+void record() {
+  TestApplication app(2, recordingFile);
+  ctk::TestFacility test;
+  test.runApplication();
+
+  for(int32_t i=1; i<=5; ++i) {
+    test.writeScalar<int32_t>("input", i);
+    test.stepApplication();
+    BOOST_CHECK_EQUAL(test.readScalar<int32_t>("output"), 2*i);
+  }
+  test.writeArray<std::string>("texts", {"first", "second"});
+  test.stepApplication();
+  BOOST_CHECK(test.readArray<std::string>("textsOut") == std::vector<std::string>({"second", "first"}));
+}
+
+/*********************************************************************************************************************/
+/* test replaying a recording with an identically behaving application */
+
+BOOST_AUTO_TEST_CASE( testReplayIdentical ) {
+  std::cout << "*********************************************************************************************************************" << std::endl;
+  std::cout << "==> testReplayIdentical" << std::endl;
+
+  record();
+
+  TestApplication app(2);
+  ctk::TestFacility test;
+  test.runApplication();
+
+  ctk::VariableReplayer replayer(test, recordingFile);
+  BOOST_CHECK_EQUAL(replayer.replay(), 6);
+  BOOST_CHECK_EQUAL(replayer.getDifferences().size(), 0);
+  replayer.printDifferences();
+}
+
+/*********************************************************************************************************************/
+/* test replaying a recording with an application producing different outputs */
+
+BOOST_AUTO_TEST_CASE( testReplayDifferent ) {
+  std::cout << "*********************************************************************************************************************" << std::endl;
+  std::cout << "==> testReplayDifferent" << std::endl;
+
+  record();
+
+  TestApplication app(3);
+  ctk::TestFacility test;
+  test.runApplication();
+
+  ctk::VariableReplayer replayer(test, recordingFile);
+  BOOST_CHECK_EQUAL(replayer.replay(), 6);
+  replayer.printDifferences();
+
+  auto &differences = replayer.getDifferences();
+  BOOST_REQUIRE_EQUAL(differences.size(), 5);
+  for(size_t i=0; i<5; ++i) {
+    BOOST_CHECK_EQUAL(differences[i].step, i+1);
+    BOOST_CHECK_EQUAL(differences[i].variable, "/output");
+    BOOST_CHECK_EQUAL(differences[i].expected, std::to_string(2*(i+1)));
+    BOOST_CHECK_EQUAL(differences[i].actual, std::to_string(3*(i+1)));
+  }
+}
+
+/*********************************************************************************************************************/
+/* test that a broken recording is rejected */
+
+BOOST_AUTO_TEST_CASE( testCorruptRecording ) {
+  std::cout << "*********************************************************************************************************************" << std::endl;
+  std::cout << "==> testCorruptRecording" << std::endl;
+
+  {
+    std::ofstream file(recordingFile, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+    file << "NOTAREC";
+  }
+
+  TestApplication app(2);
+  ctk::TestFacility test;
+
+  BOOST_CHECK_THROW(ctk::VariableReplayer replayer(test, recordingFile),
+                    ctk::ApplicationExceptionWithID<ctk::ApplicationExceptionID::illegalParameter>);
+}
+
+/*********************************************************************************************************************/
+/* test that a recording without any input triggering the application is replayed as a single step */
+
+BOOST_AUTO_TEST_CASE( testReplayWithoutTrigger ) {
+  std::cout << "*********************************************************************************************************************" << std::endl;
+  std::cout << "==> testReplayWithoutTrigger" << std::endl;
+
+  {
+    ctk::VariableRecorder recorder(recordingFile);
+    auto id = recorder.addVariable<int32_t>(ctk::VariableRecorder::VariableKind::controlSystemOutput, "/output", "", 1);
+    std::string payload;
+    ctk::VariableRecorder::serialiseBuffer(payload, std::vector<int32_t>({42}));
+    recorder.commit(id, ctk::VersionNumber(), payload);
+  }
+
+  TestApplication app(2);
+  ctk::TestFacility test;
+  test.runApplication();
+
+  ctk::VariableReplayer replayer(test, recordingFile);
+  BOOST_CHECK_EQUAL(replayer.replay(), 1);
+  replayer.printDifferences();
+
+  // the output is not written by the application without input
+  auto &differences = replayer.getDifferences();
+  BOOST_REQUIRE_EQUAL(differences.size(), 1);
+  BOOST_CHECK_EQUAL(differences[0].step, 1);
+  BOOST_CHECK_EQUAL(differences[0].expected, "42");
+  BOOST_CHECK_EQUAL(differences[0].actual, "(no update)");
+}
+
+/*********************************************************************************************************************/
+/* Read the version ordinals of all data entries from the recording */
+
+std::vector<uint64_t> readVersionOrdinals() {
+  std::ifstream file(recordingFile, std::ios_base::in | std::ios_base::binary);
+  std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  const char *pos = content.data() + std::strlen(ctk::VariableRecorder::magic);
+  const char *end = content.data() + content.size();
+
+  auto read = [&pos](void *target, size_t size) { std::memcpy(target, pos, size); pos += size; };
+  auto skipString = [&pos, &read] { uint32_t length; read(&length, sizeof(length)); pos += length; };
+
+  std::vector<uint64_t> ordinals;
+  while(pos < end) {
+    char tag = *(pos++);
+    if(tag == 'V') {
+      pos += sizeof(uint32_t) + sizeof(uint8_t);
+      skipString();
+      pos += sizeof(uint32_t);
+      skipString();
+      skipString();
+    }
+    else {
+      BOOST_REQUIRE_EQUAL(tag, 'D');
+      uint64_t ordinal;
+      uint32_t payloadSize;
+      pos += sizeof(uint32_t);
+      read(&ordinal, sizeof(ordinal));
+      pos += sizeof(int64_t);
+      read(&payloadSize, sizeof(payloadSize));
+      pos += payloadSize;
+      ordinals.push_back(ordinal);
+    }
+  }
+  return ordinals;
+}
+
+/*********************************************************************************************************************/
+/* test the limit of the VersionNumbers remembered by the recorder */
+
+BOOST_AUTO_TEST_CASE( testVersionOrdinalLimit ) {
+  std::cout << "*********************************************************************************************************************" << std::endl;
+  std::cout << "==> testVersionOrdinalLimit" << std::endl;
+
+  std::vector<ctk::VersionNumber> versions(4);
+  std::string payload;
+  ctk::VariableRecorder::serialiseBuffer(payload, std::vector<int32_t>({0}));
+
+  // the first VersionNumber is still known when it is used again
+  {
+    ctk::VariableRecorder recorder(recordingFile, 4);
+    auto id = recorder.addVariable<int32_t>(ctk::VariableRecorder::VariableKind::controlSystemInput, "/input", "", 1);
+    for(auto &version : versions) recorder.commit(id, version, payload);
+    recorder.commit(id, versions[0], payload);
+  }
+  BOOST_CHECK(readVersionOrdinals() == std::vector<uint64_t>({0, 1, 2, 3, 0}));
+
+  // the first VersionNumber has been evicted when it is used again, so it gets a new ordinal
+  {
+    ctk::VariableRecorder recorder(recordingFile, 3);
+    auto id = recorder.addVariable<int32_t>(ctk::VariableRecorder::VariableKind::controlSystemInput, "/input", "", 1);
+    for(auto &version : versions) recorder.commit(id, version, payload);
+    recorder.commit(id, versions[0], payload);
+    recorder.commit(id, versions[3], payload);
+  }
+  BOOST_CHECK(readVersionOrdinals() == std::vector<uint64_t>({0, 1, 2, 3, 4, 3}));
+
+  BOOST_CHECK_THROW(ctk::VariableRecorder(recordingFile, 0),
+                    ctk::ApplicationExceptionWithID<ctk::ApplicationExceptionID::illegalParameter>);
+}
@@ -0,0 +1,182 @@
+/*
+ * testWaitPolicy.cc
+ *
+ *  Created on: Oct 18, 2026
+ */
+
+#define BOOST_TEST_MODULE testWaitPolicy
+
+#include <future>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <ChimeraTK/ControlSystemAdapter/PVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/ControlSystemPVManager.h>
+#include <ChimeraTK/ControlSystemAdapter/DevicePVManager.h>
+
+#include "Application.h"
+#include "ScalarAccessor.h"
+#include "ApplicationModule.h"
+#include "ControlSystemModule.h"
+#include "WaitPolicy.h"
+
+using namespace boost::unit_test_framework;
+namespace ctk = ChimeraTK;
+
+/*********************************************************************************************************************/
+/* return the integrated spin time of the calling thread. Must be called before any registered thread has terminated,
+ * since the profiler keeps the data of terminated threads in its list. */
+
+uint64_t getSpinTime() {
+  for(auto thread : ctk::Profiler::getDataList()) {
+    if(thread->getName() == ctk::Application::threadName()) return thread->getIntegratedSpinTime();
+  }
+  return 0;
+}
+
+/*********************************************************************************************************************/
+/* the ApplicationModule for the test, receiving one value with read() and one with readAny() */
+
+struct TestModule : public ctk::ApplicationModule {
+    using ctk::ApplicationModule::ApplicationModule;
+
+    ctk::ScalarPushInput<int32_t> input{this, "input", "", "No comment."};
+    ctk::ScalarPushInput<int32_t> second{this, "second", "", "No comment."};
+
+    std::promise<void> started;
+    std::promise<int32_t> received;
+    std::promise<bool> receivedSecond;
+    std::promise<uint64_t> spinTime;
+    bool measureSpinTime{false};
+
+    void mainLoop() {
+      started.set_value();
+      input.read();
+      received.set_value(input);
+      auto id = readAny();
+      receivedSecond.set_value(id == second.getId() && second == 42);
+      if(measureSpinTime) spinTime.set_value(getSpinTime());
+    }
+};
+
+/*********************************************************************************************************************/
+/* dummy application */
+
+struct TestApplication : public ctk::Application {
+    TestApplication(const std::unordered_set<std::string> &tags) : Application("testSuite"),
+      module(this, "module", "The test module", false, tags) {}
+    ~TestApplication() { shutdown(); }
+
+    void defineConnections() {
+      cs("input") >> module.input;
+      cs("second") >> module.second;
+    }
+
+    TestModule module;
+    ctk::ControlSystemModule cs;
+};
+
+/*********************************************************************************************************************/
+/* send the values to the module and check that they are received */
+
+void sendValues(TestApplication &app, ctk::ControlSystemPVManager &csManager) {
+  auto started = app.module.started.get_future();
+  auto received = app.module.received.get_future();
+  auto receivedSecond = app.module.receivedSecond.get_future();
+  app.run();
+  started.wait();
+
+  // give the module some time to start waiting
+  usleep(10000);
+  auto input = csManager.getProcessArray<int32_t>("/input");
+  input->accessData(0) = 120;
+  input->write();
+  BOOST_CHECK_EQUAL(received.get(), 120);
+
+  usleep(10000);
+  auto second = csManager.getProcessArray<int32_t>("/second");
+  second->accessData(0) = 42;
+  second->write();
+  BOOST_CHECK(receivedSecond.get());
+}
+
+/*********************************************************************************************************************/
+/* test parsing the tags */
+
+BOOST_AUTO_TEST_CASE( testTags ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testTags" << std::endl;
+
+  auto policy = ctk::WaitPolicy::fromTags({"waitSpin50", "other"});
+  BOOST_CHECK(policy.mode == ctk::WaitPolicy::Mode::spinThenBlock);
+  BOOST_CHECK_EQUAL(policy.spinTime.count(), 50);
+  BOOST_CHECK(policy.isEnabled());
+
+  // the longest spinning policy wins
+  BOOST_CHECK_EQUAL(ctk::WaitPolicy::fromTags({"waitSpin50", "waitSpin200"}).spinTime.count(), 200);
+  auto busyPoll = ctk::WaitPolicy::fromTags({"waitSpin50", "waitBusyPoll"});
+  BOOST_CHECK(busyPoll.mode == ctk::WaitPolicy::Mode::busyPoll);
+  BOOST_CHECK(busyPoll.spinsLongerThan(policy));
+  BOOST_CHECK(!policy.spinsLongerThan(busyPoll));
+  BOOST_CHECK(policy.spinsLongerThan(ctk::WaitPolicy()));
+  BOOST_CHECK(!ctk::WaitPolicy::fromTags({"other"}).isEnabled());
+
+  for(std::string tag : {"waitSpin", "waitSpinX", "waitSpin-1", "waitSpin10us"}) {
+    BOOST_CHECK_THROW(ctk::WaitPolicy::fromTags({tag}),
+                      ctk::ApplicationExceptionWithID<ctk::ApplicationExceptionID::illegalParameter>);
+  }
+
+}
+
+/*********************************************************************************************************************/
+/* test that a spinning module receives the values and the spin time is accounted */
+
+BOOST_AUTO_TEST_CASE( testSpinThenBlock ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testSpinThenBlock" << std::endl;
+
+  // spin long enough to receive both values while spinning. This must be the first test case starting threads, see
+  // getSpinTime().
+  TestApplication app({"waitSpin1000000"});
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+  BOOST_CHECK_EQUAL(app.module.getWaitPolicy().spinTime.count(), 1000000);
+  app.module.measureSpinTime = true;
+
+  sendValues(app, *pvManagers.first);
+  BOOST_CHECK_GE(app.module.spinTime.get_future().get(), 10000);
+
+}
+
+/*********************************************************************************************************************/
+/* test that a module spinning only shortly falls back to blocking */
+
+BOOST_AUTO_TEST_CASE( testFallBackToBlocking ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testFallBackToBlocking" << std::endl;
+
+  TestApplication app({"waitSpin100"});
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+
+  sendValues(app, *pvManagers.first);
+
+}
+
+/*********************************************************************************************************************/
+/* test busy polling */
+
+BOOST_AUTO_TEST_CASE( testBusyPoll ) {
+  std::cout << "***************************************************************************************" << std::endl;
+  std::cout << "==> testBusyPoll" << std::endl;
+
+  TestApplication app({"waitBusyPoll"});
+  auto pvManagers = ctk::createPVManager();
+  app.setPVManager(pvManagers.second);
+  app.initialise();
+
+  sendValues(app, *pvManagers.first);
+
+}
@@ -0,0 +1,37 @@
+/*
+ * compileConfig.cc
+ *
+ *  Created on: Oct 18, 2026
+ *
+ *  Tool to compile XML config files of the ConfigReader into the binary format, which is loaded much faster. The
+ *  compiled file is only used by the ConfigReader as long as the XML file is unchanged, so the tool has to be run
+ *  again after each change of the XML file.
+ *
+ *  Usage: chimeratk-compile-config [--strict] <config.xml> [<compiled file>]
+ *  If no name for the compiled file is given, "<config.xml>.bin" is used, which is the file the ConfigReader looks for.
+ *  With --strict, values which cannot be converted completely into their type are rejected (see ConfigReader).
+ */
+
+#include <iostream>
+#include <cstring>
+
+#include "ConfigReader.h"
+
+int main(int argc, char **argv) {
+  bool strict = argc > 1 && std::strcmp(argv[1], "--strict") == 0;
+  int first = strict ? 2 : 1;
+  if(argc < first+1 || argc > first+2) {
+    std::cerr << "Usage: " << argv[0] << " [--strict] <config.xml> [<compiled file>]" << std::endl;
+    return 1;
+  }
+
+  try {
+    ChimeraTK::ConfigReader::compile(argv[first], argc > first+1 ? argv[first+1] : "", strict);
+  }
+  catch(std::exception &e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}